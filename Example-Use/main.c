@@ -11,16 +11,33 @@
 
 **/
 #include <Windows.h>
+#include <limits.h>
 #include <stdio.h>
+#include <string.h>
 #include <time.h>
 
+#include "branch-bound.h"
+#include "build-graph.h"
+#include "compressed-graph.h"
+#include "dag-max-path.h"
+#include "dijkstra-alt.h"
+#include "dijkstra-bidirectional.h"
+#include "dijkstra-delta.h"
+#include "dijkstra-hierarchy.h"
+#include "dijkstra-matrix.h"
 #include "dijkstra-max.h"
 #include "dijkstra-min.h"
+#include "dijkstra-multi.h"
+#include "dijkstra-workspace.h"
 #include "edges.h"
 #include "export-graph.h"
+#include "frozen-graph.h"
 #include "graph.h"
+#include "held-karp.h"
 #include "import-graph.h"
+#include "parallel.h"
 #include "search.h"
+#include "strong-components.h"
 #include "vertices.h"
 
 /* ============================= */
@@ -41,6 +58,9 @@
 #define DEFAULT_SAVE_FILE_NAME DEFAULT_LOCATION "save.dat"
 #define DEFAULT_LOAD_FILE_NAME DEFAULT_SAVE_FILE_NAME
 #define DEFAULT_FIND_ALL_PATHS_FILE_NAME DEFAULT_LOCATION "find-all.txt"
+#define DEFAULT_LANDMARKS_FILE_NAME DEFAULT_LOCATION "landmarks.dat"
+#define DEFAULT_HIERARCHY_GRAPH_FILE_NAME DEFAULT_LOCATION "hierarchy-graph.dat"
+#define DEFAULT_HIERARCHY_FILE_NAME DEFAULT_LOCATION "hierarchy.dat"
 
 /* ================================== */
 /* Define Default file specifications */
@@ -50,6 +70,38 @@
 #define ONE_MILLION_TEST_HASH_SIZE 2000000
 #define ONE_MILLION_TEST_NUM_VERTICES 1000000
 #define ONE_MILLION_TEST_NUM_EDGES 1000000
+#define BUILD_GRAPH_TEST_NUM_VERTICES 1000000
+#define BUILD_GRAPH_TEST_NUM_EDGES 10000000
+#define DIJKSTRA_QUEUE_TEST_NUM_VERTICES 1000000
+#define DIJKSTRA_QUEUE_TEST_NUM_EDGES 4000000
+#define DIJKSTRA_QUEUE_TEST_NUM_QUERIES 10
+#define BIDIRECTIONAL_TEST_GRID_SIZE 1000  // Grid of 1000 x 1000 vertices
+#define BIDIRECTIONAL_TEST_NUM_QUERIES 10
+#define HIERARCHY_TEST_GRID_SIZE 200  // Grid of 200 x 200 vertices
+#define HIERARCHY_TEST_NUM_QUERIES 100
+#define DELTA_STEPPING_TEST_NUM_VERTICES 1000000
+#define DELTA_STEPPING_TEST_NUM_EDGES 4000000
+#define DISTANCE_MATRIX_TEST_NUM_VERTICES 100000
+#define DISTANCE_MATRIX_TEST_NUM_EDGES 400000
+#define DISTANCE_MATRIX_TEST_NUM_SOURCES 20
+#define DISTANCE_MATRIX_TEST_NUM_TARGETS 20
+#define NEAREST_FACILITY_TEST_NUM_VERTICES 100000
+#define NEAREST_FACILITY_TEST_NUM_EDGES 400000
+#define NEAREST_FACILITY_TEST_NUM_FACILITIES 16
+#define NEAREST_FACILITY_TEST_K 3
+#define DAG_MAX_PATH_TEST_NUM_VERTICES 1000000
+#define DAG_MAX_PATH_TEST_NUM_EDGES 4000000
+#define DAG_MAX_PATH_TEST_SMALL_VERTICES 16  // Small enough for FindAllPaths
+#define DAG_MAX_PATH_TEST_SMALL_EDGES 40
+#define SCC_TEST_NUM_VERTICES 1000000
+#define SCC_TEST_NUM_EDGES 2000000
+#define SCC_TEST_CYCLE_LENGTH 100000  // Vertices of one long cycle
+#define BRANCH_BOUND_TEST_NUM_VERTICES 30  // Small enough for FindAllPaths
+#define BRANCH_BOUND_TEST_NUM_EDGES 150
+#define HELD_KARP_TEST_NUM_VERTICES 24  // At most HELD_KARP_MAX_VERTICES
+#define HELD_KARP_TEST_NUM_EDGES 550
+#define PARALLEL_SEARCH_TEST_NUM_VERTICES 30
+#define PARALLEL_SEARCH_TEST_NUM_EDGES 140  // About two million paths
 
 /* ========================== */
 /*            Misc            */
@@ -63,6 +115,7 @@
 /* =================================== */
 #define CREATE_ADD_VERTICES_TEST
 #define CREATE_ADD_EDGES_TEST
+#define BUILD_GRAPH_TEST
 #define IMPORT_TEST
 #define EXPORT_TEST
 #define SAVE_TEST
@@ -70,11 +123,251 @@
 #define FIND_ALL_PATHS_TEST
 #define DIJKSTRA_SHORTEST_PATH
 #define DIJKSTRA_LONGEST_PATH
+#define FROZEN_GRAPH_TEST
+#define COMPRESSED_GRAPH_TEST
+#define DIJKSTRA_QUEUE_TEST
+#define BIDIRECTIONAL_DIJKSTRA_TEST
+#define ALT_TEST  // Runs on the grid of BIDIRECTIONAL_DIJKSTRA_TEST
+#define CONTRACTION_HIERARCHY_TEST
+#define DELTA_STEPPING_TEST
+#define DISTANCE_MATRIX_TEST
+#define NEAREST_FACILITY_TEST
+#define DAG_MAX_PATH_TEST
+#define SCC_TEST
+#define BRANCH_BOUND_TEST
+#define HELD_KARP_TEST
+#define PARALLEL_SEARCH_TEST
 
-/* =================== */
-/* Include the library */
-/* =================== */
-#pragma comment(lib, "Maximal-Graph-Sum.lib")
+/* ========================== */
+/*      Test graph setup      */
+/* ========================== */
+
+/**
+    @brief Picks a random vertex identifier, as rand() only gives 15 bits at
+           a time.
+    @param limit Number of identifiers to pick from.
+    @return An identifier below the limit.
+**/
+static unsigned int RandomVertexId(unsigned int limit) {
+  return ((unsigned int)rand() << 15 | rand()) % limit;
+}
+
+/**
+    @brief Allocates random edges, with weights between 1 and 100 as written
+           by generate-random-graph.py.
+    @param numEdges Number of edges.
+    @param numVertices Number of identifiers the ends are picked from.
+    @param src Receives the sources, freed by the caller.
+    @param dest Receives the destinations, freed by the caller.
+    @param weight Receives the weights, freed by the caller.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool FillRandomEdges(unsigned int numEdges, unsigned int numVertices,
+                            unsigned int** src, unsigned int** dest,
+                            unsigned int** weight) {
+  *src = (unsigned int*)malloc(numEdges * sizeof(unsigned int));
+  *dest = (unsigned int*)malloc(numEdges * sizeof(unsigned int));
+  *weight = (unsigned int*)malloc(numEdges * sizeof(unsigned int));
+  if (*src == NULL || *dest == NULL || *weight == NULL) {
+    free(*src);
+    free(*dest);
+    free(*weight);
+    return false;
+  }
+
+  for (unsigned int i = 0; i < numEdges; i++) {
+    (*src)[i] = RandomVertexId(numVertices);
+    (*dest)[i] = RandomVertexId(numVertices);
+    (*weight)[i] = rand() % 100 + 1;
+  }
+
+  return true;
+}
+
+/**
+    @struct SearchTest
+    @brief  What the searches compared by CompareSearches run on.
+**/
+typedef struct SearchTest {
+  const Graph* graph;                     // Graph every query runs on
+  DijkstraWorkspace* workspace;           // Reused by every query
+  const Landmarks* landmarks;             // Only used by AltSearch
+  const ContractionHierarchy* hierarchy;  // Only used by HierarchySearch
+} SearchTest;
+
+/**
+    @brief A shortest path search compared by CompareSearches.
+    @return The sum of the path found, or UINT_MAX if there is none.
+**/
+typedef unsigned int (*TestSearch)(const SearchTest* test, unsigned int src,
+                                   unsigned int dest);
+
+static unsigned int ForwardSearch(const SearchTest* test, unsigned int src,
+                                  unsigned int dest) {
+  DijkstraOptions options = DefaultDijkstraOptions();
+  unsigned int sum = UINT_MAX;
+  unsigned int* path = NULL;
+  unsigned int pathLength;
+  DijkstraMinPathWithOptions(test->graph, src, dest, &options,
+                             test->workspace, &sum, &path, &pathLength);
+  free(path);
+  return sum;
+}
+
+static unsigned int HeapSearch(const SearchTest* test, unsigned int src,
+                               unsigned int dest) {
+  DijkstraOptions options = DefaultDijkstraOptions();
+  options.queue = DIJKSTRA_QUEUE_HEAP;
+  unsigned int sum = UINT_MAX;
+  unsigned int* path = NULL;
+  unsigned int pathLength;
+  DijkstraMinPathWithOptions(test->graph, src, dest, &options,
+                             test->workspace, &sum, &path, &pathLength);
+  free(path);
+  return sum;
+}
+
+static unsigned int BucketSearch(const SearchTest* test, unsigned int src,
+                                 unsigned int dest) {
+  DijkstraOptions options = DefaultDijkstraOptions();
+  options.queue = DIJKSTRA_QUEUE_BUCKETS;
+  unsigned int sum = UINT_MAX;
+  unsigned int* path = NULL;
+  unsigned int pathLength;
+  DijkstraMinPathWithOptions(test->graph, src, dest, &options,
+                             test->workspace, &sum, &path, &pathLength);
+  free(path);
+  return sum;
+}
+
+// Allocates its own workspace, as before workspaces existed
+static unsigned int PlainSearch(const SearchTest* test, unsigned int src,
+                                unsigned int dest) {
+  unsigned int sum = UINT_MAX;
+  unsigned int* path = NULL;
+  unsigned int pathLength;
+  DijkstraMinPath(test->graph, src, dest, &sum, &path, &pathLength);
+  free(path);
+  return sum;
+}
+
+static unsigned int BidirectionalSearch(const SearchTest* test,
+                                        unsigned int src, unsigned int dest) {
+  unsigned int sum = UINT_MAX;
+  unsigned int* path = NULL;
+  unsigned int pathLength;
+  DijkstraBidirectionalMinPath(test->graph, src, dest, test->workspace, &sum,
+                               &path, &pathLength);
+  free(path);
+  return sum;
+}
+
+static unsigned int AltSearch(const SearchTest* test, unsigned int src,
+                              unsigned int dest) {
+  unsigned int sum = UINT_MAX;
+  unsigned int* path = NULL;
+  unsigned int pathLength;
+  DijkstraAltMinPath(test->graph, test->landmarks, src, dest,
+                     test->workspace, &sum, &path, &pathLength);
+  free(path);
+  return sum;
+}
+
+static unsigned int HierarchySearch(const SearchTest* test, unsigned int src,
+                                    unsigned int dest) {
+  unsigned int sum = UINT_MAX;
+  unsigned int* path = NULL;
+  unsigned int pathLength;
+  DijkstraHierarchyMinPath(test->graph, test->hierarchy, src, dest,
+                           test->workspace, &sum, &path, &pathLength);
+  free(path);
+  return sum;
+}
+
+/**
+    @brief Runs two searches between the same random vertices, and prints the
+           time each one used and how many sums differ.
+    @param test What both searches run on.
+    @param first The search to compare against.
+    @param firstName How the first search is printed after "CPU time used".
+    @param second The search being tested.
+    @param secondName How the second search is printed.
+    @param numQueries Number of queries.
+**/
+static void CompareSearches(const SearchTest* test, TestSearch first,
+                            const char* firstName, TestSearch second,
+                            const char* secondName, unsigned int numQueries) {
+  clock_t firstTime = 0;
+  clock_t secondTime = 0;
+  unsigned int mismatches = 0;
+  for (unsigned int i = 0; i < numQueries; i++) {
+    unsigned int src = RandomVertexId(test->graph->numVertices);
+    unsigned int dest = RandomVertexId(test->graph->numVertices);
+
+    clock_t start = clock();
+    unsigned int firstSum = first(test, src, dest);
+    firstTime += clock() - start;
+
+    start = clock();
+    unsigned int secondSum = second(test, src, dest);
+    secondTime += clock() - start;
+
+    if (firstSum != secondSum) {
+      mismatches++;
+    }
+  }
+
+  printf("CPU time used %s: %f seconds\n", firstName,
+         ((double)firstTime) / CLOCKS_PER_SEC);
+  printf("CPU time used %s: %f seconds\n", secondName,
+         ((double)secondTime) / CLOCKS_PER_SEC);
+  printf("Queries with different sums: %u\n", mismatches);
+}
+
+/**
+    @brief Builds a road-like grid, every vertex linked both ways to its
+           right and lower neighbours with weights between 1 and 100.
+    @param side Number of vertices on each side of the grid.
+    @param trackInEdges True to track incoming edges, enabled before any edge
+           is added so none is mirrored later.
+    @return A pointer to the grid, or NULL if memory allocation fails.
+**/
+static Graph* BuildTestGrid(unsigned int side, bool trackInEdges) {
+  Graph* grid = CreateGraph(side * side);
+  if (grid == NULL) {
+    return NULL;
+  }
+
+  for (unsigned int i = 0; i < side * side; i++) {
+    if (CreateAddVertex(grid, i) != EXIT_SUCCESS) {
+      FreeGraph(grid);
+      return NULL;
+    }
+  }
+
+  if (trackInEdges && !EnableInEdgeIndex(grid)) {
+    FreeGraph(grid);
+    return NULL;
+  }
+
+  for (unsigned int y = 0; y < side; y++) {
+    for (unsigned int x = 0; x < side; x++) {
+      unsigned int id = y * side + x;
+      Vertex* vertex = FindVertex(grid, id);
+      if (x + 1 < side) {
+        CreateAddEdge(grid, vertex, id + 1, rand() % 100 + 1);
+        CreateAddEdge(grid, FindVertex(grid, id + 1), id, rand() % 100 + 1);
+      }
+      if (y + 1 < side) {
+        unsigned int below = id + side;
+        CreateAddEdge(grid, vertex, below, rand() % 100 + 1);
+        CreateAddEdge(grid, FindVertex(grid, below), id, rand() % 100 + 1);
+      }
+    }
+  }
+
+  return grid;
+}
 
 int main() {
   // Variables used to measure time
@@ -99,13 +392,17 @@ int main() {
   end = clock();
   printf("Ending number of vertices: %u\n", graphVerticesTest->numVertices);
 
-  // Free Graph from memory
-  FreeGraph(graphVerticesTest);
-
   // Calculate the CPU time used
   cpuTimeUsed = ((double)(end - start)) / CLOCKS_PER_SEC;
   printf("CPU time used: %f seconds\n", cpuTimeUsed);
 
+  // Free Graph from memory
+  start = clock();
+  FreeGraph(graphVerticesTest);
+  end = clock();
+  cpuTimeUsed = ((double)(end - start)) / CLOCKS_PER_SEC;
+  printf("CPU time used freeing the graph: %f seconds\n", cpuTimeUsed);
+
 #endif  //  CREATE_ADD_VERTICES_TEST
 
 #ifdef CREATE_ADD_EDGES_TEST
@@ -138,8 +435,7 @@ int main() {
 
   // Create and add edges to the specified vertex
   for (unsigned int i = 0; i < ONE_MILLION_TEST_NUM_EDGES; i++) {
-    Edge* edge = CreateEdge(i, 1);
-    AddEdgeToVertex(srcVertex, edge);
+    CreateAddEdge(graphEdgesTest, srcVertex, i, 1);
   }
 
   // End test
@@ -148,19 +444,58 @@ int main() {
   printf("CPU time used: %f seconds\n", cpuTimeUsed);
 
   // Verify the number of edges added
-  unsigned int edgeCount = 0;
-  Edge* edge = srcVertex->edges;
-  while (edge != NULL) {
-    edgeCount++;
-    edge = edge->next;
-  }
-  printf("Number of edges added: %u\n", edgeCount);
+  printf("Number of edges added: %u\n", srcVertex->edges.degree);
 
-  // Free Graph from memory
+  // Free Graph from memory, timed as the edges are released a slab at a time
+  start = clock();
   FreeGraph(graphEdgesTest);
+  end = clock();
+  cpuTimeUsed = ((double)(end - start)) / CLOCKS_PER_SEC;
+  printf("CPU time used freeing the graph: %f seconds\n", cpuTimeUsed);
 
 #endif  // CREATE_ADD_EDGE_TEST
 
+#ifdef BUILD_GRAPH_TEST
+
+  printf("\n\nExecuting Build Graph From Edges test...\n");
+
+  unsigned int* buildSrc;
+  unsigned int* buildDest;
+  unsigned int* buildWeight;
+  if (!FillRandomEdges(BUILD_GRAPH_TEST_NUM_EDGES,
+                       BUILD_GRAPH_TEST_NUM_VERTICES, &buildSrc, &buildDest,
+                       &buildWeight)) {
+    printf("Error allocating the edges for testing.\n");
+    return 1;
+  }
+
+  // Begin Test
+  printf("Edges ready, beginning test.\n");
+  start = clock();
+
+  Graph* graphBuildTest = BuildGraphFromEdges(
+      buildSrc, buildDest, buildWeight, BUILD_GRAPH_TEST_NUM_EDGES,
+      BUILD_KEEP_FIRST_WEIGHT);
+
+  // End test
+  end = clock();
+  cpuTimeUsed = ((double)(end - start)) / CLOCKS_PER_SEC;
+  printf("CPU time used: %f seconds\n", cpuTimeUsed);
+
+  free(buildSrc);
+  free(buildDest);
+  free(buildWeight);
+
+  if (graphBuildTest == NULL) {
+    printf("Error building graph.\n");
+    return 1;
+  }
+  printf("Number of vertices built: %u\n", graphBuildTest->numVertices);
+
+  FreeGraph(graphBuildTest);
+
+#endif  // BUILD_GRAPH_TEST
+
 #ifdef IMPORT_TEST
 
   printf("\n\nExecuting import test...\n");
@@ -397,5 +732,948 @@ int main() {
 
 #endif
 
+#ifdef FROZEN_GRAPH_TEST
+
+  printf("\n\nExecuting frozen graph test from 5 to 12...\n");
+
+  Graph* graphFrozenSource = CreateGraph(FIND_ALL_PATHS_FILE_HASH_SIZE);
+  if (ImportGraph(DEFAULT_FIND_ALL_PATHS_FILE_NAME, graphFrozenSource) !=
+    EXIT_SUCCESS) {
+    printf("Error importing graph.\n");
+    exit(EXIT_FAILURE);
+  }
+
+  // Start test
+  start = clock();
+
+  FrozenGraph* frozenGraph = FreezeGraph(graphFrozenSource);
+
+  // End test
+  end = clock();
+
+  if (frozenGraph == NULL) {
+    printf("Error freezing graph.\n");
+    exit(EXIT_FAILURE);
+  }
+
+  cpuTimeUsed = ((double)(end - start)) / CLOCKS_PER_SEC;
+  printf("CPU time used during freeze: %f seconds\n", cpuTimeUsed);
+
+  unsigned int minSumFrozen;
+  unsigned int maxWeightFrozen;
+  unsigned int* pathFrozen;
+  unsigned int pathLengthFrozen;
+
+  DijkstraMinPathFrozen(frozenGraph, DIJKSTRA_SOURCE_VERTEX,
+    DIJKSTRA_DESTINATION_VERTEX, &minSumFrozen, &pathFrozen,
+    &pathLengthFrozen);
+  PrintShortestPath(pathFrozen, pathLengthFrozen, minSumFrozen);
+  free(pathFrozen);
+
+  DijkstraMaxPathFrozen(frozenGraph, DIJKSTRA_SOURCE_VERTEX,
+    DIJKSTRA_DESTINATION_VERTEX, &maxWeightFrozen, &pathFrozen,
+    &pathLengthFrozen);
+  PrintLongestPath(pathFrozen, pathLengthFrozen, maxWeightFrozen);
+  free(pathFrozen);
+
+  FreeFrozenGraph(frozenGraph);
+  FreeGraph(graphFrozenSource);
+
+#endif
+
+#ifdef COMPRESSED_GRAPH_TEST
+
+  printf("\n\nExecuting compressed graph test from 5 to 12...\n");
+
+  Graph* graphCompressedSource = CreateGraph(FIND_ALL_PATHS_FILE_HASH_SIZE);
+  if (ImportGraph(DEFAULT_FIND_ALL_PATHS_FILE_NAME, graphCompressedSource) !=
+    EXIT_SUCCESS) {
+    printf("Error importing graph.\n");
+    exit(EXIT_FAILURE);
+  }
+
+  // Start test
+  start = clock();
+
+  CompressedGraph* compressedGraph = CompressGraph(graphCompressedSource);
+
+  // End test
+  end = clock();
+
+  if (compressedGraph == NULL) {
+    printf("Error compressing graph.\n");
+    exit(EXIT_FAILURE);
+  }
+
+  cpuTimeUsed = ((double)(end - start)) / CLOCKS_PER_SEC;
+  printf("CPU time used during compression: %f seconds\n", cpuTimeUsed);
+  printf("Compressed size: %zu bytes for %u edges\n",
+    CompressedGraphSize(compressedGraph), compressedGraph->numEdges);
+
+  unsigned int minSumCompressed;
+  unsigned int maxWeightCompressed;
+  unsigned int* pathCompressed;
+  unsigned int pathLengthCompressed;
+
+  DijkstraMinPathCompressed(compressedGraph, DIJKSTRA_SOURCE_VERTEX,
+    DIJKSTRA_DESTINATION_VERTEX, &minSumCompressed, &pathCompressed,
+    &pathLengthCompressed);
+  PrintShortestPath(pathCompressed, pathLengthCompressed, minSumCompressed);
+  free(pathCompressed);
+
+  DijkstraMaxPathCompressed(compressedGraph, DIJKSTRA_SOURCE_VERTEX,
+    DIJKSTRA_DESTINATION_VERTEX, &maxWeightCompressed, &pathCompressed,
+    &pathLengthCompressed);
+  PrintLongestPath(pathCompressed, pathLengthCompressed, maxWeightCompressed);
+  free(pathCompressed);
+
+  FreeCompressedGraph(compressedGraph);
+  FreeGraph(graphCompressedSource);
+
+#endif
+
+#ifdef DIJKSTRA_QUEUE_TEST
+
+  printf("\n\nExecuting Dijkstra heap against buckets test...\n");
+
+  unsigned int* queueSrc;
+  unsigned int* queueDest;
+  unsigned int* queueWeight;
+  if (!FillRandomEdges(DIJKSTRA_QUEUE_TEST_NUM_EDGES,
+                       DIJKSTRA_QUEUE_TEST_NUM_VERTICES, &queueSrc,
+                       &queueDest, &queueWeight)) {
+    printf("Error allocating the edges for testing.\n");
+    return 1;
+  }
+
+  Graph* graphQueueTest = BuildGraphFromEdges(
+      queueSrc, queueDest, queueWeight, DIJKSTRA_QUEUE_TEST_NUM_EDGES,
+      BUILD_KEEP_MIN_WEIGHT);
+  if (graphQueueTest == NULL) {
+    printf("Error building graph.\n");
+    return 1;
+  }
+
+  // Created once, so the queries below allocate nothing but their paths
+  DijkstraWorkspace* queueWorkspace =
+      CreateDijkstraWorkspace(graphQueueTest->indexCount);
+  if (queueWorkspace == NULL) {
+    printf("Error creating the workspace.\n");
+    return 1;
+  }
+
+  SearchTest queueTest = {graphQueueTest, queueWorkspace, NULL, NULL};
+  CompareSearches(&queueTest, HeapSearch, "with the heap", BucketSearch,
+                  "with the buckets", DIJKSTRA_QUEUE_TEST_NUM_QUERIES);
+
+  free(queueSrc);
+  free(queueDest);
+  free(queueWeight);
+  FreeDijkstraWorkspace(queueWorkspace);
+  FreeGraph(graphQueueTest);
+
+#endif
+
+#ifdef BIDIRECTIONAL_DIJKSTRA_TEST
+
+  printf("\n\nExecuting bidirectional Dijkstra test on a grid...\n");
+
+  Graph* graphGrid = BuildTestGrid(BIDIRECTIONAL_TEST_GRID_SIZE, true);
+  if (graphGrid == NULL) {
+    printf("Error building the grid.\n");
+    return 1;
+  }
+
+  DijkstraWorkspace* gridWorkspace =
+      CreateDijkstraWorkspace(graphGrid->indexCount);
+  if (gridWorkspace == NULL) {
+    printf("Error creating the workspace.\n");
+    return 1;
+  }
+
+  SearchTest gridTest = {graphGrid, gridWorkspace, NULL, NULL};
+  CompareSearches(&gridTest, ForwardSearch, "forward", BidirectionalSearch,
+                  "bidirectional", BIDIRECTIONAL_TEST_NUM_QUERIES);
+
+#ifdef ALT_TEST
+
+  printf("\n\nExecuting ALT test on the same grid...\n");
+
+  start = clock();
+  Landmarks* landmarks = SelectLandmarks(graphGrid, DEFAULT_NUM_LANDMARKS);
+  end = clock();
+  if (landmarks == NULL) {
+    printf("Error selecting the landmarks.\n");
+    return 1;
+  }
+  printf("CPU time used selecting landmarks: %f seconds\n",
+         ((double)(end - start)) / CLOCKS_PER_SEC);
+
+  // Landmarks are kept next to the saved graph, so they are only selected once
+  if (SaveLandmarks(landmarks, graphGrid, DEFAULT_LANDMARKS_FILE_NAME) !=
+      EXIT_SUCCESS) {
+    printf("Error saving the landmarks.\n");
+    return 1;
+  }
+  FreeLandmarks(landmarks);
+
+  landmarks = LoadLandmarks(graphGrid, DEFAULT_LANDMARKS_FILE_NAME);
+  if (landmarks == NULL) {
+    printf("Error loading the landmarks.\n");
+    return 1;
+  }
+
+  gridTest.landmarks = landmarks;
+  CompareSearches(&gridTest, ForwardSearch, "forward", AltSearch, "ALT",
+                  BIDIRECTIONAL_TEST_NUM_QUERIES);
+
+  FreeLandmarks(landmarks);
+
+#endif  // ALT_TEST
+
+  FreeDijkstraWorkspace(gridWorkspace);
+  FreeGraph(graphGrid);
+
+#endif
+
+#ifdef CONTRACTION_HIERARCHY_TEST
+
+  printf("\n\nExecuting contraction hierarchy test on a grid...\n");
+
+  Graph* graphRoads = BuildTestGrid(HIERARCHY_TEST_GRID_SIZE, false);
+  if (graphRoads == NULL) {
+    printf("Error building the grid.\n");
+    return 1;
+  }
+
+  start = clock();
+  ContractionHierarchy* hierarchy = BuildContractionHierarchy(graphRoads);
+  end = clock();
+  if (hierarchy == NULL) {
+    printf("Error building the hierarchy.\n");
+    return 1;
+  }
+  printf("CPU time used building the hierarchy: %f seconds\n",
+         ((double)(end - start)) / CLOCKS_PER_SEC);
+
+  // The hierarchy is saved next to its graph, and both are read back
+  if (SaveGraph(graphRoads, DEFAULT_HIERARCHY_GRAPH_FILE_NAME) !=
+          EXIT_SUCCESS ||
+      SaveContractionHierarchy(hierarchy, graphRoads,
+                               DEFAULT_HIERARCHY_FILE_NAME) != EXIT_SUCCESS) {
+    printf("Error saving the hierarchy.\n");
+    return 1;
+  }
+  FreeContractionHierarchy(hierarchy);
+  FreeGraph(graphRoads);
+
+  graphRoads = LoadGraph(DEFAULT_HIERARCHY_GRAPH_FILE_NAME);
+  if (graphRoads == NULL) {
+    printf("Error loading the graph.\n");
+    return 1;
+  }
+  hierarchy =
+      LoadContractionHierarchy(graphRoads, DEFAULT_HIERARCHY_FILE_NAME);
+  if (hierarchy == NULL) {
+    printf("Error loading the hierarchy.\n");
+    return 1;
+  }
+
+  DijkstraWorkspace* roadsWorkspace =
+      CreateDijkstraWorkspace(graphRoads->indexCount);
+  if (roadsWorkspace == NULL) {
+    printf("Error creating the workspace.\n");
+    return 1;
+  }
+
+  SearchTest roadsTest = {graphRoads, roadsWorkspace, NULL, hierarchy};
+  CompareSearches(&roadsTest, PlainSearch, "by DijkstraMinPath",
+                  HierarchySearch, "with the hierarchy",
+                  HIERARCHY_TEST_NUM_QUERIES);
+
+  FreeDijkstraWorkspace(roadsWorkspace);
+  FreeContractionHierarchy(hierarchy);
+  FreeGraph(graphRoads);
+
+#endif  // CONTRACTION_HIERARCHY_TEST
+
+#ifdef DELTA_STEPPING_TEST
+
+  printf("\n\nExecuting delta-stepping scaling test...\n");
+
+  unsigned int* deltaSrc;
+  unsigned int* deltaDest;
+  unsigned int* deltaWeight;
+  if (!FillRandomEdges(DELTA_STEPPING_TEST_NUM_EDGES,
+                       DELTA_STEPPING_TEST_NUM_VERTICES, &deltaSrc,
+                       &deltaDest, &deltaWeight)) {
+    printf("Error allocating the edges for testing.\n");
+    return 1;
+  }
+
+  Graph* graphDeltaTest =
+      BuildGraphFromEdges(deltaSrc, deltaDest, deltaWeight,
+                          DELTA_STEPPING_TEST_NUM_EDGES, BUILD_KEEP_MIN_WEIGHT);
+  if (graphDeltaTest == NULL) {
+    printf("Error building graph.\n");
+    return 1;
+  }
+
+  unsigned int* deltaDist = (unsigned int*)malloc(
+      graphDeltaTest->indexCount * sizeof(unsigned int));
+  unsigned int* deltaPrev = (unsigned int*)malloc(
+      graphDeltaTest->indexCount * sizeof(unsigned int));
+  DijkstraWorkspace* deltaWorkspace =
+      CreateDijkstraWorkspace(graphDeltaTest->indexCount);
+  if (deltaDist == NULL || deltaPrev == NULL || deltaWorkspace == NULL) {
+    printf("Error allocating the distances.\n");
+    return 1;
+  }
+
+  // The sequential search settles every vertex, leaving the whole tree
+  DijkstraOptions treeOptions = DefaultDijkstraOptions();
+  treeOptions.stopAtTarget = false;
+  unsigned int treeSum;
+  unsigned int* treePath;
+  unsigned int treePathLength;
+
+  start = clock();
+  DijkstraMinPathWithOptions(graphDeltaTest, deltaSrc[0], deltaSrc[0],
+                             &treeOptions, deltaWorkspace, &treeSum,
+                             &treePath, &treePathLength);
+  end = clock();
+  free(treePath);
+  printf("CPU time used by the sequential search: %f seconds\n",
+         ((double)(end - start)) / CLOCKS_PER_SEC);
+
+  // With MSVC clock measures elapsed time, so the speedup is real
+  clock_t oneThreadTime = 0;
+  for (unsigned int threads = 1;; threads *= 2) {
+    if (threads > GetThreadCount()) {
+      threads = GetThreadCount();
+    }
+
+    start = clock();
+    DeltaSteppingShortestPaths(graphDeltaTest, deltaSrc[0], DELTA_AUTO,
+                               threads, deltaDist, deltaPrev);
+    end = clock();
+    if (threads == 1) {
+      oneThreadTime = end - start;
+    }
+
+    unsigned int deltaMismatches = 0;
+    for (unsigned int v = 0; v < graphDeltaTest->indexCount; v++) {
+      unsigned int sequentialDist = IsVertexReached(deltaWorkspace, v)
+                                        ? deltaWorkspace->dist[v]
+                                        : UINT_MAX;
+      if (deltaDist[v] != sequentialDist) {
+        deltaMismatches++;
+      }
+    }
+
+    printf("%u threads: %f seconds, speedup %.2f, different distances %u\n",
+           threads, ((double)(end - start)) / CLOCKS_PER_SEC,
+           end > start ? (double)oneThreadTime / (end - start) : 1.0,
+           deltaMismatches);
+
+    if (threads == GetThreadCount()) {
+      break;
+    }
+  }
+
+  FreeDijkstraWorkspace(deltaWorkspace);
+  free(deltaDist);
+  free(deltaPrev);
+  FreeGraph(graphDeltaTest);
+  free(deltaSrc);
+  free(deltaDest);
+  free(deltaWeight);
+
+#endif  // DELTA_STEPPING_TEST
+
+#ifdef DISTANCE_MATRIX_TEST
+
+  printf("\n\nExecuting distance matrix test...\n");
+
+  unsigned int* matrixSrc;
+  unsigned int* matrixDest;
+  unsigned int* matrixWeight;
+  if (!FillRandomEdges(DISTANCE_MATRIX_TEST_NUM_EDGES,
+                       DISTANCE_MATRIX_TEST_NUM_VERTICES, &matrixSrc,
+                       &matrixDest, &matrixWeight)) {
+    printf("Error allocating the edges for testing.\n");
+    return 1;
+  }
+
+  Graph* graphMatrixTest =
+      BuildGraphFromEdges(matrixSrc, matrixDest, matrixWeight,
+                          DISTANCE_MATRIX_TEST_NUM_EDGES,
+                          BUILD_KEEP_MIN_WEIGHT);
+  if (graphMatrixTest == NULL) {
+    printf("Error building graph.\n");
+    return 1;
+  }
+
+  // Endpoints of edges always exist in the graph
+  unsigned int matrixSources[DISTANCE_MATRIX_TEST_NUM_SOURCES];
+  unsigned int matrixTargets[DISTANCE_MATRIX_TEST_NUM_TARGETS];
+  for (unsigned int i = 0; i < DISTANCE_MATRIX_TEST_NUM_SOURCES; i++) {
+    matrixSources[i] = matrixSrc[rand() % DISTANCE_MATRIX_TEST_NUM_EDGES];
+  }
+  for (unsigned int j = 0; j < DISTANCE_MATRIX_TEST_NUM_TARGETS; j++) {
+    matrixTargets[j] = matrixDest[rand() % DISTANCE_MATRIX_TEST_NUM_EDGES];
+  }
+
+  unsigned int* matrix = (unsigned int*)malloc(
+      DISTANCE_MATRIX_TEST_NUM_SOURCES * DISTANCE_MATRIX_TEST_NUM_TARGETS *
+      sizeof(unsigned int));
+  if (matrix == NULL) {
+    printf("Error allocating the distance matrix.\n");
+    return 1;
+  }
+
+  start = clock();
+  int matrixResult = DistanceMatrix(
+      graphMatrixTest, matrixSources, DISTANCE_MATRIX_TEST_NUM_SOURCES,
+      matrixTargets, DISTANCE_MATRIX_TEST_NUM_TARGETS, matrix);
+  end = clock();
+  if (matrixResult != SUCCESS_SEARCHING_PATH) {
+    printf("Error computing the distance matrix (%d).\n", matrixResult);
+    return 1;
+  }
+  printf("CPU time used by DistanceMatrix: %f seconds\n",
+         ((double)(end - start)) / CLOCKS_PER_SEC);
+
+  // One search per pair, as before the matrix existed
+  unsigned int matrixMismatches = 0;
+  start = clock();
+  for (unsigned int i = 0; i < DISTANCE_MATRIX_TEST_NUM_SOURCES; i++) {
+    for (unsigned int j = 0; j < DISTANCE_MATRIX_TEST_NUM_TARGETS; j++) {
+      unsigned int pairSum;
+      unsigned int* pairPath;
+      unsigned int pairPathLength;
+      DijkstraMinPath(graphMatrixTest, matrixSources[i], matrixTargets[j],
+                      &pairSum, &pairPath, &pairPathLength);
+      free(pairPath);
+      if (pairSum != matrix[i * DISTANCE_MATRIX_TEST_NUM_TARGETS + j]) {
+        matrixMismatches++;
+      }
+    }
+  }
+  end = clock();
+  printf("CPU time used by one DijkstraMinPath per pair: %f seconds\n",
+         ((double)(end - start)) / CLOCKS_PER_SEC);
+  printf("Different distances: %u\n", matrixMismatches);
+
+  free(matrix);
+  FreeGraph(graphMatrixTest);
+  free(matrixSrc);
+  free(matrixDest);
+  free(matrixWeight);
+
+#endif  // DISTANCE_MATRIX_TEST
+
+#ifdef NEAREST_FACILITY_TEST
+
+  printf("\n\nExecuting nearest facility test...\n");
+
+  unsigned int* facilitySrc;
+  unsigned int* facilityDest;
+  unsigned int* facilityWeight;
+  if (!FillRandomEdges(NEAREST_FACILITY_TEST_NUM_EDGES,
+                       NEAREST_FACILITY_TEST_NUM_VERTICES, &facilitySrc,
+                       &facilityDest, &facilityWeight)) {
+    printf("Error allocating the edges for testing.\n");
+    return 1;
+  }
+
+  Graph* graphFacilityTest =
+      BuildGraphFromEdges(facilitySrc, facilityDest, facilityWeight,
+                          NEAREST_FACILITY_TEST_NUM_EDGES,
+                          BUILD_KEEP_MIN_WEIGHT);
+  if (graphFacilityTest == NULL) {
+    printf("Error building graph.\n");
+    return 1;
+  }
+
+  unsigned int facilities[NEAREST_FACILITY_TEST_NUM_FACILITIES];
+  for (unsigned int i = 0; i < NEAREST_FACILITY_TEST_NUM_FACILITIES; i++) {
+    facilities[i] = facilitySrc[rand() % NEAREST_FACILITY_TEST_NUM_EDGES];
+  }
+
+  unsigned int numIndices = graphFacilityTest->indexCount;
+  unsigned int* facilityDist =
+      (unsigned int*)malloc(numIndices * sizeof(unsigned int));
+  unsigned int* facilityOwner =
+      (unsigned int*)malloc(numIndices * sizeof(unsigned int));
+  unsigned int* nearestDist = (unsigned int*)malloc(
+      (size_t)numIndices * NEAREST_FACILITY_TEST_K * sizeof(unsigned int));
+  unsigned int* nearestOwner = (unsigned int*)malloc(
+      (size_t)numIndices * NEAREST_FACILITY_TEST_K * sizeof(unsigned int));
+  unsigned int* closestDist =
+      (unsigned int*)malloc(numIndices * sizeof(unsigned int));
+  DijkstraWorkspace* facilityWorkspace =
+      CreateDijkstraWorkspace(numIndices);
+  if (facilityDist == NULL || facilityOwner == NULL || nearestDist == NULL ||
+      nearestOwner == NULL || closestDist == NULL ||
+      facilityWorkspace == NULL) {
+    printf("Error allocating the distances.\n");
+    return 1;
+  }
+
+  start = clock();
+  DijkstraMultiSource(graphFacilityTest, facilities,
+                      NEAREST_FACILITY_TEST_NUM_FACILITIES, facilityDist,
+                      facilityOwner);
+  end = clock();
+  printf("CPU time used by DijkstraMultiSource: %f seconds\n",
+         ((double)(end - start)) / CLOCKS_PER_SEC);
+
+  start = clock();
+  NearestFacilities(graphFacilityTest, facilities,
+                    NEAREST_FACILITY_TEST_NUM_FACILITIES,
+                    NEAREST_FACILITY_TEST_K, nearestDist, nearestOwner);
+  end = clock();
+  printf("CPU time used by NearestFacilities (k = %u): %f seconds\n",
+         NEAREST_FACILITY_TEST_K, ((double)(end - start)) / CLOCKS_PER_SEC);
+
+  // One full search per facility, as before the multi-source search existed
+  DijkstraOptions facilityOptions = DefaultDijkstraOptions();
+  facilityOptions.stopAtTarget = false;
+  for (unsigned int v = 0; v < numIndices; v++) {
+    closestDist[v] = UINT_MAX;
+  }
+
+  start = clock();
+  for (unsigned int i = 0; i < NEAREST_FACILITY_TEST_NUM_FACILITIES; i++) {
+    unsigned int facilitySum;
+    unsigned int* facilityPath;
+    unsigned int facilityPathLength;
+    DijkstraMinPathWithOptions(graphFacilityTest, facilities[i],
+                               facilities[i], &facilityOptions,
+                               facilityWorkspace, &facilitySum,
+                               &facilityPath, &facilityPathLength);
+    free(facilityPath);
+
+    for (unsigned int v = 0; v < numIndices; v++) {
+      if (IsVertexReached(facilityWorkspace, v) &&
+          facilityWorkspace->dist[v] < closestDist[v]) {
+        closestDist[v] = facilityWorkspace->dist[v];
+      }
+    }
+  }
+  end = clock();
+  printf("CPU time used by one search per facility: %f seconds\n",
+         ((double)(end - start)) / CLOCKS_PER_SEC);
+
+  unsigned int facilityMismatches = 0;
+  for (unsigned int v = 0; v < numIndices; v++) {
+    if (facilityDist[v] != closestDist[v] ||
+        nearestDist[(size_t)v * NEAREST_FACILITY_TEST_K] != closestDist[v]) {
+      facilityMismatches++;
+    }
+  }
+  printf("Different distances: %u\n", facilityMismatches);
+
+  FreeDijkstraWorkspace(facilityWorkspace);
+  free(facilityDist);
+  free(facilityOwner);
+  free(nearestDist);
+  free(nearestOwner);
+  free(closestDist);
+  FreeGraph(graphFacilityTest);
+  free(facilitySrc);
+  free(facilityDest);
+  free(facilityWeight);
+
+#endif  // NEAREST_FACILITY_TEST
+
+#ifdef DAG_MAX_PATH_TEST
+
+  printf("\n\nExecuting DAG longest path test...\n");
+
+  unsigned int* dagSrc;
+  unsigned int* dagDest;
+  unsigned int* dagWeight;
+  if (!FillRandomEdges(DAG_MAX_PATH_TEST_NUM_EDGES,
+                       DAG_MAX_PATH_TEST_NUM_VERTICES, &dagSrc, &dagDest,
+                       &dagWeight)) {
+    printf("Error allocating the edges for testing.\n");
+    return 1;
+  }
+
+  // A chain through every vertex, so the last one is reachable from 0, and
+  // random edges turned to point to a higher identifier
+  for (unsigned int i = 0; i < DAG_MAX_PATH_TEST_NUM_EDGES; i++) {
+    unsigned int a = i;
+    unsigned int b = i + 1;
+    if (i >= DAG_MAX_PATH_TEST_NUM_VERTICES - 1) {
+      a = dagSrc[i];
+      b = dagDest[i];
+      if (a == b) {
+        b = (a + 1) % DAG_MAX_PATH_TEST_NUM_VERTICES;
+      }
+    }
+    dagSrc[i] = a < b ? a : b;
+    dagDest[i] = a < b ? b : a;
+  }
+
+  Graph* graphDagTest =
+      BuildGraphFromEdges(dagSrc, dagDest, dagWeight,
+                          DAG_MAX_PATH_TEST_NUM_EDGES, BUILD_KEEP_MIN_WEIGHT);
+  if (graphDagTest == NULL) {
+    printf("Error building graph.\n");
+    return 1;
+  }
+
+  unsigned int dagMaxWeight;
+  unsigned int* dagPath;
+  unsigned int dagPathLength;
+
+  start = clock();
+  DijkstraMaxPath(graphDagTest, 0, DAG_MAX_PATH_TEST_NUM_VERTICES - 1,
+                  &dagMaxWeight, &dagPath, &dagPathLength);
+  end = clock();
+  free(dagPath);
+  printf("DijkstraMaxPath: weight %u, CPU time used: %f seconds\n",
+         dagMaxWeight, ((double)(end - start)) / CLOCKS_PER_SEC);
+
+  start = clock();
+  int dagResult =
+      DagMaxPath(graphDagTest, 0, DAG_MAX_PATH_TEST_NUM_VERTICES - 1,
+                 &dagMaxWeight, &dagPath, &dagPathLength);
+  end = clock();
+  if (dagResult != SUCCESS_SEARCHING_PATH) {
+    printf("Error searching the DAG (%d).\n", dagResult);
+    return 1;
+  }
+  free(dagPath);
+  printf("DagMaxPath: weight %u, %u vertices, CPU time used: %f seconds\n",
+         dagMaxWeight, dagPathLength,
+         ((double)(end - start)) / CLOCKS_PER_SEC);
+
+  FreeGraph(graphDagTest);
+
+  // On a small DAG, every path can be listed to check the exact maximum
+  for (unsigned int i = 0; i < DAG_MAX_PATH_TEST_SMALL_EDGES; i++) {
+    unsigned int a = i;
+    unsigned int b = i + 1;
+    if (i >= DAG_MAX_PATH_TEST_SMALL_VERTICES - 1) {
+      a = rand() % DAG_MAX_PATH_TEST_SMALL_VERTICES;
+      b = rand() % DAG_MAX_PATH_TEST_SMALL_VERTICES;
+      if (a == b) {
+        b = (a + 1) % DAG_MAX_PATH_TEST_SMALL_VERTICES;
+      }
+    }
+    dagSrc[i] = a < b ? a : b;
+    dagDest[i] = a < b ? b : a;
+    dagWeight[i] = rand() % 100 + 1;
+  }
+
+  Graph* graphSmallDag =
+      BuildGraphFromEdges(dagSrc, dagDest, dagWeight,
+                          DAG_MAX_PATH_TEST_SMALL_EDGES, BUILD_KEEP_MIN_WEIGHT);
+  if (graphSmallDag == NULL) {
+    printf("Error building graph.\n");
+    return 1;
+  }
+
+  unsigned int dagNumPaths;
+  PathNode* dagPaths =
+      FindAllPaths(graphSmallDag, 0, DAG_MAX_PATH_TEST_SMALL_VERTICES - 1,
+                   &dagNumPaths);
+  unsigned int dagBestSum = 0;
+  for (PathNode* node = dagPaths; node != NULL; node = node->next) {
+    unsigned int sum = CalculatePathSum(node);
+    if (sum > dagBestSum) {
+      dagBestSum = sum;
+    }
+  }
+  FreePaths(dagPaths);
+
+  DagMaxPath(graphSmallDag, 0, DAG_MAX_PATH_TEST_SMALL_VERTICES - 1,
+             &dagMaxWeight, &dagPath, &dagPathLength);
+  free(dagPath);
+  printf("Small DAG: %u paths, FindAllPaths maximum %u, DagMaxPath %u\n",
+         dagNumPaths, dagBestSum, dagMaxWeight);
+
+  FreeGraph(graphSmallDag);
+  free(dagSrc);
+  free(dagDest);
+  free(dagWeight);
+
+#endif  // DAG_MAX_PATH_TEST
+
+#ifdef SCC_TEST
+
+  printf("\n\nExecuting strongly connected components test...\n");
+
+  unsigned int* sccSrc;
+  unsigned int* sccDest;
+  unsigned int* sccWeight;
+  if (!FillRandomEdges(SCC_TEST_NUM_EDGES, SCC_TEST_NUM_VERTICES, &sccSrc,
+                       &sccDest, &sccWeight)) {
+    printf("Error allocating the edges for testing.\n");
+    return 1;
+  }
+
+  // A long cycle, far deeper than a recursive search could follow, among the
+  // random edges
+  for (unsigned int i = 0; i < SCC_TEST_CYCLE_LENGTH; i++) {
+    sccSrc[i] = i;
+    sccDest[i] = (i + 1) % SCC_TEST_CYCLE_LENGTH;
+  }
+
+  Graph* graphSccTest = BuildGraphFromEdges(
+      sccSrc, sccDest, sccWeight, SCC_TEST_NUM_EDGES, BUILD_KEEP_MIN_WEIGHT);
+  if (graphSccTest == NULL) {
+    printf("Error building graph.\n");
+    return 1;
+  }
+
+  start = clock();
+  Condensation* condensation = CondenseGraph(graphSccTest, 0);
+  end = clock();
+  if (condensation == NULL) {
+    printf("Error condensing the graph.\n");
+    return 1;
+  }
+
+  unsigned int largestComponent = 0;
+  for (unsigned int c = 0; c < condensation->numComponents; c++) {
+    unsigned int members =
+        condensation->memberOffsets[c + 1] - condensation->memberOffsets[c];
+    if (members > largestComponent) {
+      largestComponent = members;
+    }
+  }
+
+  printf("Vertices: %u, components: %u, largest: %u vertices\n",
+         graphSccTest->numVertices, condensation->numComponents,
+         largestComponent);
+  printf("Edges of the condensed graph: %u\n", condensation->numEdges);
+  printf("CPU time used by CondenseGraph: %f seconds\n",
+         ((double)(end - start)) / CLOCKS_PER_SEC);
+
+  FreeCondensation(condensation);
+  FreeGraph(graphSccTest);
+  free(sccSrc);
+  free(sccDest);
+  free(sccWeight);
+
+#endif  // SCC_TEST
+
+#ifdef BRANCH_BOUND_TEST
+
+  printf("\n\nExecuting branch and bound maximum path test...\n");
+
+  unsigned int bbSrc[BRANCH_BOUND_TEST_NUM_EDGES];
+  unsigned int bbDest[BRANCH_BOUND_TEST_NUM_EDGES];
+  unsigned int bbWeight[BRANCH_BOUND_TEST_NUM_EDGES];
+
+  // A dense graph full of cycles, with millions of simple paths between its
+  // first and last vertices
+  for (unsigned int i = 0; i < BRANCH_BOUND_TEST_NUM_EDGES; i++) {
+    bbSrc[i] = rand() % BRANCH_BOUND_TEST_NUM_VERTICES;
+    bbDest[i] = rand() % BRANCH_BOUND_TEST_NUM_VERTICES;
+    if (bbSrc[i] == bbDest[i]) {
+      bbDest[i] = (bbSrc[i] + 1) % BRANCH_BOUND_TEST_NUM_VERTICES;
+    }
+    bbWeight[i] = rand() % 100 + 1;
+  }
+
+  Graph* graphBranchTest =
+      BuildGraphFromEdges(bbSrc, bbDest, bbWeight, BRANCH_BOUND_TEST_NUM_EDGES,
+                          BUILD_KEEP_MIN_WEIGHT);
+  if (graphBranchTest == NULL) {
+    printf("Error building graph.\n");
+    return 1;
+  }
+
+  start = clock();
+  unsigned int bbNumPaths;
+  PathNode* bbPaths = FindAllPaths(
+      graphBranchTest, 0, BRANCH_BOUND_TEST_NUM_VERTICES - 1, &bbNumPaths);
+  unsigned int bbBestSum = 0;
+  for (PathNode* node = bbPaths; node != NULL; node = node->next) {
+    unsigned int sum = CalculatePathSum(node);
+    if (sum > bbBestSum) {
+      bbBestSum = sum;
+    }
+  }
+  FreePaths(bbPaths);
+  end = clock();
+  printf("FindAllPaths: %u paths, maximum %u, CPU time used: %f seconds\n",
+         bbNumPaths, bbBestSum, ((double)(end - start)) / CLOCKS_PER_SEC);
+
+  unsigned int bbMaxWeight;
+  unsigned int* bbPath;
+  unsigned int bbPathLength;
+
+  start = clock();
+  int bbResult = BranchAndBoundMaxPath(
+      graphBranchTest, 0, BRANCH_BOUND_TEST_NUM_VERTICES - 1, 0, &bbMaxWeight,
+      &bbPath, &bbPathLength);
+  end = clock();
+  if (bbResult != SUCCESS_SEARCHING_PATH) {
+    printf("Error searching the maximum path (%d).\n", bbResult);
+    return 1;
+  }
+  free(bbPath);
+  printf("BranchAndBoundMaxPath: weight %u, %u vertices, CPU time used: %f "
+         "seconds\n",
+         bbMaxWeight, bbPathLength, ((double)(end - start)) / CLOCKS_PER_SEC);
+
+  FreeGraph(graphBranchTest);
+
+#endif  // BRANCH_BOUND_TEST
+
+#ifdef HELD_KARP_TEST
+
+  printf("\n\nExecuting Held-Karp maximum path test...\n");
+
+  unsigned int hkSrc[HELD_KARP_TEST_NUM_EDGES];
+  unsigned int hkDest[HELD_KARP_TEST_NUM_EDGES];
+  unsigned int hkWeight[HELD_KARP_TEST_NUM_EDGES];
+
+  // Nearly every pair of vertices is joined, the worst case of a search over
+  // paths, while the dynamic programming only depends on the vertices
+  for (unsigned int i = 0; i < HELD_KARP_TEST_NUM_EDGES; i++) {
+    hkSrc[i] = rand() % HELD_KARP_TEST_NUM_VERTICES;
+    hkDest[i] = rand() % HELD_KARP_TEST_NUM_VERTICES;
+    if (hkSrc[i] == hkDest[i]) {
+      hkDest[i] = (hkSrc[i] + 1) % HELD_KARP_TEST_NUM_VERTICES;
+    }
+    hkWeight[i] = rand() % 100 + 1;
+  }
+
+  Graph* graphHeldKarpTest =
+      BuildGraphFromEdges(hkSrc, hkDest, hkWeight, HELD_KARP_TEST_NUM_EDGES,
+                          BUILD_KEEP_MIN_WEIGHT);
+  if (graphHeldKarpTest == NULL) {
+    printf("Error building graph.\n");
+    return 1;
+  }
+
+  unsigned int hkMaxWeight;
+  unsigned int* hkPath;
+  unsigned int hkPathLength;
+
+  start = clock();
+  int hkResult = HeldKarpMaxPath(
+      graphHeldKarpTest, 0, HELD_KARP_TEST_NUM_VERTICES - 1, 0, &hkMaxWeight,
+      &hkPath, &hkPathLength);
+  end = clock();
+  if (hkResult != SUCCESS_SEARCHING_PATH) {
+    printf("Error searching the maximum path (%d).\n", hkResult);
+    return 1;
+  }
+  free(hkPath);
+  printf("HeldKarpMaxPath: weight %u, %u vertices, CPU time used: %f "
+         "seconds\n",
+         hkMaxWeight, hkPathLength, ((double)(end - start)) / CLOCKS_PER_SEC);
+
+  start = clock();
+  hkResult = BranchAndBoundMaxPath(
+      graphHeldKarpTest, 0, HELD_KARP_TEST_NUM_VERTICES - 1, 0, &hkMaxWeight,
+      &hkPath, &hkPathLength);
+  end = clock();
+  if (hkResult != SUCCESS_SEARCHING_PATH) {
+    printf("Error searching the maximum path (%d).\n", hkResult);
+    return 1;
+  }
+  free(hkPath);
+  printf("BranchAndBoundMaxPath: weight %u, %u vertices, CPU time used: %f "
+         "seconds\n",
+         hkMaxWeight, hkPathLength, ((double)(end - start)) / CLOCKS_PER_SEC);
+
+  FreeGraph(graphHeldKarpTest);
+
+#endif  // HELD_KARP_TEST
+
+#ifdef PARALLEL_SEARCH_TEST
+
+  printf("\n\nExecuting parallel path search test...\n");
+
+  unsigned int psSrc[PARALLEL_SEARCH_TEST_NUM_EDGES];
+  unsigned int psDest[PARALLEL_SEARCH_TEST_NUM_EDGES];
+  unsigned int psWeight[PARALLEL_SEARCH_TEST_NUM_EDGES];
+
+  for (unsigned int i = 0; i < PARALLEL_SEARCH_TEST_NUM_EDGES; i++) {
+    psSrc[i] = rand() % PARALLEL_SEARCH_TEST_NUM_VERTICES;
+    psDest[i] = rand() % PARALLEL_SEARCH_TEST_NUM_VERTICES;
+    if (psSrc[i] == psDest[i]) {
+      psDest[i] = (psSrc[i] + 1) % PARALLEL_SEARCH_TEST_NUM_VERTICES;
+    }
+    psWeight[i] = rand() % 100 + 1;
+  }
+
+  Graph* graphParallelTest = BuildGraphFromEdges(
+      psSrc, psDest, psWeight, PARALLEL_SEARCH_TEST_NUM_EDGES,
+      BUILD_KEEP_MIN_WEIGHT);
+  if (graphParallelTest == NULL) {
+    printf("Error building graph.\n");
+    return 1;
+  }
+
+  // With MSVC clock measures elapsed time, so the speedup is real
+  start = clock();
+  unsigned int psNumPaths;
+  PathNode* psPaths = FindAllPaths(
+      graphParallelTest, 0, PARALLEL_SEARCH_TEST_NUM_VERTICES - 1, &psNumPaths);
+  printf("FindAllPaths: %u paths, time used: %f seconds\n", psNumPaths,
+         ((double)(clock() - start)) / CLOCKS_PER_SEC);
+
+  start = clock();
+  unsigned int psNumParallelPaths;
+  PathNode* psParallelPaths = FindAllPathsParallel(
+      graphParallelTest, 0, PARALLEL_SEARCH_TEST_NUM_VERTICES - 1, 0,
+      &psNumParallelPaths);
+  printf("FindAllPathsParallel on %u threads: %u paths, time used: %f "
+         "seconds\n",
+         GetThreadCount(), psNumParallelPaths,
+         ((double)(clock() - start)) / CLOCKS_PER_SEC);
+
+  // Both lists hold the same paths in the same order
+  bool psSameOrder = psNumPaths == psNumParallelPaths;
+  const PathNode* psNode = psPaths;
+  const PathNode* psParallelNode = psParallelPaths;
+  for (; psSameOrder && psNode != NULL;
+       psNode = psNode->next, psParallelNode = psParallelNode->next) {
+    psSameOrder = psNode->length == psParallelNode->length &&
+                  memcmp(psNode->vertices, psParallelNode->vertices,
+                         psNode->length * sizeof(unsigned int)) == 0;
+  }
+  printf("Same paths in the same order: %s\n", psSameOrder ? "yes" : "no");
+  FreePaths(psPaths);
+  FreePaths(psParallelPaths);
+
+  unsigned int psMaxWeight;
+  unsigned int* psPath;
+  unsigned int psPathLength;
+
+  start = clock();
+  BranchAndBoundMaxPath(graphParallelTest, 0,
+                        PARALLEL_SEARCH_TEST_NUM_VERTICES - 1, 1, &psMaxWeight,
+                        &psPath, &psPathLength);
+  free(psPath);
+  printf("BranchAndBoundMaxPath on 1 thread: weight %u, time used: %f "
+         "seconds\n",
+         psMaxWeight, ((double)(clock() - start)) / CLOCKS_PER_SEC);
+
+  start = clock();
+  BranchAndBoundMaxPath(graphParallelTest, 0,
+                        PARALLEL_SEARCH_TEST_NUM_VERTICES - 1, 0, &psMaxWeight,
+                        &psPath, &psPathLength);
+  free(psPath);
+  printf("BranchAndBoundMaxPath on %u threads: weight %u, time used: %f "
+         "seconds\n",
+         GetThreadCount(), psMaxWeight,
+         ((double)(clock() - start)) / CLOCKS_PER_SEC);
+
+  FreeGraph(graphParallelTest);
+
+#endif  // PARALLEL_SEARCH_TEST
+
   return 0;
 }
@@ -0,0 +1,602 @@
+/**
+
+    @file      branch-bound.c
+    @brief     Function implementations for the exact search of the simple
+               path with maximum weight, by branch and bound.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#include "branch-bound.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parallel.h"
+#include "path-subgraph.h"
+#include "search.h"
+#include "vertices.h"
+
+#define SPLIT_STRIDE (SEARCH_MAX_SPLIT_DEPTH + 1)  // Vertices per prefix
+
+/**
+    @struct BranchSearch
+    @brief State of a depth first search over a PathSubgraph.
+**/
+typedef struct BranchSearch {
+  bool* visited;            // Vertices on the current path
+  unsigned int* path;       // Current path, by local index
+  uint64_t* pathSum;        // Weight of the current path up to each depth
+  unsigned int* next;       // Next edge to be tried at each depth
+  uint64_t total;           // Sum of bestIn over every vertex
+  uint64_t remaining;       // Sum of bestIn over the unvisited vertices
+  unsigned int* stamp;      // Mark of the last bound which reached a vertex
+  unsigned int stampValue;  // Mark of the current bound
+  unsigned int* queue;      // Queue of the search of the bound
+  unsigned int* inBest;     // Heaviest edge into each vertex in the bound
+  bool found;               // True once a path was found
+  uint64_t best;            // Weight of the best path found
+  unsigned int* bestPath;   // Best path found, by local index
+  unsigned int bestLength;  // Number of vertices of the best path
+  unsigned int bestItem;    // Subtree in which the best path was found
+  volatile uint64_t* shared;  // Weight plus 1 of the best path of any
+                              // search, 0 if none
+} BranchSearch;
+
+/**
+    @struct BranchSplit
+    @brief Path prefixes from the source which split the search into
+           subtrees, in the order a depth first search reaches them.
+**/
+typedef struct BranchSplit {
+  unsigned int count;      // Number of prefixes
+  unsigned int* vertices;  // Local indices, SPLIT_STRIDE per prefix
+  uint64_t* sums;          // Weight of each prefix up to each vertex
+  unsigned int* length;    // Number of vertices of each prefix
+} BranchSplit;
+
+/**
+    @struct ParallelBranch
+    @brief State shared by the tasks searching the subtrees of a split.
+**/
+typedef struct ParallelBranch {
+  const PathSubgraph* subgraph;
+  const BranchSplit* split;
+  BranchSearch tasks[MAX_THREADS];  // State of each task, arrays NULL until
+                                    // used
+  bool failed[MAX_THREADS];         // True if a task ran out of memory
+  volatile uint64_t shared;         // Best path of every task, as in
+                                    // BranchSearch
+} ParallelBranch;
+
+/**
+    @brief Bounds the weight still to be gained by a path which has just
+           entered a vertex, given the vertices already on it.
+
+    @details Every vertex reachable from u through unvisited vertices may be
+             entered once, by an edge from another of them or from u. The
+             heaviest such edge of each one is added up, which is never less
+             than the weight of the rest of any path. The same holds for the
+             heaviest edge leaving u and each of them.
+    @param subgraph Pointer to the subgraph.
+    @param search Pointer to the search state, with u already visited.
+    @param u Local index of the vertex just entered.
+    @param bound Pointer to store the bound.
+    @return True if the destination is still reachable from u.
+**/
+static bool BoundFrom(const PathSubgraph* subgraph, BranchSearch* search,
+                      unsigned int u, uint64_t* bound) {
+  if (++search->stampValue == 0) {
+    memset(search->stamp, 0, subgraph->numVertices * sizeof(unsigned int));
+    search->stampValue = 1;
+  }
+  unsigned int mark = search->stampValue;
+
+  unsigned int head = 0;
+  unsigned int tail = 0;
+  search->queue[tail++] = u;
+  search->stamp[u] = mark;
+
+  // Each vertex but the destination is also left once, so the heaviest edge
+  // out of each one gives a second bound, and the lower of both is kept
+  uint64_t outSum = 0;
+  while (head < tail) {
+    unsigned int x = search->queue[head++];
+    bool left = false;
+    unsigned int end = subgraph->offsets[x + 1];
+    for (unsigned int e = subgraph->offsets[x]; e < end; e++) {
+      unsigned int v = subgraph->edges[e].vertex;
+      unsigned int weight = subgraph->edges[e].weight;
+      if (search->visited[v]) {
+        continue;
+      }
+      if (!left) {
+        // Edges are sorted, so the first one to an unvisited vertex is the
+        // heaviest
+        outSum += weight;
+        left = true;
+      }
+      if (search->stamp[v] != mark) {
+        search->stamp[v] = mark;
+        search->inBest[v] = weight;
+        search->queue[tail++] = v;
+      } else if (weight > search->inBest[v]) {
+        search->inBest[v] = weight;
+      }
+    }
+  }
+
+  uint64_t inSum = 0;
+  for (unsigned int i = 1; i < tail; i++) {
+    inSum += search->inBest[search->queue[i]];
+  }
+  *bound = inSum < outSum ? inSum : outSum;
+
+  return search->stamp[subgraph->dest] == mark;
+}
+
+/**
+    @brief Checks if a path whose weight is at most a bound cannot beat the
+           best path found.
+
+    @details The best path of other tasks only prunes paths which are
+             lighter, so the first of several heaviest paths is always found
+             and the result does not depend on the number of threads.
+    @param search Pointer to the search state.
+    @param bound Upper bound of the weight of the path.
+    @return True if the path can be skipped.
+**/
+static bool CannotImprove(const BranchSearch* search, uint64_t bound) {
+  if (search->found && bound <= search->best) {
+    return true;
+  }
+  uint64_t shared = AtomicLoad64(search->shared);
+  return shared != 0 && bound + 1 < shared;
+}
+
+/**
+    @brief Keeps a path to the destination as the best one, and publishes its
+           weight to the other tasks.
+    @param search Pointer to the search state, with the path up to depth.
+    @param depth Number of vertices of the path before the destination.
+    @param dest Local index of the destination vertex.
+    @param sum Weight of the path.
+    @param item Subtree in which the path was found.
+**/
+static void RecordPath(BranchSearch* search, unsigned int depth,
+                       unsigned int dest, uint64_t sum, unsigned int item) {
+  search->found = true;
+  search->best = sum;
+  memcpy(search->bestPath, search->path, depth * sizeof(unsigned int));
+  search->bestPath[depth] = dest;
+  search->bestLength = depth + 1;
+  search->bestItem = item;
+
+  uint64_t current = AtomicLoad64(search->shared);
+  while (current < sum + 1 &&
+         !CompareExchange64(search->shared, current, sum + 1)) {
+    current = AtomicLoad64(search->shared);
+  }
+}
+
+/**
+    @brief Runs the depth first search below a prefix, keeping the best path
+           to the destination.
+    @param subgraph Pointer to the subgraph.
+    @param search Pointer to the search state, with nothing visited.
+    @param prefix Local indices of the prefix, starting at the source.
+    @param sums Weight of the prefix up to each of its vertices.
+    @param length Number of vertices of the prefix.
+    @param item Number of the subtree.
+**/
+static void SearchBranches(const PathSubgraph* subgraph, BranchSearch* search,
+                           const unsigned int* prefix, const uint64_t* sums,
+                           unsigned int length, unsigned int item) {
+  // The prefix is walked already, the search goes on from its last vertex
+  search->remaining = search->total;
+  for (unsigned int i = 0; i < length; i++) {
+    search->visited[prefix[i]] = true;
+    search->remaining -= subgraph->bestIn[prefix[i]];
+    search->path[i] = prefix[i];
+    search->pathSum[i] = sums[i];
+  }
+
+  unsigned int last = prefix[length - 1];
+  if (last == subgraph->dest) {
+    if (!search->found || sums[length - 1] > search->best) {
+      RecordPath(search, length - 1, last, sums[length - 1], item);
+    }
+    search->visited[last] = false;
+  }
+
+  unsigned int depth = length;
+  search->next[depth - 1] = subgraph->offsets[last];
+  while (depth >= length && last != subgraph->dest) {
+    unsigned int u = search->path[depth - 1];
+    if (search->next[depth - 1] == subgraph->offsets[u + 1]) {
+      // Every edge of u was tried, so it leaves the path
+      search->visited[u] = false;
+      search->remaining += subgraph->bestIn[u];
+      depth--;
+      continue;
+    }
+
+    PathEdge edge = subgraph->edges[search->next[depth - 1]++];
+    unsigned int v = edge.vertex;
+    if (search->visited[v]) {
+      continue;
+    }
+
+    uint64_t sum = search->pathSum[depth - 1] + edge.weight;
+    if (v == subgraph->dest) {
+      if (!search->found || sum > search->best) {
+        RecordPath(search, depth, v, sum, item);
+      }
+      continue;
+    }
+
+    // Cheap bound first, over every unvisited vertex but v
+    if (CannotImprove(search, sum + search->remaining - subgraph->bestIn[v])) {
+      continue;
+    }
+
+    search->visited[v] = true;
+    search->remaining -= subgraph->bestIn[v];
+
+    uint64_t bound;
+    if (!BoundFrom(subgraph, search, v, &bound) ||
+        CannotImprove(search, sum + bound)) {
+      search->visited[v] = false;
+      search->remaining += subgraph->bestIn[v];
+      continue;
+    }
+
+    search->path[depth] = v;
+    search->pathSum[depth] = sum;
+    search->next[depth] = subgraph->offsets[v];
+    depth++;
+  }
+
+  for (unsigned int i = 0; i + 1 < length; i++) {
+    search->visited[prefix[i]] = false;
+  }
+}
+
+/**
+    @brief Frees the arrays of a search state.
+    @param search Pointer to the search state.
+**/
+static void FreeBranchSearch(BranchSearch* search) {
+  free(search->visited);
+  free(search->path);
+  free(search->pathSum);
+  free(search->next);
+  free(search->stamp);
+  free(search->queue);
+  free(search->inBest);
+  free(search->bestPath);
+}
+
+/**
+    @brief Allocates the arrays of a search state over a subgraph.
+    @param search Pointer to the search state.
+    @param subgraph Pointer to the subgraph.
+    @param shared Pointer to the weight plus 1 of the best path of any search.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool InitBranchSearch(BranchSearch* search,
+                             const PathSubgraph* subgraph,
+                             volatile uint64_t* shared) {
+  unsigned int n = subgraph->numVertices;
+  memset(search, 0, sizeof(BranchSearch));
+  search->visited = (bool*)calloc(n, sizeof(bool));
+  search->path = (unsigned int*)malloc(n * sizeof(unsigned int));
+  search->pathSum = (uint64_t*)malloc(n * sizeof(uint64_t));
+  search->next = (unsigned int*)malloc(n * sizeof(unsigned int));
+  search->stamp = (unsigned int*)calloc(n, sizeof(unsigned int));
+  search->queue = (unsigned int*)malloc(n * sizeof(unsigned int));
+  search->inBest = (unsigned int*)malloc(n * sizeof(unsigned int));
+  search->bestPath = (unsigned int*)malloc(n * sizeof(unsigned int));
+  if (search->visited == NULL || search->path == NULL ||
+      search->pathSum == NULL || search->next == NULL ||
+      search->stamp == NULL || search->queue == NULL ||
+      search->inBest == NULL || search->bestPath == NULL) {
+    FreeBranchSearch(search);
+    memset(search, 0, sizeof(BranchSearch));
+    return false;
+  }
+
+  for (unsigned int v = 0; v < n; v++) {
+    search->total += subgraph->bestIn[v];
+  }
+  search->shared = shared;
+  return true;
+}
+
+/**
+    @brief Frees the arrays of a split.
+    @param split Pointer to the split.
+**/
+static void FreeBranchSplit(BranchSplit* split) {
+  free(split->vertices);
+  free(split->sums);
+  free(split->length);
+}
+
+/**
+    @brief Checks if a vertex is already on a prefix.
+    @param prefix Local indices of the prefix.
+    @param length Number of vertices of the prefix.
+    @param vertex Local index of the vertex.
+    @return True if the vertex is on the prefix.
+**/
+static bool IsOnPrefix(const unsigned int* prefix, unsigned int length,
+                       unsigned int vertex) {
+  for (unsigned int i = 0; i < length; i++) {
+    if (prefix[i] == vertex) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+    @brief Splits the search into subtrees, extending every prefix by one
+           edge at a time until there are enough of them. Prefixes which
+           reach the destination are kept as they are, and the ones with no
+           way on are dropped.
+    @param subgraph Pointer to the subgraph.
+    @param target Number of prefixes wanted, 1 to keep the whole search.
+    @param split Pointer to the split to be filled.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool SplitBranches(const PathSubgraph* subgraph, unsigned int target,
+                          BranchSplit* split) {
+  split->count = 1;
+  split->vertices = (unsigned int*)malloc(SPLIT_STRIDE * sizeof(unsigned int));
+  split->sums = (uint64_t*)malloc(SPLIT_STRIDE * sizeof(uint64_t));
+  split->length = (unsigned int*)malloc(sizeof(unsigned int));
+  if (split->vertices == NULL || split->sums == NULL ||
+      split->length == NULL) {
+    FreeBranchSplit(split);
+    return false;
+  }
+  split->vertices[0] = subgraph->src;
+  split->sums[0] = 0;
+  split->length[0] = 1;
+
+  // Every open prefix has depth vertices, as they grow together
+  for (unsigned int depth = 1; depth < SPLIT_STRIDE; depth++) {
+    if (split->count >= target) {
+      break;
+    }
+
+    // Count the prefixes of the next level first, to allocate them at once
+    size_t count = 0;
+    bool open = false;
+    for (unsigned int p = 0; p < split->count; p++) {
+      const unsigned int* prefix = split->vertices + (size_t)p * SPLIT_STRIDE;
+      unsigned int last = prefix[split->length[p] - 1];
+      if (last == subgraph->dest) {
+        count++;
+        continue;
+      }
+
+      open = true;
+      for (unsigned int e = subgraph->offsets[last];
+           e < subgraph->offsets[last + 1]; e++) {
+        if (!IsOnPrefix(prefix, depth, subgraph->edges[e].vertex)) {
+          count++;
+        }
+      }
+    }
+    if (!open || count > SEARCH_MAX_SUBTREES) {
+      break;
+    }
+
+    size_t size = count > 0 ? count : 1;
+    BranchSplit next = {(unsigned int)count, NULL, NULL, NULL};
+    next.vertices =
+        (unsigned int*)malloc(size * SPLIT_STRIDE * sizeof(unsigned int));
+    next.sums = (uint64_t*)malloc(size * SPLIT_STRIDE * sizeof(uint64_t));
+    next.length = (unsigned int*)malloc(size * sizeof(unsigned int));
+    if (next.vertices == NULL || next.sums == NULL || next.length == NULL) {
+      FreeBranchSplit(&next);
+      FreeBranchSplit(split);
+      return false;
+    }
+
+    // Children replace their prefix in edge order, so the order of a single
+    // search is kept
+    unsigned int position = 0;
+    for (unsigned int p = 0; p < split->count; p++) {
+      const unsigned int* prefix = split->vertices + (size_t)p * SPLIT_STRIDE;
+      const uint64_t* sums = split->sums + (size_t)p * SPLIT_STRIDE;
+      unsigned int length = split->length[p];
+      unsigned int last = prefix[length - 1];
+
+      if (last == subgraph->dest) {
+        memcpy(next.vertices + (size_t)position * SPLIT_STRIDE, prefix,
+               length * sizeof(unsigned int));
+        memcpy(next.sums + (size_t)position * SPLIT_STRIDE, sums,
+               length * sizeof(uint64_t));
+        next.length[position++] = length;
+        continue;
+      }
+
+      for (unsigned int e = subgraph->offsets[last];
+           e < subgraph->offsets[last + 1]; e++) {
+        unsigned int v = subgraph->edges[e].vertex;
+        if (IsOnPrefix(prefix, depth, v)) {
+          continue;
+        }
+        unsigned int* child = next.vertices + (size_t)position * SPLIT_STRIDE;
+        uint64_t* childSums = next.sums + (size_t)position * SPLIT_STRIDE;
+        memcpy(child, prefix, depth * sizeof(unsigned int));
+        memcpy(childSums, sums, depth * sizeof(uint64_t));
+        child[depth] = v;
+        childSums[depth] = sums[depth - 1] + subgraph->edges[e].weight;
+        next.length[position++] = depth + 1;
+      }
+    }
+
+    FreeBranchSplit(split);
+    *split = next;
+  }
+
+  return true;
+}
+
+/**
+    @brief Searches one subtree of the split, with the state owned by the
+           task running it.
+    @param context Pointer to the ParallelBranch.
+    @param task Number of the task running the subtree.
+    @param item Number of the subtree.
+**/
+static void SearchSubtreeTask(void* context, unsigned int task,
+                              unsigned int item) {
+  ParallelBranch* branch = (ParallelBranch*)context;
+  BranchSearch* search = &branch->tasks[task];
+  if (search->visited == NULL &&
+      !InitBranchSearch(search, branch->subgraph, &branch->shared)) {
+    branch->failed[task] = true;
+    return;
+  }
+
+  const BranchSplit* split = branch->split;
+  SearchBranches(branch->subgraph, search,
+                 split->vertices + (size_t)item * SPLIT_STRIDE,
+                 split->sums + (size_t)item * SPLIT_STRIDE,
+                 split->length[item], item);
+}
+
+/**
+    @brief Finds the simple path with maximum weight between two vertices of
+           any graph, cycles included, by a depth first search which skips
+           every branch that cannot beat the best path found so far.
+
+    @details Only the vertices reachable from src which can also reach dest
+             are searched, and their edges are tried heaviest first, so a
+             good path is found early. Each vertex still to be entered adds
+             at most the heaviest edge into it, which bounds the weight left.
+             When that bound is not enough, a search over the unvisited
+             vertices bounds it by the vertices still reachable, using only
+             edges from them, and also drops branches which can no longer
+             reach dest. The result is the one of FindAllPaths followed by
+             CalculatePathSum on every path, but the search tree explored is
+             usually smaller by orders of magnitude. The worst case remains
+             exponential.
+
+             With several threads, the search is split into the subtrees
+             below short path prefixes, which the threads take in turn with
+             their own state. The weight of the best path found is shared to
+             prune every subtree, and among paths of the same weight the one
+             a single search finds first is kept.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param numThreads Number of threads, or 0 for GetThreadCount.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices with maximum weight, NULL if
+                there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int BranchAndBoundMaxPath(const Graph* graph, unsigned int src,
+                          unsigned int dest, unsigned int numThreads,
+                          unsigned int* maxWeight, unsigned int** path,
+                          unsigned int* pathLength) {
+  *maxWeight = 0;
+  *path = NULL;
+  *pathLength = 0;
+
+  if (graph == NULL) {
+    return INVALID_GRAPH;
+  }
+
+  const Vertex* srcVertex = FindVertex(graph, src);
+  const Vertex* destVertex = FindVertex(graph, dest);
+  if (srcVertex == NULL || destVertex == NULL) {
+    return VERTEX_DOES_NOT_EXIST;
+  }
+
+  if (src == dest) {
+    *path = (unsigned int*)malloc(sizeof(unsigned int));
+    if (*path == NULL) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
+    (*path)[0] = src;
+    *pathLength = 1;
+    return SUCCESS_SEARCHING_PATH;
+  }
+
+  if (numThreads == 0 || numThreads > MAX_THREADS) {
+    numThreads = numThreads == 0 ? GetThreadCount() : MAX_THREADS;
+  }
+
+  PathSubgraph subgraph;
+  if (!BuildPathSubgraph(graph, srcVertex->index, destVertex->index,
+                         &subgraph)) {
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+  if (subgraph.numVertices == 0) {
+    return SUCCESS_SEARCHING_PATH;
+  }
+
+  BranchSplit split;
+  unsigned int target =
+      numThreads == 1 ? 1 : numThreads * SEARCH_SUBTREES_PER_THREAD;
+  if (!SplitBranches(&subgraph, target, &split)) {
+    FreePathSubgraph(&subgraph);
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+
+  ParallelBranch branch;
+  memset(&branch, 0, sizeof(ParallelBranch));
+  branch.subgraph = &subgraph;
+  branch.split = &split;
+  ParallelForItems(split.count, numThreads, SearchSubtreeTask, &branch);
+
+  // The heaviest path wins, and among equal ones the first subtree
+  int result = SUCCESS_SEARCHING_PATH;
+  const BranchSearch* best = NULL;
+  for (unsigned int t = 0; t < MAX_THREADS; t++) {
+    const BranchSearch* search = &branch.tasks[t];
+    if (branch.failed[t]) {
+      result = FAILURE_ALLOCATING_SEARCH;
+    }
+    if (search->found &&
+        (best == NULL || search->best > best->best ||
+         (search->best == best->best && search->bestItem < best->bestItem))) {
+      best = search;
+    }
+  }
+
+  if (result == SUCCESS_SEARCHING_PATH && best != NULL) {
+    *path = (unsigned int*)malloc(best->bestLength * sizeof(unsigned int));
+    if (*path == NULL) {
+      result = FAILURE_ALLOCATING_SEARCH;
+    } else {
+      for (unsigned int i = 0; i < best->bestLength; i++) {
+        (*path)[i] = subgraph.ids[best->bestPath[i]];
+      }
+      *pathLength = best->bestLength;
+      *maxWeight = (unsigned int)best->best;
+    }
+  }
+
+  for (unsigned int t = 0; t < MAX_THREADS; t++) {
+    FreeBranchSearch(&branch.tasks[t]);
+  }
+  FreeBranchSplit(&split);
+  FreePathSubgraph(&subgraph);
+
+  return result;
+}
@@ -0,0 +1,55 @@
+/**
+
+    @file      branch-bound.h
+    @brief     Function definitions for the exact search of the simple path
+               with maximum weight, by branch and bound.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef BRANCH_BOUND_H
+#define BRANCH_BOUND_H
+
+#include "graph.h"
+
+/**
+    @brief Finds the simple path with maximum weight between two vertices of
+           any graph, cycles included, by a depth first search which skips
+           every branch that cannot beat the best path found so far.
+
+    @details Only the vertices reachable from src which can also reach dest
+             are searched, and their edges are tried heaviest first, so a
+             good path is found early. Each vertex still to be entered adds
+             at most the heaviest edge into it, which bounds the weight left.
+             When that bound is not enough, a search over the unvisited
+             vertices bounds it by the vertices still reachable, using only
+             edges from them, and also drops branches which can no longer
+             reach dest. The result is the one of FindAllPaths followed by
+             CalculatePathSum on every path, but the search tree explored is
+             usually smaller by orders of magnitude. The worst case remains
+             exponential.
+
+             With several threads, the search is split into the subtrees
+             below short path prefixes, which the threads take in turn with
+             their own state. The weight of the best path found is shared to
+             prune every subtree, and among paths of the same weight the one
+             a single search finds first is kept.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param numThreads Number of threads, or 0 for GetThreadCount.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices with maximum weight, NULL if
+                there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int BranchAndBoundMaxPath(const Graph* graph, unsigned int src,
+                          unsigned int dest, unsigned int numThreads,
+                          unsigned int* maxWeight, unsigned int** path,
+                          unsigned int* pathLength);
+
+#endif  // !BRANCH_BOUND_H
@@ -0,0 +1,41 @@
+/**
+ *  @file      build-graph.h
+ *  @brief     Function definitions for building a graph in bulk from an
+ *             array of edges.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef BUILD_GRAPH_H
+#define BUILD_GRAPH_H
+
+#include "graph.h"
+
+// Weight kept when the same edge is given more than once
+#define BUILD_KEEP_FIRST_WEIGHT 0x0  // The weight given first
+#define BUILD_KEEP_MIN_WEIGHT 0x1    // The lowest weight
+#define BUILD_KEEP_MAX_WEIGHT 0x2    // The highest weight
+
+#define BUILD_TRACK_IN_EDGES 0x4  // Track incoming edges, see EnableInEdgeIndex
+
+/**
+ *  @brief  Builds a graph from an array of edges. The edges are radix sorted
+ *          in parallel, duplicates are removed in a single pass, and the
+ *          vertex table and adjacency storage are allocated once, at their
+ *          final size. Much faster than adding the edges one at a time.
+ *  @param  src      - The identifier of the source of every edge.
+ *  @param  dest     - The identifier of the destination of every edge.
+ *  @param  weight   - The weight of every edge, or NULL for a weight of 1.
+ *  @param  numEdges - The number of edges.
+ *  @param  flags    - One of the BUILD_KEEP_* weights for duplicate edges,
+ *                     optionally combined with BUILD_TRACK_IN_EDGES.
+ *  @retval          - A pointer to the new graph, with one vertex for every
+ *                     identifier found in src or dest.
+ *  @retval          - NULL if src or dest are NULL or memory allocation
+ *                     fails.
+ */
+Graph* BuildGraphFromEdges(const unsigned int* src, const unsigned int* dest,
+                           const unsigned int* weight, unsigned int numEdges,
+                           unsigned int flags);
+
+#endif  // !BUILD_GRAPH_H
@@ -0,0 +1,247 @@
+/**
+ *
+ *  @file      compressed-graph.c
+ *  @brief     Function implementations for building and querying read-only
+ *             snapshots of a graph with delta and variable-byte encoded
+ *             adjacency.
+ *  @details   The graph is first frozen, which numbers the vertices by
+ *             identifier and gathers the edges of every vertex. Each range of
+ *             edges is then sorted by destination and encoded, after
+ *             measuring the encoded size so the data is allocated once.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "compressed-graph.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ *  @brief  Comparison function used to sort edges packed with the
+ *          destination in the high half.
+ *  @param  a - Pointer to the first edge.
+ *  @param  b - Pointer to the second edge.
+ *  @retval   - Negative, zero or positive as in qsort.
+ */
+static int ComparePackedEdges(const void* a, const void* b) {
+  uint64_t x = *(const uint64_t*)a;
+  uint64_t y = *(const uint64_t*)b;
+  return (x > y) - (x < y);
+}
+
+/**
+ *  @brief  Gets the number of bytes of a variable-byte number.
+ *  @param  value - The number to be encoded.
+ *  @retval       - The number of bytes, from 1 to 5.
+ */
+static size_t VarintSize(unsigned int value) {
+  size_t size = 1;
+  while (value >= 0x80) {
+    value >>= 7;
+    size++;
+  }
+  return size;
+}
+
+/**
+ *  @brief  Encodes a variable-byte number.
+ *  @param  data  - Where the number is written.
+ *  @param  value - The number to be encoded.
+ *  @retval       - The byte following the number.
+ */
+static unsigned char* EncodeVarint(unsigned char* data, unsigned int value) {
+  while (value >= 0x80) {
+    *data++ = (unsigned char)(value | 0x80);
+    value >>= 7;
+  }
+  *data++ = (unsigned char)value;
+  return data;
+}
+
+/**
+ *  @brief  Gets the encoded difference between a destination and the
+ *          previous one, or the vertex itself for the first edge.
+ *  @param  dest     - The destination of the edge.
+ *  @param  previous - The previous destination, or the vertex.
+ *  @param  first    - True for the first edge of the vertex.
+ *  @retval          - The number to be encoded.
+ */
+static unsigned int EncodeDelta(unsigned int dest, unsigned int previous,
+                                bool first) {
+  unsigned int delta = dest - previous;
+  if (first) {
+    // Zigzag, so small differences in both directions stay small
+    delta = (delta << 1) ^ (0u - (delta >> 31));
+  }
+  return delta;
+}
+
+/**
+ *  @brief  Sorts the edges of every vertex of a frozen graph by destination.
+ *  @param  frozen - The frozen graph whose edges are sorted.
+ *  @retval        - True in the case of success.
+ *  @retval        - False if memory allocation fails.
+ */
+static bool SortFrozenEdges(FrozenGraph* frozen) {
+  unsigned int maxDegree = 0;
+  for (unsigned int u = 0; u < frozen->numVertices; u++) {
+    unsigned int degree = frozen->offsets[u + 1] - frozen->offsets[u];
+    maxDegree = degree > maxDegree ? degree : maxDegree;
+  }
+
+  uint64_t* packed =
+      (uint64_t*)malloc((maxDegree > 0 ? maxDegree : 1) * sizeof(uint64_t));
+  if (packed == NULL) {
+    return false;
+  }
+
+  for (unsigned int u = 0; u < frozen->numVertices; u++) {
+    unsigned int start = frozen->offsets[u];
+    unsigned int degree = frozen->offsets[u + 1] - start;
+
+    for (unsigned int i = 0; i < degree; i++) {
+      packed[i] =
+          (uint64_t)frozen->dest[start + i] << 32 | frozen->weight[start + i];
+    }
+    qsort(packed, degree, sizeof(uint64_t), ComparePackedEdges);
+    for (unsigned int i = 0; i < degree; i++) {
+      frozen->dest[start + i] = (unsigned int)(packed[i] >> 32);
+      frozen->weight[start + i] = (unsigned int)packed[i];
+    }
+  }
+
+  free(packed);
+  return true;
+}
+
+/**
+ *  @brief  Builds a compressed snapshot of a graph.
+ *  @param  graph - The graph to be compressed.
+ *  @retval       - A pointer to the newly created snapshot.
+ *  @retval       - NULL if the graph is NULL or memory allocation fails.
+ */
+CompressedGraph* CompressGraph(const Graph* graph) {
+  FrozenGraph* frozen = FreezeGraph(graph);
+  if (frozen == NULL) {
+    return NULL;
+  }
+
+  CompressedGraph* compressed =
+      (CompressedGraph*)calloc(1, sizeof(CompressedGraph));
+  if (compressed == NULL || !SortFrozenEdges(frozen)) {
+    free(compressed);
+    FreeFrozenGraph(frozen);
+    return NULL;
+  }
+
+  compressed->numVertices = frozen->numVertices;
+  compressed->numEdges = frozen->numEdges;
+  compressed->offsets = (size_t*)malloc(
+      ((size_t)frozen->numVertices + 1) * sizeof(size_t));
+  if (compressed->offsets == NULL) {
+    FreeCompressedGraph(compressed);
+    FreeFrozenGraph(frozen);
+    return NULL;
+  }
+
+  // Measure every vertex, so the data is allocated at its final size
+  size_t size = 0;
+  for (unsigned int u = 0; u < frozen->numVertices; u++) {
+    compressed->offsets[u] = size;
+    unsigned int previous = u;
+    for (unsigned int e = frozen->offsets[u]; e < frozen->offsets[u + 1];
+         e++) {
+      unsigned int dest = frozen->dest[e];
+      size += VarintSize(EncodeDelta(dest, previous,
+                                     e == frozen->offsets[u]));
+      size += VarintSize(frozen->weight[e]);
+      previous = dest;
+    }
+  }
+  compressed->offsets[frozen->numVertices] = size;
+
+  compressed->data = (unsigned char*)malloc(size > 0 ? size : 1);
+  if (compressed->data == NULL) {
+    FreeCompressedGraph(compressed);
+    FreeFrozenGraph(frozen);
+    return NULL;
+  }
+
+  unsigned char* data = compressed->data;
+  for (unsigned int u = 0; u < frozen->numVertices; u++) {
+    unsigned int previous = u;
+    for (unsigned int e = frozen->offsets[u]; e < frozen->offsets[u + 1];
+         e++) {
+      unsigned int dest = frozen->dest[e];
+      data = EncodeVarint(data, EncodeDelta(dest, previous,
+                                            e == frozen->offsets[u]));
+      data = EncodeVarint(data, frozen->weight[e]);
+      previous = dest;
+    }
+  }
+
+  // The identifiers are already sorted, so they are taken over as they are
+  compressed->ids = frozen->ids;
+  frozen->ids = NULL;
+  FreeFrozenGraph(frozen);
+
+  return compressed;
+}
+
+/**
+ *  @brief  Finds the dense index of a vertex in a compressed snapshot.
+ *  @param  compressed - The snapshot which should contain the vertex.
+ *  @param  vertexID   - The identifier of the vertex.
+ *  @retval            - The dense index of the vertex.
+ *  @retval            - NO_VERTEX_INDEX if the vertex is not in the snapshot.
+ */
+unsigned int FindCompressedIndex(const CompressedGraph* compressed,
+                                 unsigned int vertexID) {
+  unsigned int low = 0;
+  unsigned int high = compressed->numVertices;
+
+  // Binary search over the sorted identifiers
+  while (low < high) {
+    unsigned int mid = low + (high - low) / 2;
+    if (compressed->ids[mid] < vertexID) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  if (low < compressed->numVertices && compressed->ids[low] == vertexID) {
+    return low;
+  }
+
+  return NO_VERTEX_INDEX;
+}
+
+/**
+ *  @brief  Gets the memory used by a compressed snapshot.
+ *  @param  compressed - The snapshot to be measured.
+ *  @retval            - The number of bytes allocated for the snapshot.
+ */
+size_t CompressedGraphSize(const CompressedGraph* compressed) {
+  size_t numVertices = compressed->numVertices;
+  return sizeof(CompressedGraph) + numVertices * sizeof(unsigned int) +
+         (numVertices + 1) * sizeof(size_t) +
+         compressed->offsets[numVertices];
+}
+
+/**
+ *  @brief Frees a compressed snapshot from memory.
+ *  @param compressed - The snapshot to be freed.
+ */
+void FreeCompressedGraph(CompressedGraph* compressed) {
+  if (compressed == NULL) {
+    return;
+  }
+
+  free(compressed->ids);
+  free(compressed->offsets);
+  free(compressed->data);
+  free(compressed);
+}
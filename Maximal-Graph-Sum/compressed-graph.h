@@ -0,0 +1,87 @@
+/**
+ *  @file      compressed-graph.h
+ *  @brief     Function definitions for building and querying read-only
+ *             snapshots of a graph with delta and variable-byte encoded
+ *             adjacency.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef COMPRESSED_GRAPH_H
+#define COMPRESSED_GRAPH_H
+
+#include "frozen-graph.h"
+#include "graph.h"
+
+/**
+ *  @brief  Decodes a variable-byte number and advances past it. Defined here
+ *          so the traversal loops of other files can inline it.
+ *  @param  data - Pointer to the first byte of the number.
+ *  @retval      - The decoded number.
+ */
+static inline unsigned int DecodeVarint(const unsigned char** data) {
+  const unsigned char* byte = *data;
+  unsigned int value = *byte & 0x7F;
+
+  // Weights and gaps below 128 take the first branch only
+  for (unsigned int shift = 7; *byte++ & 0x80; shift += 7) {
+    value |= (unsigned int)(*byte & 0x7F) << shift;
+  }
+
+  *data = byte;
+  return value;
+}
+
+/**
+ *  @brief  Decodes the next edge of a vertex of a compressed graph.
+ *  @param  data   - Pointer to the encoded edge, advanced past it.
+ *  @param  dest   - Pointer to the previous destination, or to the dense
+ *                   index of the vertex for its first edge. Receives the
+ *                   destination of the edge.
+ *  @param  first  - True for the first edge of the vertex.
+ *  @retval        - The weight of the edge.
+ */
+static inline unsigned int DecodeCompressedEdge(const unsigned char** data,
+                                                unsigned int* dest,
+                                                bool first) {
+  unsigned int delta = DecodeVarint(data);
+  if (first) {
+    delta = (delta >> 1) ^ (0u - (delta & 1));  // Zigzag, may be negative
+  }
+  *dest += delta;
+
+  return DecodeVarint(data);
+}
+
+/**
+ *  @brief  Builds a compressed snapshot of a graph.
+ *  @param  graph - The graph to be compressed.
+ *  @retval       - A pointer to the newly created snapshot.
+ *  @retval       - NULL if the graph is NULL or memory allocation fails.
+ */
+CompressedGraph* CompressGraph(const Graph* graph);
+
+/**
+ *  @brief  Finds the dense index of a vertex in a compressed snapshot.
+ *  @param  compressed - The snapshot which should contain the vertex.
+ *  @param  vertexID   - The identifier of the vertex.
+ *  @retval            - The dense index of the vertex.
+ *  @retval            - NO_VERTEX_INDEX if the vertex is not in the snapshot.
+ */
+unsigned int FindCompressedIndex(const CompressedGraph* compressed,
+                                 unsigned int vertexID);
+
+/**
+ *  @brief  Gets the memory used by a compressed snapshot.
+ *  @param  compressed - The snapshot to be measured.
+ *  @retval            - The number of bytes allocated for the snapshot.
+ */
+size_t CompressedGraphSize(const CompressedGraph* compressed);
+
+/**
+ *  @brief Frees a compressed snapshot from memory.
+ *  @param compressed - The snapshot to be freed.
+ */
+void FreeCompressedGraph(CompressedGraph* compressed);
+
+#endif  // !COMPRESSED_GRAPH_H
@@ -0,0 +1,178 @@
+/**
+
+    @file      dag-max-path.c
+    @brief     Function implementations of finding the exact path with maximum
+               weight in a directed acyclic graph, by dynamic programming over
+               a topological order.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#include "dag-max-path.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "search-path.h"
+#include "vertices.h"
+
+/**
+    @brief Collects every vertex reachable from a source, counts the edges
+           each one receives from the others and clears its sum.
+    @param graph Pointer to the graph structure.
+    @param srcIndex Dense index of the source vertex.
+    @param reached Array of indexCount flags, all false, set for every
+                   reachable vertex.
+    @param inDegree Array of indexCount counters, all 0, set to the number of
+                    edges from reachable vertices.
+    @param stack Array of indexCount entries used as the stack of the search.
+    @param dist Array of indexCount entries whose reachable ones are set to 0.
+    @param prev Array of indexCount entries whose reachable ones are set to
+                UINT_MAX, no predecessor yet.
+    @return The number of reachable vertices.
+**/
+static unsigned int CollectReachable(const Graph* graph, unsigned int srcIndex,
+                                     bool* reached, unsigned int* inDegree,
+                                     unsigned int* stack, unsigned int* dist,
+                                     unsigned int* prev) {
+  // Depth first, which visits neighbouring vertices together far more often
+  // than breadth first, each vertex is pushed once
+  unsigned int count = 0;
+  unsigned int top = 0;
+  reached[srcIndex] = true;
+  stack[top++] = srcIndex;
+
+  while (top > 0) {
+    unsigned int u = stack[--top];
+    count++;
+    dist[u] = 0;
+    prev[u] = UINT_MAX;
+
+    const EdgeBlock* block = graph->vertexByIndex[u]->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        unsigned int v = block->dest[i];
+        inDegree[v]++;
+        if (!reached[v]) {
+          reached[v] = true;
+          stack[top++] = v;
+        }
+      }
+    }
+  }
+
+  return count;
+}
+
+/**
+    @brief Finds the path with maximum weight between two vertices of a graph
+           whose vertices reachable from the source form no cycle.
+
+    @details The vertices reachable from src are ordered topologically with
+             Kahn's algorithm, and each one passes its best sum on to its
+             successors in that order, so the result is exact in O(V + E).
+             A cycle among them is detected when some vertex never reaches an
+             in-degree of 0, and the search then stops with GRAPH_HAS_CYCLE,
+             as the maximum would need a search over simple paths instead.
+             Cycles which cannot be reached from src are ignored.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices with maximum weight, NULL if
+                there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST, GRAPH_HAS_CYCLE or
+            FAILURE_ALLOCATING_SEARCH.
+**/
+int DagMaxPath(const Graph* graph, unsigned int src, unsigned int dest,
+               unsigned int* maxWeight, unsigned int** path,
+               unsigned int* pathLength) {
+  *maxWeight = 0;
+  *path = NULL;
+  *pathLength = 0;
+
+  if (graph == NULL) {
+    return INVALID_GRAPH;
+  }
+
+  const Vertex* srcVertex = FindVertex(graph, src);
+  const Vertex* destVertex = FindVertex(graph, dest);
+  if (srcVertex == NULL || destVertex == NULL) {
+    return VERTEX_DOES_NOT_EXIST;
+  }
+
+  unsigned int n = graph->indexCount;
+  bool* reached = (bool*)calloc(n, sizeof(bool));
+  unsigned int* inDegree = (unsigned int*)calloc(n, sizeof(unsigned int));
+  unsigned int* stack = (unsigned int*)malloc(n * sizeof(unsigned int));
+  unsigned int* dist = (unsigned int*)malloc(n * sizeof(unsigned int));
+  unsigned int* prev = (unsigned int*)malloc(n * sizeof(unsigned int));
+  if (reached == NULL || inDegree == NULL || stack == NULL || dist == NULL ||
+      prev == NULL) {
+    free(reached);
+    free(inDegree);
+    free(stack);
+    free(dist);
+    free(prev);
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+
+  unsigned int srcIndex = srcVertex->index;
+  unsigned int destIndex = destVertex->index;
+  unsigned int numReached = CollectReachable(graph, srcIndex, reached,
+                                             inDegree, stack, dist, prev);
+
+  // Kahn's algorithm, with a stack of the vertices whose predecessors are all
+  // done. An edge into src means src lies on a cycle, so it never starts.
+  unsigned int numOrdered = 0;
+  unsigned int top = 0;
+  if (inDegree[srcIndex] == 0) {
+    stack[top++] = srcIndex;
+  }
+
+  while (top > 0) {
+    unsigned int u = stack[--top];
+    numOrdered++;
+
+    const EdgeBlock* block = graph->vertexByIndex[u]->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        unsigned int v = block->dest[i];
+        unsigned int newDist = dist[u] + block->weight[i];
+
+        // Every predecessor of v is ordered before it, so dist[u] is final
+        if (prev[v] == UINT_MAX || newDist > dist[v]) {
+          dist[v] = newDist;
+          prev[v] = u;
+        }
+        if (--inDegree[v] == 0) {
+          stack[top++] = v;
+        }
+      }
+    }
+  }
+
+  int result = SUCCESS_SEARCHING_PATH;
+  if (numOrdered < numReached) {
+    result = GRAPH_HAS_CYCLE;
+  } else if (reached[destIndex]) {
+    if (BuildPathFromPrev(graph, prev, destIndex, path, pathLength)) {
+      *maxWeight = dist[destIndex];
+    } else {
+      result = FAILURE_ALLOCATING_SEARCH;
+    }
+  }
+
+  free(reached);
+  free(inDegree);
+  free(stack);
+  free(dist);
+  free(prev);
+
+  return result;
+}
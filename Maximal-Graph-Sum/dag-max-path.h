@@ -0,0 +1,43 @@
+/**
+
+    @file      dag-max-path.h
+    @brief     Function definitions for finding the exact path with maximum
+               weight in a directed acyclic graph.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef DAG_MAX_PATH_H
+#define DAG_MAX_PATH_H
+
+#include "graph.h"
+
+/**
+    @brief Finds the path with maximum weight between two vertices of a graph
+           whose vertices reachable from the source form no cycle.
+
+    @details The vertices reachable from src are ordered topologically with
+             Kahn's algorithm, and each one passes its best sum on to its
+             successors in that order, so the result is exact in O(V + E).
+             A cycle among them is detected when some vertex never reaches an
+             in-degree of 0, and the search then stops with GRAPH_HAS_CYCLE,
+             as the maximum would need a search over simple paths instead.
+             Cycles which cannot be reached from src are ignored.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices with maximum weight, NULL if
+                there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST, GRAPH_HAS_CYCLE or
+            FAILURE_ALLOCATING_SEARCH.
+**/
+int DagMaxPath(const Graph* graph, unsigned int src, unsigned int dest,
+               unsigned int* maxWeight, unsigned int** path,
+               unsigned int* pathLength);
+
+#endif  // !DAG_MAX_PATH_H
@@ -0,0 +1,586 @@
+/**
+
+    @file      dijkstra-alt.c
+    @brief     Function implementations of the ALT search, A* with landmarks
+               and the triangle inequality, to find the shortest path.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "dijkstra-alt.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "dijkstra-heap.h"
+#include "dijkstra-workspace.h"
+#include "search-path.h"
+#include "vertices.h"
+
+/**
+    @brief Copies the edges of a graph into compressed sparse row arrays
+           indexed by dense index, optionally reversed.
+    @param graph Pointer to the graph structure.
+    @param reverse True to store every edge at its destination, pointing back
+                   to its source.
+    @param offsets Pointer to store the first edge of each vertex.
+    @param adjacent Pointer to store the other end of each edge.
+    @param weight Pointer to store the weight of each edge.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool BuildAdjacency(const Graph* graph, bool reverse,
+                           unsigned int** offsets, unsigned int** adjacent,
+                           unsigned int** weight) {
+  unsigned int n = graph->indexCount;
+  unsigned int numEdges = 0;
+  for (unsigned int v = 0; v < n; v++) {
+    if (graph->vertexByIndex[v] != NULL) {
+      numEdges += graph->vertexByIndex[v]->edges.degree;
+    }
+  }
+
+  *offsets = (unsigned int*)calloc((size_t)n + 1, sizeof(unsigned int));
+  *adjacent = (unsigned int*)malloc(
+      (numEdges > 0 ? numEdges : 1) * sizeof(unsigned int));
+  *weight = (unsigned int*)malloc(
+      (numEdges > 0 ? numEdges : 1) * sizeof(unsigned int));
+  if (*offsets == NULL || *adjacent == NULL || *weight == NULL) {
+    return false;
+  }
+
+  // Count the edges of every row, shifted by one for the prefix sum
+  for (unsigned int v = 0; v < n; v++) {
+    const Vertex* vertex = graph->vertexByIndex[v];
+    if (vertex == NULL) {
+      continue;
+    }
+    const EdgeBlock* block = vertex->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        (*offsets)[(reverse ? block->dest[i] : v) + 1]++;
+      }
+    }
+  }
+
+  for (unsigned int v = 0; v < n; v++) {
+    (*offsets)[v + 1] += (*offsets)[v];
+  }
+
+  // Fill every row, moving its offset forward and then back into place
+  for (unsigned int v = 0; v < n; v++) {
+    const Vertex* vertex = graph->vertexByIndex[v];
+    if (vertex == NULL) {
+      continue;
+    }
+    const EdgeBlock* block = vertex->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        unsigned int row = reverse ? block->dest[i] : v;
+        unsigned int position = (*offsets)[row]++;
+        (*adjacent)[position] = reverse ? v : block->dest[i];
+        (*weight)[position] = block->weight[i];
+      }
+    }
+  }
+
+  for (unsigned int v = n; v > 0; v--) {
+    (*offsets)[v] = (*offsets)[v - 1];
+  }
+  (*offsets)[0] = 0;
+
+  return true;
+}
+
+/**
+    @brief Computes the distance from one vertex to every other vertex over
+           compressed sparse row arrays.
+    @param n Number of dense indices.
+    @param offsets First edge of each vertex.
+    @param adjacent Other end of each edge.
+    @param weight Weight of each edge.
+    @param source Dense index of the source vertex.
+    @param dist Array to store the distance of every vertex, UINT_MAX if it
+                cannot be reached.
+    @param heap Empty min-heap for n vertices, left empty.
+**/
+static void ComputeDistances(unsigned int n, const unsigned int* offsets,
+                             const unsigned int* adjacent,
+                             const unsigned int* weight, unsigned int source,
+                             unsigned int* dist, IndexedHeap* heap) {
+  for (unsigned int v = 0; v < n; v++) {
+    dist[v] = UINT_MAX;
+  }
+
+  dist[source] = 0;
+  PushOrImproveKey(heap, source, 0);
+
+  // Settled distances are final, so no edge can improve them again
+  while (heap->size > 0) {
+    unsigned int u = ExtractHeapRoot(heap).vertex;
+    for (unsigned int e = offsets[u]; e < offsets[u + 1]; e++) {
+      unsigned int v = adjacent[e];
+      unsigned int newDist = dist[u] + weight[e];
+      if (newDist < dist[v]) {
+        dist[v] = newDist;
+        PushOrImproveKey(heap, v, newDist);
+      }
+    }
+  }
+}
+
+/**
+    @brief Finds the vertex farthest from the landmarks chosen so far.
+    @param graph Pointer to the graph structure.
+    @param nearest Distance from the nearest landmark to every vertex,
+                   UINT_MAX if no landmark reaches it.
+    @param chosen True for the vertices already chosen as landmarks.
+    @return The dense index of the farthest vertex.
+**/
+static unsigned int FindFarthestVertex(const Graph* graph,
+                                       const unsigned int* nearest,
+                                       const bool* chosen) {
+  unsigned int farthest = UINT_MAX;
+  for (unsigned int v = 0; v < graph->indexCount; v++) {
+    if (graph->vertexByIndex[v] == NULL || chosen[v]) {
+      continue;
+    }
+    if (farthest == UINT_MAX || nearest[v] > nearest[farthest]) {
+      farthest = v;
+    }
+  }
+
+  return farthest;
+}
+
+/**
+    @brief Selects landmarks by farthest-point sampling and computes their
+           distances to and from every vertex.
+
+    @details The first landmark is the vertex farthest from the vertex with
+             the lowest dense index. Every next one is the vertex farthest
+             from all landmarks chosen so far, where vertices no landmark
+             reaches come first, so every part of the graph gets one. Each
+             landmark costs a forward and a backward search over the whole
+             graph, and the distances take 8 bytes per vertex and landmark.
+    @param graph Pointer to the graph structure.
+    @param count Number of landmarks, at most the number of vertices.
+    @return A pointer to the landmarks, or NULL if the graph is NULL or empty
+            or memory allocation fails.
+**/
+Landmarks* SelectLandmarks(const Graph* graph, unsigned int count) {
+  if (graph == NULL || graph->numVertices == 0 || count == 0) {
+    return NULL;
+  }
+  if (count > graph->numVertices) {
+    count = graph->numVertices;
+  }
+
+  unsigned int n = graph->indexCount;
+  Landmarks* landmarks = (Landmarks*)calloc(1, sizeof(Landmarks));
+  if (landmarks == NULL) {
+    return NULL;
+  }
+  landmarks->count = count;
+  landmarks->numVertices = n;
+  landmarks->ids = (unsigned int*)malloc(count * sizeof(unsigned int));
+  landmarks->fromLandmark =
+      (unsigned int*)malloc((size_t)n * count * sizeof(unsigned int));
+  landmarks->toLandmark =
+      (unsigned int*)malloc((size_t)n * count * sizeof(unsigned int));
+
+  unsigned int* offsets[2] = { NULL, NULL };
+  unsigned int* adjacent[2] = { NULL, NULL };
+  unsigned int* weight[2] = { NULL, NULL };
+  unsigned int* dist = (unsigned int*)malloc(n * sizeof(unsigned int));
+  unsigned int* nearest = (unsigned int*)malloc(n * sizeof(unsigned int));
+  bool* chosen = (bool*)calloc(n, sizeof(bool));
+  IndexedHeap* heap = CreateIndexedHeap(n, false);
+
+  bool allocated = landmarks->ids != NULL &&
+                   landmarks->fromLandmark != NULL &&
+                   landmarks->toLandmark != NULL && dist != NULL &&
+                   nearest != NULL && chosen != NULL && heap != NULL;
+  allocated = allocated &&
+              BuildAdjacency(graph, false, &offsets[0], &adjacent[0],
+                             &weight[0]) &&
+              BuildAdjacency(graph, true, &offsets[1], &adjacent[1],
+                             &weight[1]);
+
+  if (allocated) {
+    // Start from the vertex farthest from an arbitrary one
+    unsigned int seed = 0;
+    while (graph->vertexByIndex[seed] == NULL) {
+      seed++;
+    }
+    ComputeDistances(n, offsets[0], adjacent[0], weight[0], seed, nearest,
+                     heap);
+
+    for (unsigned int i = 0; i < count; i++) {
+      unsigned int landmark = FindFarthestVertex(graph, nearest, chosen);
+      chosen[landmark] = true;
+      landmarks->ids[i] = graph->vertexByIndex[landmark]->id;
+
+      // The seed distances only choose the first landmark
+      ComputeDistances(n, offsets[0], adjacent[0], weight[0], landmark, dist,
+                       heap);
+      for (unsigned int v = 0; v < n; v++) {
+        landmarks->fromLandmark[(size_t)v * count + i] = dist[v];
+        if (i == 0 || dist[v] < nearest[v]) {
+          nearest[v] = dist[v];
+        }
+      }
+
+      ComputeDistances(n, offsets[1], adjacent[1], weight[1], landmark, dist,
+                       heap);
+      for (unsigned int v = 0; v < n; v++) {
+        landmarks->toLandmark[(size_t)v * count + i] = dist[v];
+      }
+    }
+  }
+
+  for (unsigned int side = 0; side < 2; side++) {
+    free(offsets[side]);
+    free(adjacent[side]);
+    free(weight[side]);
+  }
+  free(dist);
+  free(nearest);
+  free(chosen);
+  FreeIndexedHeap(heap);
+
+  if (!allocated) {
+    FreeLandmarks(landmarks);
+    return NULL;
+  }
+
+  return landmarks;
+}
+
+/**
+    @brief Frees landmarks from memory.
+
+    @param landmarks Pointer to the landmarks, ignored if NULL.
+**/
+void FreeLandmarks(Landmarks* landmarks) {
+  if (landmarks == NULL) {
+    return;
+  }
+
+  free(landmarks->ids);
+  free(landmarks->fromLandmark);
+  free(landmarks->toLandmark);
+  free(landmarks);
+}
+
+/**
+    @brief Saves landmarks to a binary file, next to the file of the graph
+           written by SaveGraph. Vertices are stored by identifier, as dense
+           indices change between runs.
+    @param landmarks Pointer to the landmarks.
+    @param graph Pointer to the graph the landmarks were selected for.
+    @param filename Name of the file where the landmarks will be saved.
+    @return EXIT_SUCCESS on success, ERROR_OPENING_FILE if the file cannot be
+            opened or ERROR_WRITING_LANDMARKS if writing fails.
+**/
+int SaveLandmarks(const Landmarks* landmarks, const Graph* graph,
+                  const char* filename) {
+  FILE* file = fopen(filename, "wb");
+  if (!file) {
+    return ERROR_OPENING_FILE;
+  }
+
+  // Header with the number of landmarks and vertices, then the landmarks
+  unsigned int count = landmarks->count;
+  bool written =
+      fwrite(&count, sizeof(unsigned int), 1, file) == 1 &&
+      fwrite(&graph->numVertices, sizeof(unsigned int), 1, file) == 1 &&
+      fwrite(landmarks->ids, sizeof(unsigned int), count, file) == count;
+
+  // Every vertex as its identifier followed by both rows of distances
+  for (unsigned int v = 0; written && v < landmarks->numVertices; v++) {
+    const Vertex* vertex = graph->vertexByIndex[v];
+    if (vertex == NULL) {
+      continue;
+    }
+    written =
+        fwrite(&vertex->id, sizeof(unsigned int), 1, file) == 1 &&
+        fwrite(landmarks->fromLandmark + (size_t)v * count,
+               sizeof(unsigned int), count, file) == count &&
+        fwrite(landmarks->toLandmark + (size_t)v * count,
+               sizeof(unsigned int), count, file) == count;
+  }
+
+  if (fclose(file) != 0 || !written) {
+    return ERROR_WRITING_LANDMARKS;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+/**
+    @brief Loads landmarks saved by SaveLandmarks for a graph, usually the one
+           read back by LoadGraph.
+    @param graph Pointer to the graph, which must have the same vertices as
+                 the saved one.
+    @param filename Name of the binary file.
+    @return A pointer to the landmarks, or NULL if the file cannot be read or
+            does not describe every vertex of the graph.
+**/
+Landmarks* LoadLandmarks(const Graph* graph, const char* filename) {
+  if (graph == NULL) {
+    return NULL;
+  }
+
+  FILE* file = fopen(filename, "rb");
+  if (!file) {
+    return NULL;
+  }
+
+  unsigned int count;
+  unsigned int numVertices;
+  if (fread(&count, sizeof(unsigned int), 1, file) != 1 ||
+      fread(&numVertices, sizeof(unsigned int), 1, file) != 1 ||
+      count == 0 || numVertices != graph->numVertices) {
+    fclose(file);
+    return NULL;
+  }
+
+  unsigned int n = graph->indexCount;
+  Landmarks* landmarks = (Landmarks*)calloc(1, sizeof(Landmarks));
+  if (landmarks == NULL) {
+    fclose(file);
+    return NULL;
+  }
+  landmarks->count = count;
+  landmarks->numVertices = n;
+  landmarks->ids = (unsigned int*)malloc(count * sizeof(unsigned int));
+  landmarks->fromLandmark =
+      (unsigned int*)malloc((size_t)n * count * sizeof(unsigned int));
+  landmarks->toLandmark =
+      (unsigned int*)malloc((size_t)n * count * sizeof(unsigned int));
+  bool loaded = landmarks->ids != NULL && landmarks->fromLandmark != NULL &&
+                landmarks->toLandmark != NULL &&
+                fread(landmarks->ids, sizeof(unsigned int), count, file) ==
+                    count;
+
+  // Identifiers are mapped to the dense indices of this graph. As the
+  // number of vertices matches, distinct identifiers cover every vertex
+  for (unsigned int i = 0; loaded && i < numVertices; i++) {
+    unsigned int id;
+    const Vertex* vertex = NULL;
+    if (fread(&id, sizeof(unsigned int), 1, file) == 1) {
+      vertex = FindVertex(graph, id);
+    }
+    loaded =
+        vertex != NULL &&
+        fread(landmarks->fromLandmark + (size_t)vertex->index * count,
+              sizeof(unsigned int), count, file) == count &&
+        fread(landmarks->toLandmark + (size_t)vertex->index * count,
+              sizeof(unsigned int), count, file) == count;
+  }
+
+  fclose(file);
+
+  if (!loaded) {
+    FreeLandmarks(landmarks);
+    return NULL;
+  }
+
+  return landmarks;
+}
+
+/**
+    @brief Computes a lower bound of the distance from a vertex to the
+           destination with the triangle inequality over every landmark.
+    @param landmarks Pointer to the landmarks.
+    @param v Dense index of the vertex.
+    @param destFrom Distances from every landmark to the destination.
+    @param destTo Distances from the destination to every landmark.
+    @return The lower bound, or UINT_MAX if the vertex cannot reach the
+            destination.
+**/
+static unsigned int LowerBound(const Landmarks* landmarks, unsigned int v,
+                               const unsigned int* destFrom,
+                               const unsigned int* destTo) {
+  if (v >= landmarks->numVertices) {
+    return 0;  // Added after the landmarks were selected
+  }
+
+  unsigned int count = landmarks->count;
+  const unsigned int* from = landmarks->fromLandmark + (size_t)v * count;
+  const unsigned int* to = landmarks->toLandmark + (size_t)v * count;
+
+  unsigned int bound = 0;
+  for (unsigned int i = 0; i < count; i++) {
+    // d(L, dest) <= d(L, v) + d(v, dest)
+    if (from[i] != UINT_MAX && destFrom[i] != UINT_MAX) {
+      if (destFrom[i] > from[i] && destFrom[i] - from[i] > bound) {
+        bound = destFrom[i] - from[i];
+      }
+    } else if (from[i] != UINT_MAX) {
+      return UINT_MAX;  // L reaches v but not dest, so neither does v
+    }
+
+    // d(v, L) <= d(v, dest) + d(dest, L)
+    if (to[i] != UINT_MAX && destTo[i] != UINT_MAX) {
+      if (to[i] > destTo[i] && to[i] - destTo[i] > bound) {
+        bound = to[i] - destTo[i];
+      }
+    } else if (destTo[i] != UINT_MAX) {
+      return UINT_MAX;  // dest reaches L but v does not, so v misses dest
+    }
+  }
+
+  return bound;
+}
+
+/**
+    @brief Runs the ALT search between two vertices of a graph, and stores
+           the path if the destination is settled.
+    @param graph Pointer to the graph structure.
+    @param landmarks Pointer to the landmarks of the graph.
+    @param srcIndex Dense index of the source vertex.
+    @param destIndex Dense index of the destination vertex.
+    @param workspace Pointer to the workspace of the search.
+    @param minSum Pointer to store the minimum path sum.
+    @param path Pointer to store the shortest path vertices.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, or FAILURE_ALLOCATING_SEARCH if memory
+            allocation fails.
+**/
+static int SearchAltPath(const Graph* graph, const Landmarks* landmarks,
+                         unsigned int srcIndex, unsigned int destIndex,
+                         DijkstraWorkspace* workspace, unsigned int* minSum,
+                         unsigned int** path, unsigned int* pathLength) {
+  if (!BeginDijkstraQuery(workspace, graph->indexCount)) {
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+
+  IndexedHeap* heap = GetWorkspaceHeap(workspace, false);
+  if (heap == NULL) {
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+
+  // Without distances for dest, every bound falls back to 0
+  unsigned int* dist = workspace->dist;
+  unsigned int* prev = workspace->prev;
+  Landmarks empty = { 0, 0, NULL, NULL, NULL };
+  const Landmarks* bounds =
+      destIndex < landmarks->numVertices ? landmarks : &empty;
+  const unsigned int* destFrom =
+      bounds->fromLandmark + (size_t)destIndex * bounds->count;
+  const unsigned int* destTo =
+      bounds->toLandmark + (size_t)destIndex * bounds->count;
+
+  unsigned int srcBound = LowerBound(bounds, srcIndex, destFrom, destTo);
+  if (srcBound != UINT_MAX) {
+    ReachVertex(workspace, srcIndex, 0, UINT_MAX, 0);
+    PushOrImproveKey(heap, srcIndex, srcBound);
+  }
+
+  while (heap->size > 0) {
+    unsigned int u = ExtractHeapRoot(heap).vertex;
+
+    // The bound is consistent, so u is settled with its final distance
+    workspace->settled[u] = workspace->generation;
+    if (u == destIndex) {
+      break;
+    }
+
+    const EdgeBlock* block = graph->vertexByIndex[u]->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        unsigned int v = block->dest[i];
+        unsigned int newDist = dist[u] + block->weight[i];
+
+        if (IsVertexSettled(workspace, v) ||
+            (IsVertexReached(workspace, v) && newDist >= dist[v])) {
+          continue;
+        }
+
+        unsigned int bound = LowerBound(bounds, v, destFrom, destTo);
+        if (bound == UINT_MAX) {
+          continue;  // Pruned, dest cannot be reached through v
+        }
+
+        ReachVertex(workspace, v, newDist, u, 0);
+        PushOrImproveKey(heap, v, newDist + bound);
+      }
+    }
+  }
+
+  if (IsVertexSettled(workspace, destIndex)) {
+    if (!BuildPathFromPrev(graph, prev, destIndex, path, pathLength)) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
+    *minSum = dist[destIndex];
+  }
+
+  return SUCCESS_SEARCHING_PATH;
+}
+
+/**
+    @brief Computes the shortest path in a graph with the ALT search, an A*
+           search whose lower bounds come from the landmarks.
+
+    @details Vertices are expanded by their distance plus a lower bound of
+             their distance to dest, taken from the triangle inequality over
+             every landmark. The bound is consistent, so every vertex is
+             settled once and the search stops when dest is settled. The
+             landmarks must be selected again after edges change, or the
+             bounds may overestimate and the path may not be the shortest.
+    @param graph Pointer to the graph structure.
+    @param landmarks Pointer to the landmarks of the graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraAltMinPath(const Graph* graph, const Landmarks* landmarks,
+                       unsigned int src, unsigned int dest,
+                       DijkstraWorkspace* workspace, unsigned int* minSum,
+                       unsigned int** path, unsigned int* pathLength) {
+  *minSum = UINT_MAX;
+  *path = NULL;
+  *pathLength = 0;
+
+  if (graph == NULL || landmarks == NULL) {
+    return INVALID_GRAPH;
+  }
+
+  const Vertex* srcVertex = FindVertex(graph, src);
+  const Vertex* destVertex = FindVertex(graph, dest);
+  if (srcVertex == NULL || destVertex == NULL) {
+    return VERTEX_DOES_NOT_EXIST;
+  }
+
+  DijkstraWorkspace* used = workspace;
+  if (used == NULL) {
+    used = CreateDijkstraWorkspace(graph->indexCount);
+    if (used == NULL) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
+  }
+
+  int result = SearchAltPath(graph, landmarks, srcVertex->index,
+                             destVertex->index, used, minSum, path,
+                             pathLength);
+
+  if (workspace == NULL) {
+    FreeDijkstraWorkspace(used);
+  }
+
+  return result;
+}
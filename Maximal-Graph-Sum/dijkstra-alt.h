@@ -0,0 +1,99 @@
+/**
+
+    @file      dijkstra-alt.h
+    @brief     Function definitions for the ALT search, A* with landmarks and
+               the triangle inequality, to find the shortest path.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef DIJKSTRA_ALT_H
+#define DIJKSTRA_ALT_H
+
+#include "dijkstra-structure.h"
+#include "graph.h"
+
+#define DEFAULT_NUM_LANDMARKS 16
+
+#define ERROR_OPENING_FILE -1
+#define ERROR_WRITING_LANDMARKS -5
+
+/**
+    @brief Selects landmarks by farthest-point sampling and computes their
+           distances to and from every vertex.
+
+    @details The first landmark is the vertex farthest from the vertex with
+             the lowest dense index. Every next one is the vertex farthest
+             from all landmarks chosen so far, where vertices no landmark
+             reaches come first, so every part of the graph gets one. Each
+             landmark costs a forward and a backward search over the whole
+             graph, and the distances take 8 bytes per vertex and landmark.
+    @param graph Pointer to the graph structure.
+    @param count Number of landmarks, at most the number of vertices.
+    @return A pointer to the landmarks, or NULL if the graph is NULL or empty
+            or memory allocation fails.
+**/
+Landmarks* SelectLandmarks(const Graph* graph, unsigned int count);
+
+/**
+    @brief Frees landmarks from memory.
+
+    @param landmarks Pointer to the landmarks, ignored if NULL.
+**/
+void FreeLandmarks(Landmarks* landmarks);
+
+/**
+    @brief Saves landmarks to a binary file, next to the file of the graph
+           written by SaveGraph. Vertices are stored by identifier, as dense
+           indices change between runs.
+    @param landmarks Pointer to the landmarks.
+    @param graph Pointer to the graph the landmarks were selected for.
+    @param filename Name of the file where the landmarks will be saved.
+    @return EXIT_SUCCESS on success, ERROR_OPENING_FILE if the file cannot be
+            opened or ERROR_WRITING_LANDMARKS if writing fails.
+**/
+int SaveLandmarks(const Landmarks* landmarks, const Graph* graph,
+                  const char* filename);
+
+/**
+    @brief Loads landmarks saved by SaveLandmarks for a graph, usually the one
+           read back by LoadGraph.
+    @param graph Pointer to the graph, which must have the same vertices as
+                 the saved one.
+    @param filename Name of the binary file.
+    @return A pointer to the landmarks, or NULL if the file cannot be read or
+            does not describe every vertex of the graph.
+**/
+Landmarks* LoadLandmarks(const Graph* graph, const char* filename);
+
+/**
+    @brief Computes the shortest path in a graph with the ALT search, an A*
+           search whose lower bounds come from the landmarks.
+
+    @details Vertices are expanded by their distance plus a lower bound of
+             their distance to dest, taken from the triangle inequality over
+             every landmark. The bound is consistent, so every vertex is
+             settled once and the search stops when dest is settled. The
+             landmarks must be selected again after edges change, or the
+             bounds may overestimate and the path may not be the shortest.
+    @param graph Pointer to the graph structure.
+    @param landmarks Pointer to the landmarks of the graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraAltMinPath(const Graph* graph, const Landmarks* landmarks,
+                       unsigned int src, unsigned int dest,
+                       DijkstraWorkspace* workspace, unsigned int* minSum,
+                       unsigned int** path, unsigned int* pathLength);
+
+#endif  // !DIJKSTRA_ALT_H
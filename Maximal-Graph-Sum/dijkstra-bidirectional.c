@@ -0,0 +1,208 @@
+/**
+
+    @file      dijkstra-bidirectional.c
+    @brief     Function implementations of the bidirectional Dijkstra
+               algorithm to find the shortest path between two vertices.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#include "dijkstra-bidirectional.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "dijkstra-min.h"
+#include "dijkstra-queue.h"
+#include "dijkstra-workspace.h"
+#include "search-path.h"
+#include "vertices.h"
+
+/**
+    @brief Settles the next vertex of one side of the search and relaxes its
+           edges, recording every path which meets the other side.
+    @param graph Pointer to the graph structure.
+    @param side Pointer to the workspace of the side being expanded.
+    @param other Pointer to the workspace of the other side.
+    @param queue Pointer to the queue of the side being expanded.
+    @param backward True if the side follows incoming edges.
+    @param bestSum Pointer to the sum of the best path found so far.
+    @param meet Pointer to the vertex where the best path meets.
+**/
+static void ExpandSide(const Graph* graph, DijkstraWorkspace* side,
+                       const DijkstraWorkspace* other, MinQueue* queue,
+                       bool backward, unsigned long long* bestSum,
+                       unsigned int* meet) {
+  unsigned int u = PopMinQueue(queue);
+  side->settled[u] = side->generation;
+
+  const Vertex* vertex = graph->vertexByIndex[u];
+  const EdgeBlock* block =
+      backward ? vertex->inEdges.head : vertex->edges.head;
+  for (; block != NULL; block = block->next) {
+    for (unsigned int i = 0; i < block->count; i++) {
+      unsigned int v = block->dest[i];
+      unsigned int newDist = side->dist[u] + block->weight[i];
+
+      if (!IsVertexSettled(side, v) &&
+          (!IsVertexReached(side, v) || newDist < side->dist[v])) {
+        ReachVertex(side, v, newDist, u, 0);
+        PushMinQueue(queue, v, newDist);
+      }
+
+      // An edge into the other search completes a path from src to dest
+      if (IsVertexReached(other, v) &&
+          (unsigned long long)newDist + other->dist[v] < *bestSum) {
+        *bestSum = (unsigned long long)newDist + other->dist[v];
+        *meet = v;
+      }
+    }
+  }
+}
+
+/**
+    @brief Runs both searches between two vertices of a graph, and stores
+           the path if they meet.
+    @param graph Pointer to the graph structure.
+    @param srcIndex Dense index of the source vertex.
+    @param destIndex Dense index of the destination vertex.
+    @param forward Pointer to the workspace of the forward search.
+    @param minSum Pointer to store the minimum path sum.
+    @param path Pointer to store the shortest path vertices.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, or FAILURE_ALLOCATING_SEARCH if memory
+            allocation fails.
+**/
+static int SearchBidirectional(const Graph* graph, unsigned int srcIndex,
+                               unsigned int destIndex,
+                               DijkstraWorkspace* forward,
+                               unsigned int* minSum, unsigned int** path,
+                               unsigned int* pathLength) {
+  DijkstraWorkspace* backward = GetReverseWorkspace(forward);
+  if (backward == NULL ||
+      !BeginDijkstraQuery(forward, graph->indexCount) ||
+      !BeginDijkstraQuery(backward, graph->indexCount)) {
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+
+  // Both sides pick the same queue, buckets when the weights are small
+  MinQueue forwardQueue;
+  MinQueue backwardQueue;
+  if (!GetWorkspaceMinQueue(forward, DIJKSTRA_QUEUE_AUTO,
+                            graph->maxEdgeWeight, &forwardQueue) ||
+      !GetWorkspaceMinQueue(backward, DIJKSTRA_QUEUE_AUTO,
+                            graph->maxEdgeWeight, &backwardQueue)) {
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+
+  ReachVertex(forward, srcIndex, 0, UINT_MAX, 0);
+  PushMinQueue(&forwardQueue, srcIndex, 0);
+  ReachVertex(backward, destIndex, 0, UINT_MAX, 0);
+  PushMinQueue(&backwardQueue, destIndex, 0);
+
+  // Sums of two distances are kept in 64 bits, so they cannot wrap
+  unsigned long long bestSum = ULLONG_MAX;
+  unsigned int meet = UINT_MAX;
+  if (srcIndex == destIndex) {
+    bestSum = 0;
+    meet = srcIndex;
+  }
+
+  while (MinQueueSize(&forwardQueue) > 0 && MinQueueSize(&backwardQueue) > 0) {
+    unsigned int forwardTop = PeekMinQueueKey(&forwardQueue);
+    unsigned int backwardTop = PeekMinQueueKey(&backwardQueue);
+
+    // Any path not seen yet is at least as long as both frontiers together
+    if ((unsigned long long)forwardTop + backwardTop >= bestSum) {
+      break;
+    }
+
+    // Growing the smaller frontier keeps both searches balanced
+    if (MinQueueSize(&forwardQueue) <= MinQueueSize(&backwardQueue)) {
+      ExpandSide(graph, forward, backward, &forwardQueue, false, &bestSum,
+                 &meet);
+    } else {
+      ExpandSide(graph, backward, forward, &backwardQueue, true, &bestSum,
+                 &meet);
+    }
+  }
+
+  if (meet != UINT_MAX) {
+    if (!BuildMeetingPath(graph, forward->prev, backward->prev, meet, path,
+                          pathLength)) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
+    *minSum = forward->dist[meet] + backward->dist[meet];
+  }
+
+  return SUCCESS_SEARCHING_PATH;
+}
+
+/**
+    @brief Computes the shortest path in a graph with two Dijkstra searches,
+           forward from the source and backward from the destination over
+           the incoming edges.
+
+    @details The side with fewer queued vertices is expanded first. Every
+             edge which reaches a vertex already reached by the other side
+             gives a candidate path, and the search stops once the next
+             vertices of both sides are together at least as far as the best
+             candidate. Incoming edges must be tracked, see EnableInEdgeIndex,
+             otherwise a forward search is run instead.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraBidirectionalMinPath(const Graph* graph, unsigned int src,
+                                 unsigned int dest,
+                                 DijkstraWorkspace* workspace,
+                                 unsigned int* minSum, unsigned int** path,
+                                 unsigned int* pathLength) {
+  *minSum = UINT_MAX;
+  *path = NULL;
+  *pathLength = 0;
+
+  if (graph == NULL) {
+    return INVALID_GRAPH;
+  }
+
+  if (!graph->trackInEdges) {
+    DijkstraOptions options = DefaultDijkstraOptions();
+    return DijkstraMinPathWithOptions(graph, src, dest, &options, workspace,
+                                      minSum, path, pathLength);
+  }
+
+  const Vertex* srcVertex = FindVertex(graph, src);
+  const Vertex* destVertex = FindVertex(graph, dest);
+  if (srcVertex == NULL || destVertex == NULL) {
+    return VERTEX_DOES_NOT_EXIST;
+  }
+
+  DijkstraWorkspace* used = workspace;
+  if (used == NULL) {
+    used = CreateDijkstraWorkspace(graph->indexCount);
+    if (used == NULL) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
+  }
+
+  int result = SearchBidirectional(graph, srcVertex->index, destVertex->index,
+                                   used, minSum, path, pathLength);
+
+  if (workspace == NULL) {
+    FreeDijkstraWorkspace(used);
+  }
+
+  return result;
+}
@@ -0,0 +1,47 @@
+/**
+
+    @file      dijkstra-bidirectional.h
+    @brief     Function definitions for the bidirectional Dijkstra algorithm
+               to find the shortest path between two vertices.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef DIJKSTRA_BIDIRECTIONAL_H
+#define DIJKSTRA_BIDIRECTIONAL_H
+
+#include "dijkstra-structure.h"
+#include "graph.h"
+
+/**
+    @brief Computes the shortest path in a graph with two Dijkstra searches,
+           forward from the source and backward from the destination over
+           the incoming edges.
+
+    @details The side with fewer queued vertices is expanded first. Every
+             edge which reaches a vertex already reached by the other side
+             gives a candidate path, and the search stops once the next
+             vertices of both sides are together at least as far as the best
+             candidate. Incoming edges must be tracked, see EnableInEdgeIndex,
+             otherwise a forward search is run instead.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraBidirectionalMinPath(const Graph* graph, unsigned int src,
+                                 unsigned int dest,
+                                 DijkstraWorkspace* workspace,
+                                 unsigned int* minSum, unsigned int** path,
+                                 unsigned int* pathLength);
+
+#endif  // !DIJKSTRA_BIDIRECTIONAL_H
@@ -0,0 +1,189 @@
+/**
+
+    @file      dijkstra-buckets.c
+    @brief     Function implementations for the bucket queue used by
+               Dijkstra's algorithm when edge weights are small.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#include "dijkstra-buckets.h"
+
+#include <stdlib.h>
+
+/**
+    @brief Creates an empty bucket queue for vertices with dense indices below
+           numVertices.
+    @param numVertices Number of vertices the queue can hold.
+    @param maxWeight Highest weight of an edge of the graph.
+    @return A pointer to the newly created queue, or NULL if memory allocation
+            fails.
+**/
+BucketQueue* CreateBucketQueue(unsigned int numVertices,
+                               unsigned int maxWeight) {
+  BucketQueue* queue = (BucketQueue*)calloc(1, sizeof(BucketQueue));
+  if (queue == NULL) {
+    return NULL;
+  }
+
+  size_t allocated = numVertices > 0 ? numVertices : 1;
+  queue->numBuckets = maxWeight + 1;
+  queue->head =
+      (unsigned int*)malloc(queue->numBuckets * sizeof(unsigned int));
+  queue->next = (unsigned int*)malloc(allocated * sizeof(unsigned int));
+  queue->prev = (unsigned int*)malloc(allocated * sizeof(unsigned int));
+  queue->key = (unsigned int*)malloc(allocated * sizeof(unsigned int));
+  if (queue->head == NULL || queue->next == NULL || queue->prev == NULL ||
+      queue->key == NULL) {
+    FreeBucketQueue(queue);
+    return NULL;
+  }
+
+  for (unsigned int i = 0; i < queue->numBuckets; i++) {
+    queue->head[i] = NOT_IN_BUCKET;
+  }
+  for (unsigned int i = 0; i < numVertices; i++) {
+    queue->key[i] = NOT_IN_BUCKET;  // Not queued
+  }
+
+  queue->size = 0;
+  queue->cursor = 0;
+  return queue;
+}
+
+/**
+    @brief Frees a bucket queue from memory.
+
+    @param queue Pointer to the queue, ignored if NULL.
+**/
+void FreeBucketQueue(BucketQueue* queue) {
+  if (queue == NULL) {
+    return;
+  }
+
+  free(queue->head);
+  free(queue->next);
+  free(queue->prev);
+  free(queue->key);
+  free(queue);
+}
+
+/**
+    @brief Removes every vertex from the queue, visiting the buckets from the
+           cursor until all queued vertices are found.
+
+    @param queue Pointer to the queue.
+**/
+void ClearBucketQueue(BucketQueue* queue) {
+  unsigned int bucket = queue->cursor % queue->numBuckets;
+  while (queue->size > 0) {
+    for (unsigned int v = queue->head[bucket]; v != NOT_IN_BUCKET;
+         v = queue->next[v]) {
+      queue->key[v] = NOT_IN_BUCKET;
+      queue->size--;
+    }
+    queue->head[bucket] = NOT_IN_BUCKET;
+    bucket = bucket + 1 < queue->numBuckets ? bucket + 1 : 0;
+  }
+  queue->cursor = 0;
+}
+
+/**
+    @brief Unlinks a queued vertex from its bucket.
+
+    @param queue Pointer to the queue.
+    @param vertex Dense index of the vertex.
+**/
+static void UnlinkBucketVertex(BucketQueue* queue, unsigned int vertex) {
+  unsigned int next = queue->next[vertex];
+  unsigned int prev = queue->prev[vertex];
+
+  if (prev == NOT_IN_BUCKET) {
+    queue->head[queue->key[vertex] % queue->numBuckets] = next;
+  } else {
+    queue->next[prev] = next;
+  }
+  if (next != NOT_IN_BUCKET) {
+    queue->prev[next] = prev;
+  }
+}
+
+/**
+    @brief Adds a vertex to the queue, or lowers its key if it is already
+           there.
+
+    @param queue Pointer to the queue.
+    @param vertex Dense index of the vertex.
+    @param key Key of the vertex, no lower than the last extracted key and at
+               most the highest weight above it.
+**/
+void PushOrDecreaseBucketKey(BucketQueue* queue, unsigned int vertex,
+                             unsigned int key) {
+  if (queue->key[vertex] != NOT_IN_BUCKET) {
+    UnlinkBucketVertex(queue, vertex);
+  } else {
+    queue->size++;
+  }
+
+  unsigned int bucket = key % queue->numBuckets;
+  unsigned int first = queue->head[bucket];
+
+  queue->key[vertex] = key;
+  queue->prev[vertex] = NOT_IN_BUCKET;
+  queue->next[vertex] = first;
+  if (first != NOT_IN_BUCKET) {
+    queue->prev[first] = vertex;
+  }
+  queue->head[bucket] = vertex;
+}
+
+/**
+    @brief Moves the cursor to the lowest key in a non-empty queue.
+
+    @param queue Pointer to the queue.
+
+    @return The bucket holding the lowest key.
+**/
+static unsigned int AdvanceToMinBucket(BucketQueue* queue) {
+  // Keys never go below the cursor, so the buckets are scanned in a circle
+  unsigned int bucket = queue->cursor % queue->numBuckets;
+  while (queue->head[bucket] == NOT_IN_BUCKET) {
+    queue->cursor++;
+    bucket = bucket + 1 < queue->numBuckets ? bucket + 1 : 0;
+  }
+
+  return bucket;
+}
+
+/**
+    @brief Removes a vertex with the lowest key from the queue.
+
+    @param queue Pointer to the queue, which must not be empty.
+
+    @return The vertex and its key.
+**/
+HeapNode ExtractBucketMin(BucketQueue* queue) {
+  unsigned int vertex = queue->head[AdvanceToMinBucket(queue)];
+  HeapNode node = { vertex, queue->key[vertex] };
+
+  UnlinkBucketVertex(queue, vertex);
+  queue->key[vertex] = NOT_IN_BUCKET;
+  queue->size--;
+
+  return node;
+}
+
+/**
+    @brief Returns a vertex with the lowest key without removing it. The
+           cursor moves up to that key, so no lower key may be pushed later.
+
+    @param queue Pointer to the queue, which must not be empty.
+
+    @return The vertex and its key.
+**/
+HeapNode PeekBucketMin(BucketQueue* queue) {
+  unsigned int vertex = queue->head[AdvanceToMinBucket(queue)];
+  HeapNode node = { vertex, queue->key[vertex] };
+  return node;
+}
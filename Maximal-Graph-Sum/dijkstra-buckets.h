@@ -0,0 +1,76 @@
+/**
+
+    @file      dijkstra-buckets.h
+    @brief     Function definitions for the bucket queue used by Dijkstra's
+               algorithm when edge weights are small.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef DIJKSTRA_BUCKETS_H
+#define DIJKSTRA_BUCKETS_H
+
+#include "dijkstra-structure.h"
+
+#define DIAL_MAX_WEIGHT 1024  // Highest weight for which buckets are chosen
+#define NOT_IN_BUCKET 0xFFFFFFFF
+
+/**
+    @brief Creates an empty bucket queue for vertices with dense indices below
+           numVertices.
+    @param numVertices Number of vertices the queue can hold.
+    @param maxWeight Highest weight of an edge of the graph.
+    @return A pointer to the newly created queue, or NULL if memory allocation
+            fails.
+**/
+BucketQueue* CreateBucketQueue(unsigned int numVertices,
+                               unsigned int maxWeight);
+
+/**
+    @brief Frees a bucket queue from memory.
+
+    @param queue Pointer to the queue, ignored if NULL.
+**/
+void FreeBucketQueue(BucketQueue* queue);
+
+/**
+    @brief Removes every vertex from the queue, visiting the buckets from the
+           cursor until all queued vertices are found.
+
+    @param queue Pointer to the queue.
+**/
+void ClearBucketQueue(BucketQueue* queue);
+
+/**
+    @brief Adds a vertex to the queue, or lowers its key if it is already
+           there.
+
+    @param queue Pointer to the queue.
+    @param vertex Dense index of the vertex.
+    @param key Key of the vertex, no lower than the last extracted key and at
+               most the highest weight above it.
+**/
+void PushOrDecreaseBucketKey(BucketQueue* queue, unsigned int vertex,
+                             unsigned int key);
+
+/**
+    @brief Removes a vertex with the lowest key from the queue.
+
+    @param queue Pointer to the queue, which must not be empty.
+
+    @return The vertex and its key.
+**/
+HeapNode ExtractBucketMin(BucketQueue* queue);
+
+/**
+    @brief Returns a vertex with the lowest key without removing it. The
+           cursor moves up to that key, so no lower key may be pushed later.
+
+    @param queue Pointer to the queue, which must not be empty.
+
+    @return The vertex and its key.
+**/
+HeapNode PeekBucketMin(BucketQueue* queue);
+
+#endif  // !DIJKSTRA_BUCKETS_H
@@ -0,0 +1,394 @@
+/**
+
+    @file      dijkstra-delta.c
+    @brief     Function implementations of the parallel delta-stepping
+               algorithm to find the shortest paths from one vertex to every
+               other.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#include "dijkstra-delta.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parallel.h"
+#include "vertices.h"
+
+/**
+    @struct VertexList
+    @brief  Growable array of vertices, one per bucket and thread.
+**/
+typedef struct VertexList {
+  unsigned int* items;    // Dense indices of the vertices
+  unsigned int count;     // Number of vertices in the list
+  unsigned int capacity;  // Number of vertices the list can hold
+} VertexList;
+
+/**
+    @struct DeltaContext
+    @brief  State shared by the threads of a delta-stepping search.
+
+    @details Each task only pushes into its own bins, so bins never need a
+             lock. Bucket b is kept in bin b modulo numBins, which is enough
+             as every pending distance lies below the current bucket plus
+             delta plus the heaviest edge.
+**/
+typedef struct DeltaContext {
+  const Graph* graph;          // Graph being searched
+  volatile uint64_t* state;    // Distance of every vertex in the high 32
+                               // bits, and its predecessor in the low ones
+  unsigned int delta;          // Width of every bucket
+  unsigned int numBins;        // Bins of every task, reused in a cycle
+  VertexList* bins;            // Bins of every task, one task after another
+  ThreadPool* pool;            // Threads started once for every phase
+  unsigned int numTasks;       // Number of tasks of the current phase
+  const unsigned int* items;   // Vertices whose edges the phase relaxes
+  unsigned int count;          // Number of vertices of the current phase
+  bool heavy;                  // True to relax heavy edges, false for light
+  bool failed[MAX_THREADS];    // Set by a task whose bin could not grow
+} DeltaContext;
+
+/**
+    @brief Gets the first position of the range of a task.
+    @param context Pointer to the context of the search.
+    @param task Number of the task, or numTasks for the end.
+    @return The first position of the range.
+**/
+static unsigned int RangeStart(const DeltaContext* context,
+                               unsigned int task) {
+  return (unsigned int)((uint64_t)context->count * task / context->numTasks);
+}
+
+/**
+    @brief Adds a vertex to a bin, growing it when needed.
+    @param list Pointer to the bin.
+    @param vertex Dense index of the vertex.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool PushToBin(VertexList* list, unsigned int vertex) {
+  if (list->count == list->capacity) {
+    unsigned int capacity = list->capacity > 0 ? list->capacity * 2 : 64;
+    unsigned int* items = (unsigned int*)realloc(
+        list->items, capacity * sizeof(unsigned int));
+    if (items == NULL) {
+      return false;
+    }
+    list->items = items;
+    list->capacity = capacity;
+  }
+
+  list->items[list->count++] = vertex;
+  return true;
+}
+
+/**
+    @brief Lowers the distance of a vertex if a new path is shorter, and
+           queues it in the bucket of the new distance.
+    @param context Pointer to the context of the search.
+    @param task Number of the task relaxing the edge.
+    @param v Dense index of the destination of the edge.
+    @param newDist Distance of v through the edge.
+    @param u Dense index of the source of the edge.
+**/
+static void RelaxEdge(DeltaContext* context, unsigned int task,
+                      unsigned int v, unsigned int newDist, unsigned int u) {
+  uint64_t desired = (uint64_t)newDist << 32 | u;
+  uint64_t current = AtomicLoad64(&context->state[v]);
+
+  // Another thread may lower the distance first, then the swap is retried
+  while ((unsigned int)(current >> 32) > newDist) {
+    if (CompareExchange64(&context->state[v], current, desired)) {
+      unsigned int bin = (newDist / context->delta) % context->numBins;
+      if (!PushToBin(&context->bins[task * context->numBins + bin], v)) {
+        context->failed[task] = true;
+      }
+      return;
+    }
+    current = AtomicLoad64(&context->state[v]);
+  }
+}
+
+/**
+    @brief Relaxes the light or heavy edges of the vertices in the range of
+           a task.
+    @param argument Pointer to the context of the search.
+    @param task Number of the task.
+**/
+static void RelaxEdgesTask(void* argument, unsigned int task) {
+  DeltaContext* context = (DeltaContext*)argument;
+  unsigned int end = RangeStart(context, task + 1);
+
+  for (unsigned int i = RangeStart(context, task); i < end; i++) {
+    unsigned int u = context->items[i];
+    unsigned int distU = (unsigned int)(AtomicLoad64(&context->state[u]) >> 32);
+
+    const EdgeBlock* block = context->graph->vertexByIndex[u]->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int j = 0; j < block->count; j++) {
+        unsigned int weight = block->weight[j];
+        if ((weight > context->delta) == context->heavy) {
+          RelaxEdge(context, task, block->dest[j], distU + weight, u);
+        }
+      }
+    }
+  }
+}
+
+/**
+    @brief Relaxes the light or heavy edges of a set of vertices, on the
+           threads of the search if the set is large enough. Searches run
+           many small phases, so the threads are started once per search
+           rather than once per phase.
+    @param context Pointer to the context of the search.
+    @param items Dense indices of the vertices.
+    @param count Number of vertices.
+    @param heavy True to relax heavy edges, false for light ones.
+    @param numThreads Number of threads of the search.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool RunPhase(DeltaContext* context, const unsigned int* items,
+                     unsigned int count, bool heavy,
+                     unsigned int numThreads) {
+  context->items = items;
+  context->count = count;
+  context->heavy = heavy;
+  context->numTasks = count < DELTA_PARALLEL_MIN_COUNT ? 1 : numThreads;
+  RunThreadPool(context->pool, context->numTasks, RelaxEdgesTask, context);
+
+  for (unsigned int task = 0; task < context->numTasks; task++) {
+    if (context->failed[task]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+    @brief Finds the lowest bucket, from a given one, which holds a vertex
+           in the bin of any task.
+    @param context Pointer to the context of the search.
+    @param numThreads Number of threads of the search.
+    @param bucket Pointer to the first bucket, updated to the one found.
+    @return True if a bucket was found, false if every bin is empty.
+**/
+static bool FindNextBucket(const DeltaContext* context,
+                           unsigned int numThreads, unsigned int* bucket) {
+  for (unsigned int offset = 0; offset < context->numBins; offset++) {
+    unsigned int bin = (*bucket + offset) % context->numBins;
+    for (unsigned int task = 0; task < numThreads; task++) {
+      if (context->bins[task * context->numBins + bin].count > 0) {
+        *bucket += offset;
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+/**
+    @brief Empties the bins of a bucket into the vertices of the next phase,
+           skipping duplicates and vertices which have moved to a lower
+           bucket since they were queued.
+    @param context Pointer to the context of the search.
+    @param numThreads Number of threads of the search.
+    @param bucket Bucket being emptied.
+    @param phase Number of the phase, different from every previous one.
+    @param phaseStamp Phase in which every vertex was last collected.
+    @param frontier Array to store the vertices of the next phase.
+    @param removedStamp Bucket plus one in which every vertex was last
+                        removed.
+    @param removed Vertices removed from the bucket, extended.
+    @param numRemoved Pointer to the number of removed vertices, increased.
+    @return The number of vertices of the next phase.
+**/
+static unsigned int CollectBucket(DeltaContext* context,
+                                  unsigned int numThreads,
+                                  unsigned int bucket, unsigned int phase,
+                                  unsigned int* phaseStamp,
+                                  unsigned int* frontier,
+                                  unsigned int* removedStamp,
+                                  unsigned int* removed,
+                                  unsigned int* numRemoved) {
+  unsigned int count = 0;
+  unsigned int bin = bucket % context->numBins;
+
+  for (unsigned int task = 0; task < numThreads; task++) {
+    VertexList* list = &context->bins[task * context->numBins + bin];
+    for (unsigned int i = 0; i < list->count; i++) {
+      unsigned int v = list->items[i];
+      unsigned int distV = (unsigned int)(context->state[v] >> 32);
+      if (distV / context->delta != bucket || phaseStamp[v] == phase) {
+        continue;
+      }
+
+      phaseStamp[v] = phase;
+      frontier[count++] = v;
+      if (removedStamp[v] != bucket + 1) {
+        removedStamp[v] = bucket + 1;
+        removed[(*numRemoved)++] = v;
+      }
+    }
+    list->count = 0;
+  }
+
+  return count;
+}
+
+/**
+    @brief Chooses the width of the buckets.
+    @param graph Pointer to the graph structure.
+    @param delta Width requested, or DELTA_AUTO.
+    @return The width, at least 1, and wide enough for DELTA_MAX_BINS.
+**/
+static unsigned int ChooseDelta(const Graph* graph, unsigned int delta) {
+  unsigned int maxWeight = graph->maxEdgeWeight;
+
+  if (delta == DELTA_AUTO) {
+    // About one light edge per vertex lands in each bucket
+    uint64_t numEdges = 0;
+    for (unsigned int v = 0; v < graph->indexCount; v++) {
+      if (graph->vertexByIndex[v] != NULL) {
+        numEdges += graph->vertexByIndex[v]->edges.degree;
+      }
+    }
+    uint64_t degree = numEdges / graph->numVertices;
+    delta = (unsigned int)(maxWeight / (degree > 0 ? degree : 1));
+  }
+
+  if (delta == 0) {
+    delta = 1;
+  }
+  if (maxWeight / delta > DELTA_MAX_BINS - 2) {
+    delta = maxWeight / (DELTA_MAX_BINS - 2) + 1;
+  }
+
+  return delta;
+}
+
+/**
+    @brief Computes the shortest paths from a vertex to every vertex of a
+           graph with the delta-stepping algorithm, on several threads.
+
+    @details Vertices are kept in buckets of width delta by their tentative
+             distance. The lowest bucket is emptied by relaxing the light
+             edges, of weight up to delta, of all its vertices in parallel,
+             repeated while they refill it. The heavy edges of every vertex
+             removed from it are then relaxed once, as their targets fall in
+             later buckets. Distance and predecessor are updated together by
+             a 64-bit compare and swap, so threads never take locks.
+
+             The distances are those of DijkstraMinPath. When several
+             predecessors give the same distance, the one kept may differ
+             from the sequential search, but every predecessor lies on a
+             shortest path.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param delta Width of the buckets, or DELTA_AUTO.
+    @param numThreads Number of threads, or 0 for GetThreadCount.
+    @param dist Array of indexCount entries to store the distance of every
+                dense index, UINT_MAX if it cannot be reached.
+    @param prev Array of indexCount entries to store the dense index of the
+                predecessor of every vertex, UINT_MAX for src and for the
+                vertices which cannot be reached.
+    @return SUCCESS_SEARCHING_PATH, INVALID_GRAPH, VERTEX_DOES_NOT_EXIST or
+            FAILURE_ALLOCATING_SEARCH.
+**/
+int DeltaSteppingShortestPaths(const Graph* graph, unsigned int src,
+                               unsigned int delta, unsigned int numThreads,
+                               unsigned int* dist, unsigned int* prev) {
+  if (graph == NULL) {
+    return INVALID_GRAPH;
+  }
+
+  const Vertex* srcVertex = FindVertex(graph, src);
+  if (srcVertex == NULL) {
+    return VERTEX_DOES_NOT_EXIST;
+  }
+
+  if (numThreads == 0 || numThreads > MAX_THREADS) {
+    numThreads = numThreads == 0 ? GetThreadCount() : MAX_THREADS;
+  }
+
+  unsigned int n = graph->indexCount;
+  DeltaContext context = { 0 };
+  context.graph = graph;
+  context.delta = ChooseDelta(graph, delta);
+  context.numBins = graph->maxEdgeWeight / context.delta + 2;
+  context.pool = CreateThreadPool(numThreads);
+  context.state = (volatile uint64_t*)malloc(n * sizeof(uint64_t));
+  context.bins =
+      (VertexList*)calloc((size_t)numThreads * context.numBins,
+                          sizeof(VertexList));
+  unsigned int* frontier = (unsigned int*)malloc(n * sizeof(unsigned int));
+  unsigned int* removed = (unsigned int*)malloc(n * sizeof(unsigned int));
+  unsigned int* phaseStamp = (unsigned int*)calloc(n, sizeof(unsigned int));
+  unsigned int* removedStamp =
+      (unsigned int*)calloc(n, sizeof(unsigned int));
+
+  bool success = context.pool != NULL && context.state != NULL &&
+                 context.bins != NULL && frontier != NULL && removed != NULL &&
+                 phaseStamp != NULL && removedStamp != NULL;
+
+  if (success) {
+    // Every vertex starts unreached, with both halves set to UINT_MAX
+    for (unsigned int v = 0; v < n; v++) {
+      context.state[v] = UINT64_MAX;
+    }
+    context.state[srcVertex->index] = UINT_MAX;
+    success = PushToBin(&context.bins[0], srcVertex->index);
+  }
+
+  unsigned int bucket = 0;
+  unsigned int phase = 0;
+  while (success && FindNextBucket(&context, numThreads, &bucket)) {
+    unsigned int numRemoved = 0;
+
+    // Light edges may refill the bucket, so it is emptied until it stays so
+    for (;;) {
+      unsigned int count = CollectBucket(&context, numThreads, bucket,
+                                         ++phase, phaseStamp, frontier,
+                                         removedStamp, removed, &numRemoved);
+      if (count == 0) {
+        break;
+      }
+      success = RunPhase(&context, frontier, count, false, numThreads);
+      if (!success) {
+        break;
+      }
+    }
+
+    // The removed vertices are final, their heavy edges only reach later
+    success = success &&
+              RunPhase(&context, removed, numRemoved, true, numThreads);
+    bucket++;
+  }
+
+  if (success) {
+    for (unsigned int v = 0; v < n; v++) {
+      dist[v] = (unsigned int)(context.state[v] >> 32);
+      prev[v] = (unsigned int)context.state[v];
+    }
+  }
+
+  if (context.bins != NULL) {
+    for (unsigned int i = 0; i < numThreads * context.numBins; i++) {
+      free(context.bins[i].items);
+    }
+  }
+  FreeThreadPool(context.pool);
+  free((void*)context.state);
+  free(context.bins);
+  free(frontier);
+  free(removed);
+  free(phaseStamp);
+  free(removedStamp);
+
+  return success ? SUCCESS_SEARCHING_PATH : FAILURE_ALLOCATING_SEARCH;
+}
@@ -0,0 +1,53 @@
+/**
+
+    @file      dijkstra-delta.h
+    @brief     Function definitions for the parallel delta-stepping algorithm
+               to find the shortest paths from one vertex to every other.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef DIJKSTRA_DELTA_H
+#define DIJKSTRA_DELTA_H
+
+#include "graph.h"
+
+#define DELTA_AUTO 0  // Weight of the heaviest edge over the average degree
+#define DELTA_MAX_BINS 4096  // Most buckets pending at once, delta is raised
+                             // when the heaviest edge would need more
+#define DELTA_PARALLEL_MIN_COUNT 1024  // Smaller phases use a single thread
+
+/**
+    @brief Computes the shortest paths from a vertex to every vertex of a
+           graph with the delta-stepping algorithm, on several threads.
+
+    @details Vertices are kept in buckets of width delta by their tentative
+             distance. The lowest bucket is emptied by relaxing the light
+             edges, of weight up to delta, of all its vertices in parallel,
+             repeated while they refill it. The heavy edges of every vertex
+             removed from it are then relaxed once, as their targets fall in
+             later buckets. Distance and predecessor are updated together by
+             a 64-bit compare and swap, so threads never take locks.
+
+             The distances are those of DijkstraMinPath. When several
+             predecessors give the same distance, the one kept may differ
+             from the sequential search, but every predecessor lies on a
+             shortest path.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param delta Width of the buckets, or DELTA_AUTO.
+    @param numThreads Number of threads, or 0 for GetThreadCount.
+    @param dist Array of indexCount entries to store the distance of every
+                dense index, UINT_MAX if it cannot be reached.
+    @param prev Array of indexCount entries to store the dense index of the
+                predecessor of every vertex, UINT_MAX for src and for the
+                vertices which cannot be reached.
+    @return SUCCESS_SEARCHING_PATH, INVALID_GRAPH, VERTEX_DOES_NOT_EXIST or
+            FAILURE_ALLOCATING_SEARCH.
+**/
+int DeltaSteppingShortestPaths(const Graph* graph, unsigned int src,
+                               unsigned int delta, unsigned int numThreads,
+                               unsigned int* dist, unsigned int* prev);
+
+#endif  // !DIJKSTRA_DELTA_H
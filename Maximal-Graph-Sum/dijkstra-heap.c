@@ -0,0 +1,193 @@
+/**
+
+    @file      dijkstra-heap.c
+    @brief     Function implementations for the indexed heap used by
+               Dijkstra's algorithm.
+    @details   The heap is 4-ary, so it is half as deep as a binary heap and
+               the children compared when sifting down sit next to each other
+               in memory. Sifting moves a hole instead of swapping nodes.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#include "dijkstra-heap.h"
+
+#include <stdlib.h>
+
+/**
+    @brief Creates an empty indexed heap for vertices with dense indices
+           below numVertices.
+    @param numVertices Number of vertices the heap can hold.
+    @param maxHeap True to extract the largest key first, false for the
+                   smallest.
+    @return A pointer to the newly created heap, or NULL if memory allocation
+            fails.
+**/
+IndexedHeap* CreateIndexedHeap(unsigned int numVertices, bool maxHeap) {
+  IndexedHeap* heap = (IndexedHeap*)malloc(sizeof(IndexedHeap));
+  if (heap == NULL) {
+    return NULL;
+  }
+
+  size_t allocated = numVertices > 0 ? numVertices : 1;
+  heap->nodes = (HeapNode*)malloc(allocated * sizeof(HeapNode));
+  heap->position = (unsigned int*)malloc(allocated * sizeof(unsigned int));
+  if (heap->nodes == NULL || heap->position == NULL) {
+    FreeIndexedHeap(heap);
+    return NULL;
+  }
+
+  for (unsigned int i = 0; i < numVertices; i++) {
+    heap->position[i] = NOT_IN_HEAP;
+  }
+
+  heap->size = 0;
+  heap->capacity = numVertices;
+  heap->keyMask = maxHeap ? 0xFFFFFFFF : 0;
+  return heap;
+}
+
+/**
+    @brief Frees an indexed heap from memory.
+
+    @param heap Pointer to the heap, ignored if NULL.
+**/
+void FreeIndexedHeap(IndexedHeap* heap) {
+  if (heap == NULL) {
+    return;
+  }
+
+  free(heap->nodes);
+  free(heap->position);
+  free(heap);
+}
+
+/**
+    @brief Removes every vertex from the heap, in time proportional to the
+           number of vertices left in it.
+
+    @param heap Pointer to the heap.
+**/
+void ClearIndexedHeap(IndexedHeap* heap) {
+  for (unsigned int i = 0; i < heap->size; i++) {
+    heap->position[heap->nodes[i].vertex] = NOT_IN_HEAP;
+  }
+  heap->size = 0;
+}
+
+/**
+    @brief Moves a node towards the root until its parent has a smaller key.
+
+    @param heap Pointer to the heap.
+    @param i Position of the hole where the node starts.
+    @param node Node to be placed, with its stored key.
+**/
+static void SiftUp(IndexedHeap* heap, unsigned int i, HeapNode node) {
+  while (i > 0) {
+    unsigned int parent = (i - 1) / HEAP_ARITY;
+    if (heap->nodes[parent].weight <= node.weight) {
+      break;
+    }
+    heap->nodes[i] = heap->nodes[parent];
+    heap->position[heap->nodes[i].vertex] = i;
+    i = parent;
+  }
+
+  heap->nodes[i] = node;
+  heap->position[node.vertex] = i;
+}
+
+/**
+    @brief Moves a node away from the root until its children have larger
+           keys.
+
+    @param heap Pointer to the heap.
+    @param i Position of the hole where the node starts.
+    @param node Node to be placed, with its stored key.
+**/
+static void SiftDown(IndexedHeap* heap, unsigned int i, HeapNode node) {
+  for (;;) {
+    unsigned int first = HEAP_ARITY * i + 1;
+    if (first >= heap->size) {
+      break;
+    }
+
+    unsigned int last = first + HEAP_ARITY;
+    if (last > heap->size) {
+      last = heap->size;
+    }
+
+    unsigned int best = first;
+    for (unsigned int child = first + 1; child < last; child++) {
+      if (heap->nodes[child].weight < heap->nodes[best].weight) {
+        best = child;
+      }
+    }
+
+    if (heap->nodes[best].weight >= node.weight) {
+      break;
+    }
+    heap->nodes[i] = heap->nodes[best];
+    heap->position[heap->nodes[i].vertex] = i;
+    i = best;
+  }
+
+  heap->nodes[i] = node;
+  heap->position[node.vertex] = i;
+}
+
+/**
+    @brief Adds a vertex to the heap, or improves its key if it is already
+           there. The key is lowered in a min-heap and raised in a max-heap.
+
+    @param heap Pointer to the heap.
+    @param vertex Dense index of the vertex.
+    @param weight Key of the vertex, which must be at least as good as its
+                  current key.
+**/
+void PushOrImproveKey(IndexedHeap* heap, unsigned int vertex,
+                      unsigned int weight) {
+  HeapNode node = { vertex, weight ^ heap->keyMask };
+
+  unsigned int i = heap->position[vertex];
+  if (i == NOT_IN_HEAP) {
+    i = heap->size++;
+  }
+
+  // A better key only ever moves the vertex towards the root
+  SiftUp(heap, i, node);
+}
+
+/**
+    @brief Removes the vertex with the best key from the heap.
+
+    @param heap Pointer to the heap, which must not be empty.
+
+    @return The vertex and its key.
+**/
+HeapNode ExtractHeapRoot(IndexedHeap* heap) {
+  HeapNode root = heap->nodes[0];
+  heap->position[root.vertex] = NOT_IN_HEAP;
+
+  heap->size--;
+  if (heap->size > 0) {
+    SiftDown(heap, 0, heap->nodes[heap->size]);
+  }
+
+  root.weight ^= heap->keyMask;
+  return root;
+}
+
+/**
+    @brief Returns the vertex with the best key without removing it.
+
+    @param heap Pointer to the heap, which must not be empty.
+
+    @return The vertex and its key.
+**/
+HeapNode PeekHeapRoot(const IndexedHeap* heap) {
+  HeapNode root = heap->nodes[0];
+  root.weight ^= heap->keyMask;
+  return root;
+}
@@ -0,0 +1,77 @@
+/**
+
+    @file      dijkstra-heap.h
+    @brief     Function definitions for the indexed heap used by Dijkstra's
+               algorithm.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef DIJKSTRA_HEAP_H
+#define DIJKSTRA_HEAP_H
+
+#include <stdbool.h>
+
+#include "dijkstra-structure.h"
+
+#define HEAP_ARITY 4  // Children per node, a whole group fits a cache line
+#define NOT_IN_HEAP 0xFFFFFFFF
+
+/**
+    @brief Creates an empty indexed heap for vertices with dense indices
+           below numVertices.
+    @param numVertices Number of vertices the heap can hold.
+    @param maxHeap True to extract the largest key first, false for the
+                   smallest.
+    @return A pointer to the newly created heap, or NULL if memory allocation
+            fails.
+**/
+IndexedHeap* CreateIndexedHeap(unsigned int numVertices, bool maxHeap);
+
+/**
+    @brief Frees an indexed heap from memory.
+
+    @param heap Pointer to the heap, ignored if NULL.
+**/
+void FreeIndexedHeap(IndexedHeap* heap);
+
+/**
+    @brief Removes every vertex from the heap, in time proportional to the
+           number of vertices left in it.
+
+    @param heap Pointer to the heap.
+**/
+void ClearIndexedHeap(IndexedHeap* heap);
+
+/**
+    @brief Adds a vertex to the heap, or improves its key if it is already
+           there. The key is lowered in a min-heap and raised in a max-heap.
+
+    @param heap Pointer to the heap.
+    @param vertex Dense index of the vertex.
+    @param weight Key of the vertex, which must be at least as good as its
+                  current key.
+**/
+void PushOrImproveKey(IndexedHeap* heap, unsigned int vertex,
+                      unsigned int weight);
+
+/**
+    @brief Removes the vertex with the best key from the heap.
+
+    @param heap Pointer to the heap, which must not be empty.
+
+    @return The vertex and its key.
+**/
+HeapNode ExtractHeapRoot(IndexedHeap* heap);
+
+/**
+    @brief Returns the vertex with the best key without removing it.
+
+    @param heap Pointer to the heap, which must not be empty.
+
+    @return The vertex and its key.
+**/
+HeapNode PeekHeapRoot(const IndexedHeap* heap);
+
+#endif  // !DIJKSTRA_HEAP_H
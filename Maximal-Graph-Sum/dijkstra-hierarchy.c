@@ -0,0 +1,1258 @@
+/**
+
+    @file      dijkstra-hierarchy.c
+    @brief     Function implementations of contraction hierarchies, built by
+               contracting the vertices of a graph outside its dense core and
+               queried with two Dijkstra searches which climb the hierarchy.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "dijkstra-hierarchy.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dijkstra-heap.h"
+#include "dijkstra-min.h"
+#include "dijkstra-workspace.h"
+#include "search-path.h"
+#include "vertices.h"
+
+/**
+    @struct OverlayList
+    @brief  Edges of a vertex towards the vertices not contracted yet.
+**/
+typedef struct OverlayList {
+  HierarchyEdge* edges;   // Edges, at most one per neighbour
+  unsigned int count;     // Number of edges in the list
+  unsigned int capacity;  // Number of edges the list can hold
+} OverlayList;
+
+/**
+    @struct ContractionContext
+    @brief  Remaining graph while its vertices are being contracted.
+
+    @details Once a vertex is contracted it is removed from the lists of its
+             neighbours, but keeps its own lists. Those then hold exactly its
+             edges towards vertices of higher rank.
+**/
+typedef struct ContractionContext {
+  unsigned int numVertices;     // Dense indices of the graph
+  OverlayList* out;             // Outgoing edges of every vertex
+  OverlayList* in;              // Incoming edges of every vertex
+  size_t numEdges;              // Edges between vertices not contracted yet
+  unsigned int* contractedNeighbours;  // Neighbours of every vertex
+                                       // contracted so far
+  bool* isTarget;               // Outgoing neighbours of the vertex being
+                                // contracted
+  DijkstraWorkspace* witness;   // Workspace of the witness searches
+} ContractionContext;
+
+/**
+    @struct WitnessLimits
+    @brief  Work a witness search may do before it gives up. A witness it
+            misses only costs a shortcut.
+**/
+typedef struct WitnessLimits {
+  unsigned int settled;  // Vertices settled
+  unsigned int edges;    // Edges relaxed
+  unsigned int hops;     // Edges on the paths followed
+} WitnessLimits;
+
+// The searches which decide the shortcuts of a contraction
+static const WitnessLimits contractLimits = {
+    WITNESS_SETTLE_LIMIT, UINT_MAX, WITNESS_HOP_LIMIT};
+
+// The searches which only rank a vertex, run for every neighbour of every
+// contracted vertex, so a rougher count of the shortcuts is worth the speed
+static const WitnessLimits rankLimits = {
+    WITNESS_SIMULATE_SETTLE_LIMIT, WITNESS_SIMULATE_EDGE_LIMIT,
+    WITNESS_SIMULATE_HOP_LIMIT};
+
+/**
+    @struct UnpackStack
+    @brief  Pending edges of a path whose shortcuts are being unpacked.
+**/
+typedef struct UnpackStack {
+  unsigned int* pairs;    // Source and destination of every pending edge
+  unsigned int size;      // Number of pending edges
+  unsigned int capacity;  // Number of edges the stack can hold
+} UnpackStack;
+
+/**
+    @brief Finds the edge towards a vertex in an overlay list.
+
+    @details The scan is linear in the list. Contraction stops before the
+             remaining graph grows dense, so the lists stay short and are not
+             indexed.
+    @param list Pointer to the list.
+    @param vertex Dense index of the other end of the edge.
+    @return A pointer to the edge, or NULL if there is none.
+**/
+static HierarchyEdge* FindOverlayEdge(const OverlayList* list,
+                                      unsigned int vertex) {
+  for (unsigned int i = 0; i < list->count; i++) {
+    if (list->edges[i].vertex == vertex) {
+      return &list->edges[i];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+    @brief Adds an edge to an overlay list, or lowers the weight of the edge
+           already there towards the same vertex.
+    @param list Pointer to the list.
+    @param vertex Dense index of the other end of the edge.
+    @param weight Weight of the edge.
+    @param middle Middle vertex of a shortcut, or NO_SHORTCUT_MIDDLE.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool AddOverlayEdge(OverlayList* list, unsigned int vertex,
+                           unsigned int weight, unsigned int middle) {
+  HierarchyEdge* existing = FindOverlayEdge(list, vertex);
+  if (existing != NULL) {
+    if (weight < existing->weight) {
+      existing->weight = weight;
+      existing->middle = middle;
+    }
+    return true;
+  }
+
+  if (list->count == list->capacity) {
+    unsigned int capacity = list->capacity > 0 ? list->capacity * 2 : 4;
+    HierarchyEdge* edges = (HierarchyEdge*)realloc(
+        list->edges, capacity * sizeof(HierarchyEdge));
+    if (edges == NULL) {
+      return false;
+    }
+    list->edges = edges;
+    list->capacity = capacity;
+  }
+
+  HierarchyEdge* edge = &list->edges[list->count++];
+  edge->vertex = vertex;
+  edge->weight = weight;
+  edge->middle = middle;
+  return true;
+}
+
+/**
+    @brief Removes the edge towards a vertex from an overlay list, replacing
+           it with the last edge.
+    @param list Pointer to the list.
+    @param vertex Dense index of the other end of the edge.
+**/
+static void RemoveOverlayEdge(OverlayList* list, unsigned int vertex) {
+  HierarchyEdge* edge = FindOverlayEdge(list, vertex);
+  if (edge != NULL) {
+    *edge = list->edges[--list->count];
+  }
+}
+
+/**
+    @brief Adds an edge to the remaining graph, in the lists of both ends.
+    @param context Pointer to the contraction context.
+    @param from Dense index of the source vertex.
+    @param to Dense index of the destination vertex.
+    @param weight Weight of the edge.
+    @param middle Middle vertex of a shortcut, or NO_SHORTCUT_MIDDLE.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool LinkVertices(ContractionContext* context, unsigned int from,
+                         unsigned int to, unsigned int weight,
+                         unsigned int middle) {
+  unsigned int count = context->out[from].count;
+  if (!AddOverlayEdge(&context->out[from], to, weight, middle) ||
+      !AddOverlayEdge(&context->in[to], from, weight, middle)) {
+    return false;
+  }
+
+  context->numEdges += context->out[from].count - count;
+  return true;
+}
+
+/**
+    @brief Runs a Dijkstra search in the remaining graph which avoids one
+           vertex, stopping once every target is settled, beyond a distance
+           or at its limits. The distances are left in the witness
+           workspace.
+    @param context Pointer to the contraction context.
+    @param source Dense index of the source vertex.
+    @param skip Dense index of the vertex being contracted.
+    @param maxDist Distance beyond which no vertex is settled.
+    @param numTargets Number of vertices marked in isTarget.
+    @param limits Pointer to the work the search may do.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool RunWitnessSearch(ContractionContext* context, unsigned int source,
+                             unsigned int skip, unsigned int maxDist,
+                             unsigned int numTargets,
+                             const WitnessLimits* limits) {
+  DijkstraWorkspace* witness = context->witness;
+  if (!BeginDijkstraQuery(witness, context->numVertices)) {
+    return false;
+  }
+
+  IndexedHeap* heap = GetWorkspaceHeap(witness, false);
+  if (heap == NULL) {
+    return false;
+  }
+
+  ReachVertex(witness, source, 0, UINT_MAX, 0);
+  PushOrImproveKey(heap, source, 0);
+
+  unsigned int settledCount = 0;
+  unsigned int relaxedCount = 0;
+  while (heap->size > 0 && settledCount < limits->settled &&
+         relaxedCount < limits->edges && numTargets > 0) {
+    HeapNode node = ExtractHeapRoot(heap);
+    if (node.weight > maxDist) {
+      break;
+    }
+
+    unsigned int u = node.vertex;
+    witness->settled[u] = witness->generation;
+    settledCount++;
+    if (context->isTarget[u]) {
+      numTargets--;
+    }
+
+    unsigned int hops = witness->hops[u] + 1;
+    if (hops > limits->hops) {
+      continue;
+    }
+
+    const OverlayList* list = &context->out[u];
+    relaxedCount += list->count;
+    for (unsigned int i = 0; i < list->count; i++) {
+      unsigned int v = list->edges[i].vertex;
+      unsigned int newDist = witness->dist[u] + list->edges[i].weight;
+      if (v != skip &&
+          (!IsVertexReached(witness, v) || newDist < witness->dist[v])) {
+        ReachVertex(witness, v, newDist, u, hops);
+        PushOrImproveKey(heap, v, newDist);
+      }
+    }
+  }
+
+  return true;
+}
+
+/**
+    @brief Finds the shortcuts needed to contract a vertex, and adds them to
+           the remaining graph unless the contraction is only simulated.
+
+    @details Every path from an incoming to an outgoing neighbour through the
+             vertex needs a shortcut, unless a witness search from the
+             incoming neighbour finds a path at most as long without it.
+    @param context Pointer to the contraction context.
+    @param v Dense index of the vertex.
+    @param simulate True to only count the shortcuts.
+    @return The number of shortcuts, or -1 if memory allocation fails.
+**/
+static int ContractVertex(ContractionContext* context, unsigned int v,
+                          bool simulate) {
+  const OverlayList* in = &context->in[v];
+  const OverlayList* out = &context->out[v];
+  DijkstraWorkspace* witness = context->witness;
+
+  unsigned int maxOutWeight = 0;
+  for (unsigned int j = 0; j < out->count; j++) {
+    if (out->edges[j].weight > maxOutWeight) {
+      maxOutWeight = out->edges[j].weight;
+    }
+  }
+
+  for (unsigned int j = 0; j < out->count; j++) {
+    context->isTarget[out->edges[j].vertex] = true;
+  }
+
+  int shortcuts = 0;
+  for (unsigned int i = 0; shortcuts >= 0 && i < in->count; i++) {
+    unsigned int u = in->edges[i].vertex;
+    unsigned int toVertex = in->edges[i].weight;
+    if (!RunWitnessSearch(context, u, v, toVertex + maxOutWeight,
+                          out->count,
+                          simulate ? &rankLimits : &contractLimits)) {
+      shortcuts = -1;
+      break;
+    }
+
+    for (unsigned int j = 0; j < out->count; j++) {
+      unsigned int w = out->edges[j].vertex;
+      unsigned int throughVertex = toVertex + out->edges[j].weight;
+      if (w == u || (IsVertexReached(witness, w) &&
+                     witness->dist[w] <= throughVertex)) {
+        continue;
+      }
+
+      if (!simulate && !LinkVertices(context, u, w, throughVertex, v)) {
+        shortcuts = -1;
+        break;
+      }
+      shortcuts++;
+    }
+  }
+
+  for (unsigned int j = 0; j < out->count; j++) {
+    context->isTarget[out->edges[j].vertex] = false;
+  }
+
+  return shortcuts;
+}
+
+/**
+    @brief Computes the priority of a vertex in the contraction order.
+    @param context Pointer to the contraction context.
+    @param v Dense index of the vertex.
+    @param priority Pointer to store the priority.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool ComputePriority(ContractionContext* context, unsigned int v,
+                            unsigned int* priority) {
+  int shortcuts = ContractVertex(context, v, true);
+  if (shortcuts < 0) {
+    return false;
+  }
+
+  // Twice the edge difference with every shortcut counted twice, so
+  // vertices whose contraction densifies the remaining graph wait longer.
+  // On grids and random graphs this adds fewer shortcuts, and builds and
+  // queries faster, than the plain edge difference. The contracted
+  // neighbours spread the order over the graph
+  *priority = HIERARCHY_PRIORITY_BIAS + 4 * (unsigned int)shortcuts +
+              context->contractedNeighbours[v] -
+              2 * (context->in[v].count + context->out[v].count);
+  return true;
+}
+
+/**
+    @brief Contracts the vertices of the remaining graph in priority order,
+           until what remains is a dense core.
+
+    @details Once the vertices left have more than HIERARCHY_CORE_DEGREE
+             edges each on average, every contraction adds about as many
+             shortcuts as it removes edges, and the witness searches grow
+             with the degree. The core then keeps its edges, and its vertices
+             take the highest ranks in priority order.
+    @param graph Pointer to the graph structure.
+    @param context Pointer to the contraction context.
+    @param rank Array to store the position of every vertex in the order.
+    @param coreRank Pointer to store the rank of the first vertex of the
+                    core, the number of ranked vertices if there is none.
+    @param priority Array to store the priority of every vertex.
+    @param heap Empty min-heap for every dense index.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool ContractVertices(const Graph* graph, ContractionContext* context,
+                             unsigned int* rank, unsigned int* coreRank,
+                             unsigned int* priority, IndexedHeap* heap) {
+  for (unsigned int v = 0; v < context->numVertices; v++) {
+    if (graph->vertexByIndex[v] == NULL) {
+      continue;
+    }
+    if (!ComputePriority(context, v, &priority[v])) {
+      return false;
+    }
+    PushOrImproveKey(heap, v, priority[v]);
+  }
+
+  unsigned int order = 0;
+  while (heap->size > 0) {
+    unsigned int v = ExtractHeapRoot(heap).vertex;
+
+    // Contracted neighbours may have raised the priority since it was queued
+    if (heap->size > 0 && priority[v] > PeekHeapRoot(heap).weight) {
+      PushOrImproveKey(heap, v, priority[v]);
+      continue;
+    }
+
+    if (context->numEdges >
+        (size_t)HIERARCHY_CORE_DEGREE * (heap->size + 1)) {
+      *coreRank = order;
+      rank[v] = order++;
+      while (heap->size > 0) {
+        rank[ExtractHeapRoot(heap).vertex] = order++;
+      }
+      return true;
+    }
+
+    if (ContractVertex(context, v, false) < 0) {
+      return false;
+    }
+    rank[v] = order++;
+
+    // Detach the vertex, whose own lists become its final edges
+    const OverlayList* out = &context->out[v];
+    const OverlayList* in = &context->in[v];
+    context->numEdges -= out->count + in->count;
+    for (unsigned int i = 0; i < out->count; i++) {
+      RemoveOverlayEdge(&context->in[out->edges[i].vertex], v);
+      context->contractedNeighbours[out->edges[i].vertex]++;
+    }
+    for (unsigned int i = 0; i < in->count; i++) {
+      RemoveOverlayEdge(&context->out[in->edges[i].vertex], v);
+      context->contractedNeighbours[in->edges[i].vertex]++;
+    }
+
+    // Lower priorities are applied now, higher ones when they are popped.
+    // A neighbour linked both ways is only updated once
+    for (unsigned int side = 0; side < 2; side++) {
+      const OverlayList* list = side == 0 ? out : in;
+      for (unsigned int i = 0; i < list->count; i++) {
+        unsigned int w = list->edges[i].vertex;
+        if (side == 1 && FindOverlayEdge(out, w) != NULL) {
+          continue;
+        }
+        unsigned int newPriority;
+        if (!ComputePriority(context, w, &newPriority)) {
+          return false;
+        }
+        if (newPriority < priority[w]) {
+          PushOrImproveKey(heap, w, newPriority);
+        }
+        priority[w] = newPriority;
+      }
+    }
+  }
+
+  *coreRank = order;
+  return true;
+}
+
+/**
+    @brief Copies the final lists of every vertex into the arrays of a
+           hierarchy.
+    @param context Pointer to the contraction context.
+    @param hierarchy Pointer to the hierarchy, with its rank already set.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool StoreHierarchyEdges(const ContractionContext* context,
+                                ContractionHierarchy* hierarchy) {
+  unsigned int n = context->numVertices;
+  hierarchy->upOffsets =
+      (unsigned int*)malloc(((size_t)n + 1) * sizeof(unsigned int));
+  hierarchy->downOffsets =
+      (unsigned int*)malloc(((size_t)n + 1) * sizeof(unsigned int));
+  if (hierarchy->upOffsets == NULL || hierarchy->downOffsets == NULL) {
+    return false;
+  }
+
+  hierarchy->upOffsets[0] = 0;
+  hierarchy->downOffsets[0] = 0;
+  for (unsigned int v = 0; v < n; v++) {
+    hierarchy->upOffsets[v + 1] =
+        hierarchy->upOffsets[v] + context->out[v].count;
+    hierarchy->downOffsets[v + 1] =
+        hierarchy->downOffsets[v] + context->in[v].count;
+  }
+
+  hierarchy->up = (HierarchyEdge*)malloc(
+      (hierarchy->upOffsets[n] > 0 ? hierarchy->upOffsets[n] : 1) *
+      sizeof(HierarchyEdge));
+  hierarchy->down = (HierarchyEdge*)malloc(
+      (hierarchy->downOffsets[n] > 0 ? hierarchy->downOffsets[n] : 1) *
+      sizeof(HierarchyEdge));
+  if (hierarchy->up == NULL || hierarchy->down == NULL) {
+    return false;
+  }
+
+  for (unsigned int v = 0; v < n; v++) {
+    if (context->out[v].count > 0) {
+      memcpy(&hierarchy->up[hierarchy->upOffsets[v]], context->out[v].edges,
+             context->out[v].count * sizeof(HierarchyEdge));
+    }
+    if (context->in[v].count > 0) {
+      memcpy(&hierarchy->down[hierarchy->downOffsets[v]], context->in[v].edges,
+             context->in[v].count * sizeof(HierarchyEdge));
+    }
+  }
+
+  return true;
+}
+
+/**
+    @brief Builds a contraction hierarchy by contracting the vertices of a
+           graph until the rest is a dense core.
+
+    @details The next vertex is the one with the lowest priority, which is
+             four times the shortcuts its contraction adds, minus twice the
+             edges it removes, plus its neighbours already contracted.
+             Priorities are updated for the neighbours of every contracted
+             vertex, and checked again when a vertex reaches the top of the
+             queue. A shortcut between two neighbours is skipped when a
+             witness search, limited to WITNESS_SETTLE_LIMIT vertices and
+             WITNESS_HOP_LIMIT edges per path, finds a path at most as long
+             which avoids the contracted vertex. The searches which only rank
+             a vertex are bounded tighter. Contraction stops once the
+             vertices left have more than HIERARCHY_CORE_DEGREE edges each on
+             average, which road-like graphs only reach near the top while
+             random graphs keep a large core.
+    @param graph Pointer to the graph structure.
+    @return A pointer to the hierarchy, or NULL if the graph is NULL or memory
+            allocation fails.
+**/
+ContractionHierarchy* BuildContractionHierarchy(const Graph* graph) {
+  if (graph == NULL) {
+    return NULL;
+  }
+
+  ContractionHierarchy* hierarchy =
+      (ContractionHierarchy*)calloc(1, sizeof(ContractionHierarchy));
+  if (hierarchy == NULL) {
+    return NULL;
+  }
+
+  unsigned int n = graph->indexCount;
+  size_t count = n > 0 ? n : 1;
+  hierarchy->numVertices = n;
+  hierarchy->rank = (unsigned int*)malloc(count * sizeof(unsigned int));
+
+  ContractionContext context;
+  context.numVertices = n;
+  context.numEdges = 0;
+  context.out = (OverlayList*)calloc(count, sizeof(OverlayList));
+  context.in = (OverlayList*)calloc(count, sizeof(OverlayList));
+  context.contractedNeighbours =
+      (unsigned int*)calloc(count, sizeof(unsigned int));
+  context.isTarget = (bool*)calloc(count, sizeof(bool));
+  context.witness = CreateDijkstraWorkspace(n);
+  unsigned int* priority = (unsigned int*)malloc(count * sizeof(unsigned int));
+  IndexedHeap* heap = CreateIndexedHeap(n, false);
+
+  bool built = hierarchy->rank != NULL && context.out != NULL &&
+               context.in != NULL && context.contractedNeighbours != NULL &&
+               context.isTarget != NULL && context.witness != NULL &&
+               priority != NULL && heap != NULL;
+
+  // The remaining graph starts as a copy of the graph without its loops
+  for (unsigned int v = 0; built && v < n; v++) {
+    hierarchy->rank[v] = UINT_MAX;
+    const Vertex* vertex = graph->vertexByIndex[v];
+    if (vertex == NULL) {
+      continue;
+    }
+    const EdgeBlock* block = vertex->edges.head;
+    for (; built && block != NULL; block = block->next) {
+      for (unsigned int i = 0; built && i < block->count; i++) {
+        if (block->dest[i] != v) {
+          built = LinkVertices(&context, v, block->dest[i], block->weight[i],
+                               NO_SHORTCUT_MIDDLE);
+        }
+      }
+    }
+  }
+
+  built = built &&
+          ContractVertices(graph, &context, hierarchy->rank,
+                           &hierarchy->coreRank, priority, heap) &&
+          StoreHierarchyEdges(&context, hierarchy);
+
+  if (context.out != NULL && context.in != NULL) {
+    for (unsigned int v = 0; v < n; v++) {
+      free(context.out[v].edges);
+      free(context.in[v].edges);
+    }
+  }
+  free(context.out);
+  free(context.in);
+  free(context.contractedNeighbours);
+  free(context.isTarget);
+  FreeDijkstraWorkspace(context.witness);
+  free(priority);
+  FreeIndexedHeap(heap);
+
+  if (!built) {
+    FreeContractionHierarchy(hierarchy);
+    return NULL;
+  }
+
+  return hierarchy;
+}
+
+/**
+    @brief Frees a contraction hierarchy from memory.
+
+    @param hierarchy Pointer to the hierarchy, ignored if NULL.
+**/
+void FreeContractionHierarchy(ContractionHierarchy* hierarchy) {
+  if (hierarchy == NULL) {
+    return;
+  }
+
+  free(hierarchy->rank);
+  free(hierarchy->upOffsets);
+  free(hierarchy->up);
+  free(hierarchy->downOffsets);
+  free(hierarchy->down);
+  free(hierarchy);
+}
+
+/**
+    @brief Writes the edges of one vertex, with both ends and the middle
+           vertex stored by identifier.
+    @param file Pointer to the file.
+    @param graph Pointer to the graph structure.
+    @param edges Pointer to the first edge.
+    @param count Number of edges.
+    @return True in the case of success, false if writing fails.
+**/
+static bool WriteHierarchyEdges(FILE* file, const Graph* graph,
+                                const HierarchyEdge* edges,
+                                unsigned int count) {
+  for (unsigned int i = 0; i < count; i++) {
+    unsigned int record[3];
+    record[0] = graph->vertexByIndex[edges[i].vertex]->id;
+    record[1] = edges[i].weight;
+    record[2] = edges[i].middle == NO_SHORTCUT_MIDDLE
+                    ? NO_SHORTCUT_MIDDLE
+                    : graph->vertexByIndex[edges[i].middle]->id;
+    if (fwrite(record, sizeof(unsigned int), 3, file) != 3) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+    @brief Saves a contraction hierarchy to a binary file, next to the file of
+           the graph written by SaveGraph. Vertices are stored by identifier,
+           as dense indices change between runs.
+    @param hierarchy Pointer to the hierarchy.
+    @param graph Pointer to the graph the hierarchy was built for.
+    @param filename Name of the file where the hierarchy will be saved.
+    @return EXIT_SUCCESS on success, ERROR_OPENING_FILE if the file cannot be
+            opened or ERROR_WRITING_HIERARCHY if writing fails.
+**/
+int SaveContractionHierarchy(const ContractionHierarchy* hierarchy,
+                             const Graph* graph, const char* filename) {
+  FILE* file = fopen(filename, "wb");
+  if (!file) {
+    return ERROR_OPENING_FILE;
+  }
+
+  // Header with the number of vertices, of edges in each direction and the
+  // first rank of the core
+  unsigned int n = hierarchy->numVertices;
+  unsigned int header[4] = { graph->numVertices, hierarchy->upOffsets[n],
+                             hierarchy->downOffsets[n], hierarchy->coreRank };
+  bool written = fwrite(header, sizeof(unsigned int), 4, file) == 4;
+
+  // Every vertex as its identifier, rank and edge counts, then its edges
+  for (unsigned int v = 0; written && v < n; v++) {
+    const Vertex* vertex = graph->vertexByIndex[v];
+    if (vertex == NULL) {
+      continue;
+    }
+    unsigned int upCount =
+        hierarchy->upOffsets[v + 1] - hierarchy->upOffsets[v];
+    unsigned int downCount =
+        hierarchy->downOffsets[v + 1] - hierarchy->downOffsets[v];
+    unsigned int record[4] = { vertex->id, hierarchy->rank[v], upCount,
+                               downCount };
+    written =
+        fwrite(record, sizeof(unsigned int), 4, file) == 4 &&
+        WriteHierarchyEdges(file, graph,
+                            &hierarchy->up[hierarchy->upOffsets[v]],
+                            upCount) &&
+        WriteHierarchyEdges(file, graph,
+                            &hierarchy->down[hierarchy->downOffsets[v]],
+                            downCount);
+  }
+
+  if (fclose(file) != 0 || !written) {
+    return ERROR_WRITING_HIERARCHY;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+/**
+    @brief Reads the edges of one vertex, mapping every identifier to its
+           dense index in the graph.
+    @param file Pointer to the file.
+    @param graph Pointer to the graph structure.
+    @param edges Pointer to store the edges.
+    @param count Number of edges.
+    @return True in the case of success, false if reading fails or a vertex
+            is not in the graph.
+**/
+static bool ReadHierarchyEdges(FILE* file, const Graph* graph,
+                               HierarchyEdge* edges, unsigned int count) {
+  for (unsigned int i = 0; i < count; i++) {
+    unsigned int record[3];
+    if (fread(record, sizeof(unsigned int), 3, file) != 3) {
+      return false;
+    }
+
+    const Vertex* vertex = FindVertex(graph, record[0]);
+    const Vertex* middle = record[2] == NO_SHORTCUT_MIDDLE
+                               ? NULL
+                               : FindVertex(graph, record[2]);
+    if (vertex == NULL ||
+        (middle == NULL && record[2] != NO_SHORTCUT_MIDDLE)) {
+      return false;
+    }
+
+    edges[i].vertex = vertex->index;
+    edges[i].weight = record[1];
+    edges[i].middle = middle != NULL ? middle->index : NO_SHORTCUT_MIDDLE;
+  }
+
+  return true;
+}
+
+/**
+    @brief Moves edges read in file order into the rows of their vertices.
+    @param n Number of dense indices.
+    @param first Position of the first edge of every vertex in the file.
+    @param offsets Number of edges of every vertex, shifted by one, turned
+                   into the first edge of each vertex.
+    @param edges Pointer to the edges in file order, replaced by the rows.
+    @param total Number of edges.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool SortHierarchyEdges(unsigned int n, const unsigned int* first,
+                               unsigned int* offsets, HierarchyEdge** edges,
+                               unsigned int total) {
+  HierarchyEdge* sorted = (HierarchyEdge*)malloc(
+      (total > 0 ? total : 1) * sizeof(HierarchyEdge));
+  if (sorted == NULL) {
+    return false;
+  }
+
+  for (unsigned int v = 0; v < n; v++) {
+    unsigned int count = offsets[v + 1];
+    offsets[v + 1] = offsets[v] + count;
+    if (count > 0) {
+      memcpy(&sorted[offsets[v]], &(*edges)[first[v]],
+             count * sizeof(HierarchyEdge));
+    }
+  }
+
+  free(*edges);
+  *edges = sorted;
+  return true;
+}
+
+/**
+    @brief Loads a contraction hierarchy saved by SaveContractionHierarchy
+           for a graph, usually the one read back by LoadGraph.
+    @param graph Pointer to the graph, which must have the same vertices as
+                 the saved one.
+    @param filename Name of the binary file.
+    @return A pointer to the hierarchy, or NULL if the file cannot be read or
+            does not describe every vertex of the graph.
+**/
+ContractionHierarchy* LoadContractionHierarchy(const Graph* graph,
+                                               const char* filename) {
+  if (graph == NULL) {
+    return NULL;
+  }
+
+  FILE* file = fopen(filename, "rb");
+  if (!file) {
+    return NULL;
+  }
+
+  unsigned int header[4];
+  if (fread(header, sizeof(unsigned int), 4, file) != 4 ||
+      header[0] != graph->numVertices) {
+    fclose(file);
+    return NULL;
+  }
+
+  ContractionHierarchy* hierarchy =
+      (ContractionHierarchy*)calloc(1, sizeof(ContractionHierarchy));
+  if (hierarchy == NULL) {
+    fclose(file);
+    return NULL;
+  }
+
+  unsigned int n = graph->indexCount;
+  size_t count = n > 0 ? n : 1;
+  hierarchy->numVertices = n;
+  hierarchy->coreRank = header[3];
+  hierarchy->rank = (unsigned int*)malloc(count * sizeof(unsigned int));
+  hierarchy->upOffsets =
+      (unsigned int*)calloc((size_t)n + 1, sizeof(unsigned int));
+  hierarchy->downOffsets =
+      (unsigned int*)calloc((size_t)n + 1, sizeof(unsigned int));
+  hierarchy->up = (HierarchyEdge*)malloc(
+      (header[1] > 0 ? header[1] : 1) * sizeof(HierarchyEdge));
+  hierarchy->down = (HierarchyEdge*)malloc(
+      (header[2] > 0 ? header[2] : 1) * sizeof(HierarchyEdge));
+  unsigned int* upFirst = (unsigned int*)malloc(count * sizeof(unsigned int));
+  unsigned int* downFirst =
+      (unsigned int*)malloc(count * sizeof(unsigned int));
+
+  bool loaded = hierarchy->rank != NULL && hierarchy->upOffsets != NULL &&
+                hierarchy->downOffsets != NULL && hierarchy->up != NULL &&
+                hierarchy->down != NULL && upFirst != NULL &&
+                downFirst != NULL;
+  for (unsigned int v = 0; loaded && v < n; v++) {
+    hierarchy->rank[v] = UINT_MAX;
+  }
+
+  // Edges are read in file order, and counted for the row of their vertex.
+  // As the number of vertices matches, distinct identifiers cover them all
+  unsigned int upRead = 0;
+  unsigned int downRead = 0;
+  for (unsigned int i = 0; loaded && i < header[0]; i++) {
+    unsigned int record[4];
+    const Vertex* vertex = NULL;
+    if (fread(record, sizeof(unsigned int), 4, file) == 4) {
+      vertex = FindVertex(graph, record[0]);
+    }
+    loaded = vertex != NULL && record[2] <= header[1] - upRead &&
+             record[3] <= header[2] - downRead;
+    if (!loaded) {
+      break;
+    }
+
+    unsigned int v = vertex->index;
+    hierarchy->rank[v] = record[1];
+    upFirst[v] = upRead;
+    downFirst[v] = downRead;
+    hierarchy->upOffsets[v + 1] = record[2];
+    hierarchy->downOffsets[v + 1] = record[3];
+    loaded = ReadHierarchyEdges(file, graph, &hierarchy->up[upRead],
+                                record[2]) &&
+             ReadHierarchyEdges(file, graph, &hierarchy->down[downRead],
+                                record[3]);
+    upRead += record[2];
+    downRead += record[3];
+  }
+
+  fclose(file);
+
+  loaded = loaded &&
+           SortHierarchyEdges(n, upFirst, hierarchy->upOffsets,
+                              &hierarchy->up, header[1]) &&
+           SortHierarchyEdges(n, downFirst, hierarchy->downOffsets,
+                              &hierarchy->down, header[2]);
+
+  free(upFirst);
+  free(downFirst);
+
+  if (!loaded) {
+    FreeContractionHierarchy(hierarchy);
+    return NULL;
+  }
+
+  return hierarchy;
+}
+
+/**
+    @brief Records a vertex reached by both sides of a hierarchy query as the
+           meeting vertex, if the path through it is the best so far.
+    @param side Pointer to the workspace of one side.
+    @param other Pointer to the workspace of the other side.
+    @param v Dense index of the vertex.
+    @param bestSum Pointer to the sum of the best path found so far.
+    @param meet Pointer to the vertex where the best path meets.
+**/
+static void MeetHierarchySides(const DijkstraWorkspace* side,
+                               const DijkstraWorkspace* other, unsigned int v,
+                               unsigned long long* bestSum,
+                               unsigned int* meet) {
+  if (IsVertexReached(other, v) &&
+      (unsigned long long)side->dist[v] + other->dist[v] < *bestSum) {
+    *bestSum = (unsigned long long)side->dist[v] + other->dist[v];
+    *meet = v;
+  }
+}
+
+/**
+    @brief Settles the next vertex of one side of a hierarchy query and
+           relaxes its edges towards vertices of higher rank, or its edges
+           in the core.
+    @param hierarchy Pointer to the hierarchy.
+    @param side Pointer to the workspace of the side being expanded.
+    @param other Pointer to the workspace of the other side.
+    @param heap Pointer to the heap of the side being expanded.
+    @param backward True if the side follows downward edges from dest.
+    @param outsideCore Pointer to the number of vertices in the heap which
+                       are not in the core.
+    @param bestSum Pointer to the sum of the best path found so far.
+    @param meet Pointer to the vertex where the best path meets.
+**/
+static void ExpandHierarchySide(const ContractionHierarchy* hierarchy,
+                                DijkstraWorkspace* side,
+                                const DijkstraWorkspace* other,
+                                IndexedHeap* heap, bool backward,
+                                unsigned int* outsideCore,
+                                unsigned long long* bestSum,
+                                unsigned int* meet) {
+  unsigned int u = ExtractHeapRoot(heap).vertex;
+  side->settled[u] = side->generation;
+  if (hierarchy->rank[u] < hierarchy->coreRank) {
+    (*outsideCore)--;
+  }
+
+  MeetHierarchySides(side, other, u, bestSum, meet);
+
+  const unsigned int* offsets =
+      backward ? hierarchy->downOffsets : hierarchy->upOffsets;
+  const HierarchyEdge* edges = backward ? hierarchy->down : hierarchy->up;
+  const unsigned int* otherOffsets =
+      backward ? hierarchy->upOffsets : hierarchy->downOffsets;
+  const HierarchyEdge* otherEdges = backward ? hierarchy->up : hierarchy->down;
+
+  // Stall on demand, a vertex of higher rank reaches u by a shorter path
+  for (unsigned int e = otherOffsets[u]; e < otherOffsets[u + 1]; e++) {
+    unsigned int v = otherEdges[e].vertex;
+    if (IsVertexReached(side, v) &&
+        side->dist[v] + otherEdges[e].weight < side->dist[u]) {
+      return;
+    }
+  }
+
+  for (unsigned int e = offsets[u]; e < offsets[u + 1]; e++) {
+    unsigned int v = edges[e].vertex;
+    unsigned int newDist = side->dist[u] + edges[e].weight;
+    if (IsVertexSettled(side, v)) {
+      continue;
+    }
+
+    if (!IsVertexReached(side, v)) {
+      if (hierarchy->rank[v] < hierarchy->coreRank) {
+        (*outsideCore)++;
+      }
+    } else if (newDist >= side->dist[v]) {
+      continue;
+    }
+
+    ReachVertex(side, v, newDist, u, 0);
+    PushOrImproveKey(heap, v, newDist);
+
+    // Inside the core the sides may cross without settling a common vertex
+    MeetHierarchySides(side, other, v, bestSum, meet);
+  }
+}
+
+/**
+    @brief Finds the edge of a hierarchy between two vertices.
+    @param hierarchy Pointer to the hierarchy.
+    @param from Dense index of the source vertex.
+    @param to Dense index of the destination vertex.
+    @return A pointer to the edge, or NULL if there is none.
+**/
+static const HierarchyEdge* FindHierarchyEdge(
+    const ContractionHierarchy* hierarchy, unsigned int from,
+    unsigned int to) {
+  // An edge is stored at the end of lower rank
+  bool upward = hierarchy->rank[from] < hierarchy->rank[to];
+  unsigned int owner = upward ? from : to;
+  unsigned int other = upward ? to : from;
+  const unsigned int* offsets =
+      upward ? hierarchy->upOffsets : hierarchy->downOffsets;
+  const HierarchyEdge* edges = upward ? hierarchy->up : hierarchy->down;
+
+  for (unsigned int e = offsets[owner]; e < offsets[owner + 1]; e++) {
+    if (edges[e].vertex == other) {
+      return &edges[e];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+    @brief Unpacks an edge of a hierarchy into edges of the graph, and
+           appends every vertex after its source to a path.
+    @param graph Pointer to the graph structure.
+    @param hierarchy Pointer to the hierarchy.
+    @param from Dense index of the source vertex.
+    @param to Dense index of the destination vertex.
+    @param stack Pointer to an empty stack of pending edges.
+    @param path Array to store the identifiers, or NULL to only count them.
+    @param count Pointer to the number of vertices in the path, increased.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool UnpackHierarchyEdge(const Graph* graph,
+                                const ContractionHierarchy* hierarchy,
+                                unsigned int from, unsigned int to,
+                                UnpackStack* stack, unsigned int* path,
+                                unsigned int* count) {
+  stack->pairs[0] = from;
+  stack->pairs[1] = to;
+  stack->size = 1;
+
+  while (stack->size > 0) {
+    stack->size--;
+    unsigned int u = stack->pairs[2 * stack->size];
+    unsigned int v = stack->pairs[2 * stack->size + 1];
+    const HierarchyEdge* edge = FindHierarchyEdge(hierarchy, u, v);
+
+    if (edge == NULL || edge->middle == NO_SHORTCUT_MIDDLE) {
+      if (path != NULL) {
+        path[*count] = graph->vertexByIndex[v]->id;
+      }
+      (*count)++;
+      continue;
+    }
+
+    if (stack->size + 2 > stack->capacity) {
+      unsigned int capacity = stack->capacity * 2;
+      unsigned int* pairs = (unsigned int*)realloc(
+          stack->pairs, 2 * (size_t)capacity * sizeof(unsigned int));
+      if (pairs == NULL) {
+        return false;
+      }
+      stack->pairs = pairs;
+      stack->capacity = capacity;
+    }
+
+    // The second half is pushed first, so the first half is unpacked first
+    unsigned int middle = edge->middle;
+    stack->pairs[2 * stack->size] = middle;
+    stack->pairs[2 * stack->size + 1] = v;
+    stack->pairs[2 * stack->size + 2] = u;
+    stack->pairs[2 * stack->size + 3] = middle;
+    stack->size += 2;
+  }
+
+  return true;
+}
+
+/**
+    @brief Unpacks the path of a hierarchy query into vertices of the graph.
+    @param graph Pointer to the graph structure.
+    @param hierarchy Pointer to the hierarchy.
+    @param forward Pointer to the workspace of the forward search.
+    @param backward Pointer to the workspace of the backward search.
+    @param meet Dense index of the vertex where both searches meet.
+    @param path Pointer to store the path vertices.
+    @param pathLength Pointer to store the length of the path.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool UnpackHierarchyPath(const Graph* graph,
+                                const ContractionHierarchy* hierarchy,
+                                const DijkstraWorkspace* forward,
+                                const DijkstraWorkspace* backward,
+                                unsigned int meet, unsigned int** path,
+                                unsigned int* pathLength) {
+  // Vertices of the hierarchy path, from src to the meeting vertex and on
+  unsigned int* route = NULL;
+  unsigned int hops = 0;
+  if (!BuildIndexPath(forward->prev, backward->prev, meet, &route, &hops)) {
+    return false;
+  }
+
+  UnpackStack stack = { (unsigned int*)malloc(2 * 16 * sizeof(unsigned int)),
+                        0, 16 };
+  if (stack.pairs == NULL) {
+    free(route);
+    return false;
+  }
+
+  // The first pass counts the vertices, the second one stores them
+  bool unpacked = true;
+  unsigned int count = 1;
+  for (unsigned int i = 0; unpacked && i + 1 < hops; i++) {
+    unpacked = UnpackHierarchyEdge(graph, hierarchy, route[i], route[i + 1],
+                                   &stack, NULL, &count);
+  }
+
+  *path = unpacked ? (unsigned int*)malloc(count * sizeof(unsigned int))
+                   : NULL;
+  if (*path != NULL) {
+    (*path)[0] = graph->vertexByIndex[route[0]]->id;
+    count = 1;
+    for (unsigned int i = 0; unpacked && i + 1 < hops; i++) {
+      unpacked = UnpackHierarchyEdge(graph, hierarchy, route[i], route[i + 1],
+                                     &stack, *path, &count);
+    }
+    *pathLength = count;
+  }
+
+  free(route);
+  free(stack.pairs);
+
+  if (*path == NULL || !unpacked) {
+    free(*path);
+    *path = NULL;
+    *pathLength = 0;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+    @brief Runs both searches of a hierarchy query between two vertices, and
+           stores the path if they meet.
+    @param graph Pointer to the graph structure.
+    @param hierarchy Pointer to the hierarchy.
+    @param srcIndex Dense index of the source vertex.
+    @param destIndex Dense index of the destination vertex.
+    @param forward Pointer to the workspace of the forward search.
+    @param minSum Pointer to store the minimum path sum.
+    @param path Pointer to store the shortest path vertices.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, or FAILURE_ALLOCATING_SEARCH if memory
+            allocation fails.
+**/
+static int SearchHierarchy(const Graph* graph,
+                           const ContractionHierarchy* hierarchy,
+                           unsigned int srcIndex, unsigned int destIndex,
+                           DijkstraWorkspace* forward, unsigned int* minSum,
+                           unsigned int** path, unsigned int* pathLength) {
+  DijkstraWorkspace* backward = GetReverseWorkspace(forward);
+  if (backward == NULL ||
+      !BeginDijkstraQuery(forward, graph->indexCount) ||
+      !BeginDijkstraQuery(backward, graph->indexCount)) {
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+
+  // Shortcuts have large weights, so both sides use heaps
+  IndexedHeap* forwardHeap = GetWorkspaceHeap(forward, false);
+  IndexedHeap* backwardHeap = GetWorkspaceHeap(backward, false);
+  if (forwardHeap == NULL || backwardHeap == NULL) {
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+
+  ReachVertex(forward, srcIndex, 0, UINT_MAX, 0);
+  PushOrImproveKey(forwardHeap, srcIndex, 0);
+  ReachVertex(backward, destIndex, 0, UINT_MAX, 0);
+  PushOrImproveKey(backwardHeap, destIndex, 0);
+  unsigned int forwardOutside = hierarchy->rank[srcIndex] < hierarchy->coreRank;
+  unsigned int backwardOutside =
+      hierarchy->rank[destIndex] < hierarchy->coreRank;
+
+  unsigned long long bestSum = ULLONG_MAX;
+  unsigned int meet = UINT_MAX;
+
+  while (true) {
+    // Each side stops once its next vertex is as far as the best path, as
+    // the top of the hierarchy may lie on either side
+    if (forwardHeap->size > 0 &&
+        PeekHeapRoot(forwardHeap).weight >= bestSum) {
+      ClearIndexedHeap(forwardHeap);
+      forwardOutside = 0;
+    }
+    if (backwardHeap->size > 0 &&
+        PeekHeapRoot(backwardHeap).weight >= bestSum) {
+      ClearIndexedHeap(backwardHeap);
+      backwardOutside = 0;
+    }
+    if (forwardHeap->size == 0 && backwardHeap->size == 0) {
+      break;
+    }
+
+    // Once both heaps only hold core vertices, the rest is a bidirectional
+    // search of the core, which stops as soon as the sides cannot improve
+    // the best path together. A side which ran out has reached every vertex
+    // the other one could meet
+    if (forwardOutside == 0 && backwardOutside == 0 &&
+        (forwardHeap->size == 0 || backwardHeap->size == 0 ||
+         (unsigned long long)PeekHeapRoot(forwardHeap).weight +
+                 PeekHeapRoot(backwardHeap).weight >=
+             bestSum)) {
+      break;
+    }
+
+    if (backwardHeap->size == 0 ||
+        (forwardHeap->size > 0 && PeekHeapRoot(forwardHeap).weight <=
+                                      PeekHeapRoot(backwardHeap).weight)) {
+      ExpandHierarchySide(hierarchy, forward, backward, forwardHeap, false,
+                          &forwardOutside, &bestSum, &meet);
+    } else {
+      ExpandHierarchySide(hierarchy, backward, forward, backwardHeap, true,
+                          &backwardOutside, &bestSum, &meet);
+    }
+  }
+
+  if (meet != UINT_MAX) {
+    if (!UnpackHierarchyPath(graph, hierarchy, forward, backward, meet, path,
+                             pathLength)) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
+    *minSum = (unsigned int)bestSum;
+  }
+
+  return SUCCESS_SEARCHING_PATH;
+}
+
+/**
+    @brief Computes the shortest path in a graph with its contraction
+           hierarchy.
+
+    @details A forward search from src follows upward edges and a backward
+             search from dest follows downward edges, so both only climb the
+             hierarchy until they enter the core, where they continue as a
+             bidirectional search. A vertex is not expanded when an edge from
+             a vertex of higher rank shows its distance is not the shortest.
+             The shortcuts of the best path are unpacked into edges of the
+             graph.
+             The hierarchy must be built again after the graph changes, and
+             a vertex it does not cover makes the query run DijkstraMinPath.
+    @param graph Pointer to the graph structure.
+    @param hierarchy Pointer to the hierarchy of the graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraHierarchyMinPath(const Graph* graph,
+                             const ContractionHierarchy* hierarchy,
+                             unsigned int src, unsigned int dest,
+                             DijkstraWorkspace* workspace, unsigned int* minSum,
+                             unsigned int** path, unsigned int* pathLength) {
+  *minSum = UINT_MAX;
+  *path = NULL;
+  *pathLength = 0;
+
+  if (graph == NULL || hierarchy == NULL) {
+    return INVALID_GRAPH;
+  }
+
+  const Vertex* srcVertex = FindVertex(graph, src);
+  const Vertex* destVertex = FindVertex(graph, dest);
+  if (srcVertex == NULL || destVertex == NULL) {
+    return VERTEX_DOES_NOT_EXIST;
+  }
+
+  if (srcVertex->index >= hierarchy->numVertices ||
+      destVertex->index >= hierarchy->numVertices) {
+    DijkstraOptions options = DefaultDijkstraOptions();
+    return DijkstraMinPathWithOptions(graph, src, dest, &options, workspace,
+                                      minSum, path, pathLength);
+  }
+
+  DijkstraWorkspace* used = workspace;
+  if (used == NULL) {
+    used = CreateDijkstraWorkspace(graph->indexCount);
+    if (used == NULL) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
+  }
+
+  int result = SearchHierarchy(graph, hierarchy, srcVertex->index,
+                               destVertex->index, used, minSum, path,
+                               pathLength);
+
+  if (workspace == NULL) {
+    FreeDijkstraWorkspace(used);
+  }
+
+  return result;
+}
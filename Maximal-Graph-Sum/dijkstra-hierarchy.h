@@ -0,0 +1,117 @@
+/**
+
+    @file      dijkstra-hierarchy.h
+    @brief     Function definitions for contraction hierarchies, preprocessed
+               graphs which answer shortest path queries with two small
+               Dijkstra searches.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef DIJKSTRA_HIERARCHY_H
+#define DIJKSTRA_HIERARCHY_H
+
+#include "dijkstra-structure.h"
+#include "graph.h"
+
+#define WITNESS_SETTLE_LIMIT 64  // Vertices settled by each witness search
+#define WITNESS_HOP_LIMIT 8      // Edges on the paths it follows
+#define WITNESS_SIMULATE_SETTLE_LIMIT 16  // Same, when only ranking a vertex
+#define WITNESS_SIMULATE_EDGE_LIMIT 100   // Edges relaxed when ranking a vertex
+#define WITNESS_SIMULATE_HOP_LIMIT 3      // Edges on the paths it follows
+#define HIERARCHY_CORE_DEGREE 12  // Average degree which stops contraction
+#define HIERARCHY_PRIORITY_BIAS 0x40000000  // Keeps every priority positive
+
+#define ERROR_OPENING_FILE -1
+#define ERROR_WRITING_HIERARCHY -6
+
+/**
+    @brief Builds a contraction hierarchy by contracting the vertices of a
+           graph until the rest is a dense core.
+
+    @details The next vertex is the one with the lowest priority, which is
+             four times the shortcuts its contraction adds, minus twice the
+             edges it removes, plus its neighbours already contracted.
+             Priorities are updated for the neighbours of every contracted
+             vertex, and checked again when a vertex reaches the top of the
+             queue. A shortcut between two neighbours is skipped when a
+             witness search, limited to WITNESS_SETTLE_LIMIT vertices and
+             WITNESS_HOP_LIMIT edges per path, finds a path at most as long
+             which avoids the contracted vertex. The searches which only rank
+             a vertex are bounded tighter. Contraction stops once the
+             vertices left have more than HIERARCHY_CORE_DEGREE edges each on
+             average, which road-like graphs only reach near the top while
+             random graphs keep a large core.
+    @param graph Pointer to the graph structure.
+    @return A pointer to the hierarchy, or NULL if the graph is NULL or memory
+            allocation fails.
+**/
+ContractionHierarchy* BuildContractionHierarchy(const Graph* graph);
+
+/**
+    @brief Frees a contraction hierarchy from memory.
+
+    @param hierarchy Pointer to the hierarchy, ignored if NULL.
+**/
+void FreeContractionHierarchy(ContractionHierarchy* hierarchy);
+
+/**
+    @brief Saves a contraction hierarchy to a binary file, next to the file of
+           the graph written by SaveGraph. Vertices are stored by identifier,
+           as dense indices change between runs.
+    @param hierarchy Pointer to the hierarchy.
+    @param graph Pointer to the graph the hierarchy was built for.
+    @param filename Name of the file where the hierarchy will be saved.
+    @return EXIT_SUCCESS on success, ERROR_OPENING_FILE if the file cannot be
+            opened or ERROR_WRITING_HIERARCHY if writing fails.
+**/
+int SaveContractionHierarchy(const ContractionHierarchy* hierarchy,
+                             const Graph* graph, const char* filename);
+
+/**
+    @brief Loads a contraction hierarchy saved by SaveContractionHierarchy
+           for a graph, usually the one read back by LoadGraph.
+    @param graph Pointer to the graph, which must have the same vertices as
+                 the saved one.
+    @param filename Name of the binary file.
+    @return A pointer to the hierarchy, or NULL if the file cannot be read or
+            does not describe every vertex of the graph.
+**/
+ContractionHierarchy* LoadContractionHierarchy(const Graph* graph,
+                                               const char* filename);
+
+/**
+    @brief Computes the shortest path in a graph with its contraction
+           hierarchy.
+
+    @details A forward search from src follows upward edges and a backward
+             search from dest follows downward edges, so both only climb the
+             hierarchy until they enter the core, where they continue as a
+             bidirectional search. A vertex is not expanded when an edge from
+             a vertex of higher rank shows its distance is not the shortest.
+             The shortcuts of the best path are unpacked into edges of the
+             graph.
+             The hierarchy must be built again after the graph changes, and
+             a vertex it does not cover makes the query run DijkstraMinPath.
+    @param graph Pointer to the graph structure.
+    @param hierarchy Pointer to the hierarchy of the graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraHierarchyMinPath(const Graph* graph,
+                             const ContractionHierarchy* hierarchy,
+                             unsigned int src, unsigned int dest,
+                             DijkstraWorkspace* workspace, unsigned int* minSum,
+                             unsigned int** path, unsigned int* pathLength);
+
+#endif  // !DIJKSTRA_HIERARCHY_H
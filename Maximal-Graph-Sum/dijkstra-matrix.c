@@ -0,0 +1,210 @@
+/**
+
+    @file      dijkstra-matrix.c
+    @brief     Function implementations for computing the shortest distances
+               between many sources and many targets.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#include "dijkstra-matrix.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "dijkstra-queue.h"
+#include "dijkstra-workspace.h"
+#include "parallel.h"
+#include "vertices.h"
+
+/**
+    @struct MatrixContext
+    @brief  State shared by the threads computing a distance matrix.
+**/
+typedef struct MatrixContext {
+  const Graph* graph;                         // Graph being searched
+  const unsigned int* srcIndex;               // Dense index of every source
+  const unsigned int* destIndex;              // Dense index of every target
+  unsigned int ndst;                          // Number of targets
+  const bool* isTarget;                       // True for every target index
+  unsigned int numTargets;                    // Distinct targets to settle
+  unsigned int* out;                          // Distances, one row per source
+  DijkstraWorkspace* workspace[MAX_THREADS];  // Workspace of every task
+  bool failed[MAX_THREADS];                   // Set by a task whose queue
+                                              // could not be allocated
+} MatrixContext;
+
+/**
+    @brief Fills the row of one source, searching until every target is
+           settled or no vertex is left.
+    @param argument Pointer to the context of the matrix.
+    @param task Number of the task, which owns a workspace.
+    @param item Position of the source in the row order.
+**/
+static void ComputeMatrixRow(void* argument, unsigned int task,
+                             unsigned int item) {
+  MatrixContext* context = (MatrixContext*)argument;
+  const Graph* graph = context->graph;
+  DijkstraWorkspace* workspace = context->workspace[task];
+  unsigned int* row = context->out + (size_t)item * context->ndst;
+
+  MinQueue queue;
+  if (!BeginDijkstraQuery(workspace, graph->indexCount) ||
+      !GetWorkspaceMinQueue(workspace, DIJKSTRA_QUEUE_AUTO,
+                            graph->maxEdgeWeight, &queue)) {
+    context->failed[task] = true;
+    return;
+  }
+
+  unsigned int* dist = workspace->dist;
+  unsigned int generation = workspace->generation;
+  unsigned int srcIndex = context->srcIndex[item];
+
+  ReachVertex(workspace, srcIndex, 0, UINT_MAX, 0);
+  PushMinQueue(&queue, srcIndex, 0);
+
+  unsigned int remaining = context->numTargets;
+  while (MinQueueSize(&queue) > 0) {
+    unsigned int u = PopMinQueue(&queue);
+    workspace->settled[u] = generation;
+
+    // Vertices settled later are farther than every target
+    if (context->isTarget[u] && --remaining == 0) {
+      break;
+    }
+
+    const EdgeBlock* block = graph->vertexByIndex[u]->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        unsigned int v = block->dest[i];
+        unsigned int newDist = dist[u] + block->weight[i];
+
+        if (!IsVertexSettled(workspace, v) &&
+            (!IsVertexReached(workspace, v) || newDist < dist[v])) {
+          ReachVertex(workspace, v, newDist, u, 0);
+          PushMinQueue(&queue, v, newDist);
+        }
+      }
+    }
+  }
+
+  for (unsigned int j = 0; j < context->ndst; j++) {
+    unsigned int v = context->destIndex[j];
+    row[j] = IsVertexSettled(workspace, v) ? dist[v] : UINT_MAX;
+  }
+}
+
+/**
+    @brief Finds the dense index of every vertex of a list.
+    @param graph Pointer to the graph structure.
+    @param ids Array of vertex identifiers.
+    @param count Number of identifiers.
+    @param indices Array to store the dense index of every vertex.
+    @return True in the case of success, false if a vertex does not exist.
+**/
+static bool FindVertexIndices(const Graph* graph, const unsigned int* ids,
+                              unsigned int count, unsigned int* indices) {
+  for (unsigned int i = 0; i < count; i++) {
+    const Vertex* vertex = FindVertex(graph, ids[i]);
+    if (vertex == NULL) {
+      return false;
+    }
+    indices[i] = vertex->index;
+  }
+  return true;
+}
+
+/**
+    @brief Computes the shortest distance from every source to every target
+           of a graph.
+
+    @details A single Dijkstra search is run from each source, and stops as
+             soon as every target is settled instead of exploring the whole
+             graph. Sources are spread over GetThreadCount threads, each one
+             taking the next source when it finishes, and every thread reuses
+             its own workspace across its searches.
+    @param graph Pointer to the graph structure.
+    @param srcs Array of source vertex identifiers.
+    @param nsrc Number of sources.
+    @param dsts Array of target vertex identifiers.
+    @param ndst Number of targets.
+    @param out Array of nsrc * ndst entries to store the distances, row by
+               row, the one from srcs[i] to dsts[j] at i * ndst + j. It is
+               UINT_MAX when there is no path.
+    @return SUCCESS_SEARCHING_PATH, INVALID_GRAPH, VERTEX_DOES_NOT_EXIST or
+            FAILURE_ALLOCATING_SEARCH.
+**/
+int DistanceMatrix(const Graph* graph, const unsigned int* srcs,
+                   unsigned int nsrc, const unsigned int* dsts,
+                   unsigned int ndst, unsigned int* out) {
+  if (graph == NULL) {
+    return INVALID_GRAPH;
+  }
+  if (nsrc == 0 || ndst == 0) {
+    return SUCCESS_SEARCHING_PATH;
+  }
+
+  unsigned int* srcIndex = (unsigned int*)malloc(nsrc * sizeof(unsigned int));
+  unsigned int* destIndex =
+      (unsigned int*)malloc(ndst * sizeof(unsigned int));
+  bool* isTarget = (bool*)calloc(graph->indexCount, sizeof(bool));
+  if (srcIndex == NULL || destIndex == NULL || isTarget == NULL) {
+    free(srcIndex);
+    free(destIndex);
+    free(isTarget);
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+
+  if (!FindVertexIndices(graph, srcs, nsrc, srcIndex) ||
+      !FindVertexIndices(graph, dsts, ndst, destIndex)) {
+    free(srcIndex);
+    free(destIndex);
+    free(isTarget);
+    return VERTEX_DOES_NOT_EXIST;
+  }
+
+  MatrixContext context = { 0 };
+  context.graph = graph;
+  context.srcIndex = srcIndex;
+  context.destIndex = destIndex;
+  context.ndst = ndst;
+  context.isTarget = isTarget;
+  context.out = out;
+
+  // A target listed twice is settled once
+  for (unsigned int j = 0; j < ndst; j++) {
+    if (!isTarget[destIndex[j]]) {
+      isTarget[destIndex[j]] = true;
+      context.numTargets++;
+    }
+  }
+
+  unsigned int numTasks = GetThreadCount();
+  if (numTasks > nsrc) {
+    numTasks = nsrc;
+  }
+
+  bool success = true;
+  for (unsigned int task = 0; task < numTasks && success; task++) {
+    context.workspace[task] = CreateDijkstraWorkspace(graph->indexCount);
+    success = context.workspace[task] != NULL;
+  }
+
+  if (success) {
+    ParallelForItems(nsrc, numTasks, ComputeMatrixRow, &context);
+    for (unsigned int task = 0; task < numTasks; task++) {
+      success = success && !context.failed[task];
+    }
+  }
+
+  for (unsigned int task = 0; task < numTasks; task++) {
+    FreeDijkstraWorkspace(context.workspace[task]);
+  }
+  free(srcIndex);
+  free(destIndex);
+  free(isTarget);
+
+  return success ? SUCCESS_SEARCHING_PATH : FAILURE_ALLOCATING_SEARCH;
+}
@@ -0,0 +1,40 @@
+/**
+
+    @file      dijkstra-matrix.h
+    @brief     Function definitions for computing the shortest distances
+               between many sources and many targets.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef DIJKSTRA_MATRIX_H
+#define DIJKSTRA_MATRIX_H
+
+#include "graph.h"
+
+/**
+    @brief Computes the shortest distance from every source to every target
+           of a graph.
+
+    @details A single Dijkstra search is run from each source, and stops as
+             soon as every target is settled instead of exploring the whole
+             graph. Sources are spread over GetThreadCount threads, each one
+             taking the next source when it finishes, and every thread reuses
+             its own workspace across its searches.
+    @param graph Pointer to the graph structure.
+    @param srcs Array of source vertex identifiers.
+    @param nsrc Number of sources.
+    @param dsts Array of target vertex identifiers.
+    @param ndst Number of targets.
+    @param out Array of nsrc * ndst entries to store the distances, row by
+               row, the one from srcs[i] to dsts[j] at i * ndst + j. It is
+               UINT_MAX when there is no path.
+    @return SUCCESS_SEARCHING_PATH, INVALID_GRAPH, VERTEX_DOES_NOT_EXIST or
+            FAILURE_ALLOCATING_SEARCH.
+**/
+int DistanceMatrix(const Graph* graph, const unsigned int* srcs,
+                   unsigned int nsrc, const unsigned int* dsts,
+                   unsigned int ndst, unsigned int* out);
+
+#endif  // !DIJKSTRA_MATRIX_H
@@ -15,226 +15,357 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-#include "dijkstra-structure.h"
+#include "dijkstra-heap.h"
+#include "dijkstra-workspace.h"
+#include "graph-snapshot.h"
+#include "search-path.h"
 #include "vertices.h"
 
 /**
-    @brief Creates a new MaxHeap with the specified capacity.
-    @param capacity The initial capacity of the MaxHeap.
-    @return A pointer to the newly created MaxHeap, or NULL if memory allocation
-            fails.
+    @brief Runs a longest path search between two vertices of a graph, and
+           stores the path if the destination is reached.
+    @param graph Pointer to the graph structure.
+    @param srcIndex Dense index of the source vertex.
+    @param destIndex Dense index of the destination vertex.
+    @param workspace Pointer to the workspace of the search.
+    @param maxWeight Pointer to store the maximum path weight.
+    @param path Pointer to store the path vertices with maximum weight.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, or FAILURE_ALLOCATING_SEARCH if memory
+            allocation fails.
 **/
-MaxHeap* CreateMaxHeap(unsigned int capacity) {
-  MaxHeap* heap = (MaxHeap*)malloc(sizeof(MaxHeap));
-  if (heap == NULL) {
-    return NULL;
+static int SearchMaxPath(const Graph* graph, unsigned int srcIndex,
+                         unsigned int destIndex, DijkstraWorkspace* workspace,
+                         unsigned int* maxWeight, unsigned int** path,
+                         unsigned int* pathLength) {
+  // Arrays are indexed by dense index, so their size follows the vertices
+  if (!BeginDijkstraQuery(workspace, graph->indexCount)) {
+    return FAILURE_ALLOCATING_SEARCH;
   }
 
-  heap->nodes = (HeapNode*)malloc(capacity * sizeof(HeapNode));
-  if (heap->nodes == NULL) {
-    free(heap);
-    return NULL;
+  IndexedHeap* maxHeap = GetWorkspaceHeap(workspace, true);
+  if (maxHeap == NULL) {
+    return FAILURE_ALLOCATING_SEARCH;
   }
 
-  heap->size = 0;
-  heap->capacity = capacity;
-  return heap;
+  unsigned int* dist = workspace->dist;
+  unsigned int* prev = workspace->prev;
+  unsigned int generation = workspace->generation;
+
+  ReachVertex(workspace, srcIndex, 0, UINT_MAX, 0);
+  PushOrImproveKey(maxHeap, srcIndex, 0);
+
+  while (maxHeap->size > 0) {
+    unsigned int u = ExtractHeapRoot(maxHeap).vertex;
+
+    // The heap holds each vertex once, never stale
+    workspace->settled[u] = generation;
+
+    const EdgeBlock* block = graph->vertexByIndex[u]->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        unsigned int v = block->dest[i];
+        unsigned int newDist = dist[u] + block->weight[i];
+
+        // Unreached vertices start with a distance of 0
+        if (!IsVertexSettled(workspace, v) &&
+            newDist > (IsVertexReached(workspace, v) ? dist[v] : 0)) {
+          ReachVertex(workspace, v, newDist, u, 0);
+          PushOrImproveKey(maxHeap, v, newDist);
+        }
+      }
+    }
+  }
+
+  if (IsVertexReached(workspace, destIndex)) {
+    if (!BuildPathFromPrev(graph, prev, destIndex, path, pathLength)) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
+    *maxWeight = dist[destIndex];
+  }
+
+  return SUCCESS_SEARCHING_PATH;
 }
 
 /**
-    @brief Swaps two HeapNode elements.
-
-    @param a Pointer to the first HeapNode.
-    @param b Pointer to the second HeapNode.
+    @brief Finds the path with maximum weight in a graph using a modified
+           Dijkstra's algorithm.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices with maximum weight, NULL if
+                there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void SwapHeapNodeMaxHeap(HeapNode* a, HeapNode* b) {
-  HeapNode temp = *a;
-  *a = *b;
-  *b = temp;
+int DijkstraMaxPath(const Graph* graph, unsigned int src, unsigned int dest,
+  unsigned int* maxWeight, unsigned int** path,
+  unsigned int* pathLength) {
+  return DijkstraMaxPathWithWorkspace(graph, src, dest, NULL, maxWeight, path,
+                                      pathLength);
 }
 
 /**
-    @brief Maintains heap property for a given node.
-
-    @param heap Pointer to the MaxHeap.
-    @param idx Index of the node to start heapifying from.
+    @brief Finds the path with maximum weight in a graph using a modified
+           Dijkstra's algorithm, reusing the memory of a workspace.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices with maximum weight, NULL if
+                there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void MaxHeapify(MaxHeap* heap, int idx) {
-  int largest = idx;
-  int left = 2 * idx + 1;
-  int right = 2 * idx + 2;
-
-  if (left < heap->size &&
-    heap->nodes[left].weight > heap->nodes[largest].weight) {
-    largest = left;
-  }
-  if (right < heap->size &&
-    heap->nodes[right].weight > heap->nodes[largest].weight) {
-    largest = right;
+int DijkstraMaxPathWithWorkspace(const Graph* graph, unsigned int src,
+                                 unsigned int dest,
+                                 DijkstraWorkspace* workspace,
+                                 unsigned int* maxWeight, unsigned int** path,
+                                 unsigned int* pathLength) {
+  *maxWeight = 0;
+  *path = NULL;
+  *pathLength = 0;
+
+  if (graph == NULL) {
+    return INVALID_GRAPH;
   }
-  if (largest != idx) {
-    SwapHeapNodeMaxHeap(&heap->nodes[idx], &heap->nodes[largest]);
-    MaxHeapify(heap, largest);
+
+  const Vertex* srcVertex = FindVertex(graph, src);
+  const Vertex* destVertex = FindVertex(graph, dest);
+  if (srcVertex == NULL || destVertex == NULL) {
+    return VERTEX_DOES_NOT_EXIST;
   }
-}
 
-/**
-    @brief Extracts the maximum node (root) from the MaxHeap.
+  DijkstraWorkspace* used = workspace;
+  if (used == NULL) {
+    used = CreateDijkstraWorkspace(graph->indexCount);
+    if (used == NULL) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
+  }
 
-    @param heap Pointer to the MaxHeap.
+  int result = SearchMaxPath(graph, srcVertex->index, destVertex->index, used,
+                             maxWeight, path, pathLength);
 
-    @return The maximum HeapNode extracted from the heap.
-**/
-HeapNode ExtractMax(MaxHeap* heap) {
-  if (heap->size == 0) {
-    HeapNode emptyNode = { 0, 0 };
-    return emptyNode;
+  if (workspace == NULL) {
+    FreeDijkstraWorkspace(used);
   }
 
-  HeapNode root = heap->nodes[0];
-  heap->nodes[0] = heap->nodes[heap->size - 1];
-  heap->size--;
-  MaxHeapify(heap, 0);
-
-  return root;
+  return result;
 }
 
 /**
-    @brief Ensures the capacity of the MaxHeap.
-
-    @param heap Pointer to the MaxHeap.
+    @brief Runs a longest path search between two vertices of a read-only
+           snapshot, and stores the path if the destination is reached.
+           Shared by the frozen and compressed variants, which only differ in
+           how the outgoing edges of a vertex are read.
+    @param snapshot Pointer to the snapshot.
+    @param srcIndex Dense index of the source vertex.
+    @param destIndex Dense index of the destination vertex.
+    @param workspace Pointer to the workspace of the search.
+    @param maxWeight Pointer to store the maximum path weight.
+    @param path Pointer to store the path vertices.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, or FAILURE_ALLOCATING_SEARCH if memory
+            allocation fails.
 **/
-void EnsureCapacityMaxHeap(MaxHeap* heap) {
-  if (heap->size == heap->capacity) {
-    heap->capacity *= 2;
-    HeapNode* new_nodes =
-      (HeapNode*)realloc(heap->nodes, heap->capacity * sizeof(HeapNode));
-    if (new_nodes == NULL) {
-      exit(EXIT_FAILURE);
-    }
-    heap->nodes = new_nodes;
+static int SearchMaxSnapshot(const GraphSnapshot* snapshot,
+                             unsigned int srcIndex, unsigned int destIndex,
+                             DijkstraWorkspace* workspace,
+                             unsigned int* maxWeight, unsigned int** path,
+                             unsigned int* pathLength) {
+  if (!BeginDijkstraQuery(workspace, snapshot->numVertices)) {
+    return FAILURE_ALLOCATING_SEARCH;
   }
-}
 
-/**
-    @brief Inserts a new node into the MaxHeap.
-
-    @param heap Pointer to the MaxHeap.
-    @param vertex Vertex index to insert.
-    @param weight Weight associated with the vertex.
+  IndexedHeap* maxHeap = GetWorkspaceHeap(workspace, true);
+  if (maxHeap == NULL) {
+    return FAILURE_ALLOCATING_SEARCH;
+  }
 
-    @note If the heap is full, it will be resized to accommodate more elements.
-**/
-void InsertNodeMaxHeap(MaxHeap* heap, unsigned int vertex,
-  unsigned int weight) {
-  EnsureCapacityMaxHeap(heap);
+  unsigned int* dist = workspace->dist;
+  unsigned int* prev = workspace->prev;
+  unsigned int generation = workspace->generation;
 
-  int i = heap->size;
-  heap->size++;
+  ReachVertex(workspace, srcIndex, 0, UINT_MAX, 0);
+  PushOrImproveKey(maxHeap, srcIndex, 0);
 
-  heap->nodes[i].vertex = vertex;
-  heap->nodes[i].weight = weight;
+  while (maxHeap->size > 0) {
+    unsigned int u = ExtractHeapRoot(maxHeap).vertex;
+
+    // The heap holds each vertex once, never stale
+    workspace->settled[u] = generation;
+
+    SnapshotEdges edges = BeginSnapshotEdges(snapshot, u);
+    unsigned int v;
+    unsigned int weight;
+    while (NextSnapshotEdge(&edges, &v, &weight)) {
+      unsigned int newDist = dist[u] + weight;
+
+      // Unreached vertices start with a distance of 0
+      if (!IsVertexSettled(workspace, v) &&
+          newDist > (IsVertexReached(workspace, v) ? dist[v] : 0)) {
+        ReachVertex(workspace, v, newDist, u, 0);
+        PushOrImproveKey(maxHeap, v, newDist);
+      }
+    }
+  }
 
-  // Perform heapify-up
-  while (i != 0 && heap->nodes[(i - 1) / 2].weight < heap->nodes[i].weight) {
-    SwapHeapNodeMaxHeap(&heap->nodes[i], &heap->nodes[(i - 1) / 2]);
-    i = (i - 1) / 2;
+  if (IsVertexReached(workspace, destIndex)) {
+    if (!BuildSnapshotPathFromPrev(snapshot->ids, prev, destIndex, path,
+                                   pathLength)) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
+    *maxWeight = dist[destIndex];
   }
+
+  return SUCCESS_SEARCHING_PATH;
 }
 
 /**
-    @brief Finds the path with maximum weight in a graph using a modified
-           Dijkstra's algorithm.
-    @param graph Pointer to the graph structure.
-    @param src Source vertex index.
-    @param dest Destination vertex index.
+    @brief Finds the path with maximum weight in a read-only snapshot, reusing
+           the memory of a workspace.
+    @param snapshot Pointer to the snapshot.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
     @param maxWeight Pointer to store the maximum path weight.
-    @param path Pointer to store the path vertices with maximum weight.
+    @param path Pointer to store the path vertices.
     @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void DijkstraMaxPath(const Graph* graph, unsigned int src, unsigned int dest,
-  unsigned int* maxWeight, unsigned int** path,
-  unsigned int* pathLength) {
-  unsigned int* dist =
-    (unsigned int*)malloc(graph->hashSize * sizeof(unsigned int));
-  if (dist == NULL) {
-    exit(EXIT_FAILURE);
-  }
-  bool* visited = (bool*)malloc(graph->hashSize * sizeof(bool));
-  if (visited == NULL) {
-    exit(EXIT_FAILURE);
-  }
-
-  unsigned int* prev =
-    (unsigned int*)malloc(graph->hashSize * sizeof(unsigned int));
-  if (prev == NULL) {
-    exit(EXIT_FAILURE);
-  }
-
-  for (unsigned int i = 0; i < graph->hashSize; i++) {
-    dist[i] = 0;  // Start with 0 distance
-    visited[i] = false;
-    prev[i] = UINT_MAX;
+static int FindMaxSnapshotPath(const GraphSnapshot* snapshot, unsigned int src,
+                               unsigned int dest, DijkstraWorkspace* workspace,
+                               unsigned int* maxWeight, unsigned int** path,
+                               unsigned int* pathLength) {
+  *maxWeight = 0;
+  *path = NULL;
+  *pathLength = 0;
+
+  unsigned int srcIndex = FindSnapshotIndex(snapshot, src);
+  unsigned int destIndex = FindSnapshotIndex(snapshot, dest);
+  if (srcIndex == NO_VERTEX_INDEX || destIndex == NO_VERTEX_INDEX) {
+    return VERTEX_DOES_NOT_EXIST;
   }
 
-  MaxHeap* maxHeap = CreateMaxHeap(graph->hashSize);
-  if (maxHeap == NULL) {
-    exit(EXIT_FAILURE);
+  DijkstraWorkspace* used = workspace;
+  if (used == NULL) {
+    used = CreateDijkstraWorkspace(snapshot->numVertices);
+    if (used == NULL) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
   }
 
-  InsertNodeMaxHeap(maxHeap, src, 0);
-  dist[src] = 0;
+  int result = SearchMaxSnapshot(snapshot, srcIndex, destIndex, used,
+                                 maxWeight, path, pathLength);
 
-  while (maxHeap->size > 0) {
-    HeapNode maxNode = ExtractMax(maxHeap);
-    unsigned int u = maxNode.vertex;
-
-    if (visited[u]) {
-      continue;
-    }
-    visited[u] = true;
-
-    Vertex* vertex = FindVertex(graph, u);
-    if (vertex) {
-      Edge* edge = vertex->edges;
-      while (edge != NULL) {
-        unsigned int v = edge->dest;
-        unsigned int weight = edge->weight;
-
-        if (!visited[v] && dist[u] + weight > dist[v]) {
-          dist[v] = dist[u] + weight;
-          prev[v] = u;
-          InsertNodeMaxHeap(maxHeap, v, dist[v]);
-        }
-        edge = edge->next;
-      }
-    }
+  if (workspace == NULL) {
+    FreeDijkstraWorkspace(used);
   }
 
-  *maxWeight = dist[dest];
+  return result;
+}
 
-  // Reconstruct the path
-  unsigned int count = 0;
-  for (unsigned int v = dest; v != UINT_MAX; v = prev[v]) {
-    count++;
-  }
+/**
+    @brief Finds the path with maximum weight in a frozen CSR snapshot using a
+           modified Dijkstra's algorithm.
+    @param frozen Pointer to the frozen graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices, NULL if there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraMaxPathFrozen(const FrozenGraph* frozen, unsigned int src,
+                         unsigned int dest, unsigned int* maxWeight,
+                         unsigned int** path, unsigned int* pathLength) {
+  return DijkstraMaxPathFrozenWithWorkspace(frozen, src, dest, NULL, maxWeight,
+                                            path, pathLength);
+}
 
-  *path = (unsigned int*)malloc(count * sizeof(unsigned int));
-  if (*path == NULL) {
-    exit(EXIT_FAILURE);
-  }
+/**
+    @brief Finds the path with maximum weight in a frozen CSR snapshot using a
+           modified Dijkstra's algorithm, reusing the memory of a workspace.
+    @param frozen Pointer to the frozen graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices, NULL if there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraMaxPathFrozenWithWorkspace(const FrozenGraph* frozen,
+                                       unsigned int src, unsigned int dest,
+                                       DijkstraWorkspace* workspace,
+                                       unsigned int* maxWeight,
+                                       unsigned int** path,
+                                       unsigned int* pathLength) {
+  GraphSnapshot snapshot = ViewFrozenGraph(frozen);
+  return FindMaxSnapshotPath(&snapshot, src, dest, workspace, maxWeight, path,
+                             pathLength);
+}
 
-  unsigned int idx = count - 1;
-  for (unsigned int v = dest; v != UINT_MAX; v = prev[v]) {
-    (*path)[idx--] = v;
-  }
-  *pathLength = count;
+/**
+    @brief Finds the path with maximum weight in a compressed snapshot using a
+           modified Dijkstra's algorithm.
+    @param compressed Pointer to the compressed graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices, NULL if there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraMaxPathCompressed(const CompressedGraph* compressed,
+                             unsigned int src, unsigned int dest,
+                             unsigned int* maxWeight, unsigned int** path,
+                             unsigned int* pathLength) {
+  return DijkstraMaxPathCompressedWithWorkspace(compressed, src, dest, NULL,
+                                                maxWeight, path, pathLength);
+}
 
-  free(dist);
-  free(visited);
-  free(prev);
-  free(maxHeap->nodes);
-  free(maxHeap);
+/**
+    @brief Finds the path with maximum weight in a compressed snapshot using a
+           modified Dijkstra's algorithm, reusing the memory of a workspace.
+    @param compressed Pointer to the compressed graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices, NULL if there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraMaxPathCompressedWithWorkspace(const CompressedGraph* compressed,
+                                           unsigned int src, unsigned int dest,
+                                           DijkstraWorkspace* workspace,
+                                           unsigned int* maxWeight,
+                                           unsigned int** path,
+                                           unsigned int* pathLength) {
+  GraphSnapshot snapshot = ViewCompressedGraph(compressed);
+  return FindMaxSnapshotPath(&snapshot, src, dest, workspace, maxWeight, path,
+                             pathLength);
 }
 
 /**
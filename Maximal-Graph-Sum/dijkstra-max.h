@@ -15,69 +15,123 @@
 #include "graph.h"
 
 /**
-    @brief Creates a new MaxHeap with the specified capacity.
-    @param capacity The initial capacity of the MaxHeap.
-    @return A pointer to the newly created MaxHeap, or NULL if memory allocation
-            fails.
-**/
-MaxHeap* CreateMaxHeap(unsigned int capacity);
-
-/**
-    @brief Swaps two HeapNode elements.
-
-    @param a Pointer to the first HeapNode.
-    @param b Pointer to the second HeapNode.
+    @brief Finds the path with maximum weight in a graph using a modified
+           Dijkstra's algorithm.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices with maximum weight, NULL if
+                there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void SwapHeapNodeMaxHeap(HeapNode* a, HeapNode* b);
+int DijkstraMaxPath(const Graph* graph, unsigned int src, unsigned int dest,
+  unsigned int* maxWeight, unsigned int** path,
+  unsigned int* pathLength);
 
 /**
-    @brief Maintains heap property for a given node.
-
-    @param heap Pointer to the MaxHeap.
-    @param idx Index of the node to start heapifying from.
+    @brief Finds the path with maximum weight in a graph using a modified
+           Dijkstra's algorithm, reusing the memory of a workspace.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices with maximum weight, NULL if
+                there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void MaxHeapify(MaxHeap* heap, int idx);
+int DijkstraMaxPathWithWorkspace(const Graph* graph, unsigned int src,
+                                 unsigned int dest,
+                                 DijkstraWorkspace* workspace,
+                                 unsigned int* maxWeight, unsigned int** path,
+                                 unsigned int* pathLength);
 
 /**
-    @brief Extracts the maximum node (root) from the MaxHeap.
-
-    @param heap Pointer to the MaxHeap.
-
-    @return The maximum HeapNode extracted from the heap.
+    @brief Finds the path with maximum weight in a frozen CSR snapshot using a
+           modified Dijkstra's algorithm.
+    @param frozen Pointer to the frozen graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices, NULL if there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-HeapNode ExtractMax(MaxHeap* heap);
+int DijkstraMaxPathFrozen(const FrozenGraph* frozen, unsigned int src,
+                          unsigned int dest, unsigned int* maxWeight,
+                          unsigned int** path, unsigned int* pathLength);
 
 /**
-    @brief Ensures the capacity of the MaxHeap.
-
-    @param heap Pointer to the MaxHeap.
+    @brief Finds the path with maximum weight in a frozen CSR snapshot using a
+           modified Dijkstra's algorithm, reusing the memory of a workspace.
+    @param frozen Pointer to the frozen graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices, NULL if there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void EnsureCapacityMaxHeap(MaxHeap* heap);
+int DijkstraMaxPathFrozenWithWorkspace(const FrozenGraph* frozen,
+                                       unsigned int src, unsigned int dest,
+                                       DijkstraWorkspace* workspace,
+                                       unsigned int* maxWeight,
+                                       unsigned int** path,
+                                       unsigned int* pathLength);
 
 /**
-    @brief Inserts a new node into the MaxHeap.
-
-    @param heap Pointer to the MaxHeap.
-    @param vertex Vertex index to insert.
-    @param weight Weight associated with the vertex.
-
-    @note If the heap is full, it will be resized to accommodate more elements.
+    @brief Finds the path with maximum weight in a compressed snapshot using a
+           modified Dijkstra's algorithm.
+    @param compressed Pointer to the compressed graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices, NULL if there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void InsertNodeMaxHeap(MaxHeap* heap, unsigned int vertex, unsigned int weight);
+int DijkstraMaxPathCompressed(const CompressedGraph* compressed,
+                              unsigned int src, unsigned int dest,
+                              unsigned int* maxWeight, unsigned int** path,
+                              unsigned int* pathLength);
 
 /**
-    @brief Finds the path with maximum weight in a graph using a modified
-           Dijkstra's algorithm.
-    @param graph Pointer to the graph structure.
-    @param src Source vertex index.
-    @param dest Destination vertex index.
-    @param maxWeight Pointer to store the maximum path weight.
-    @param path Pointer to store the path vertices with maximum weight.
+    @brief Finds the path with maximum weight in a compressed snapshot using a
+           modified Dijkstra's algorithm, reusing the memory of a workspace.
+    @param compressed Pointer to the compressed graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices, NULL if there is no path.
     @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void DijkstraMaxPath(const Graph* graph, unsigned int src, unsigned int dest,
-  unsigned int* maxWeight, unsigned int** path,
-  unsigned int* pathLength);
+int DijkstraMaxPathCompressedWithWorkspace(const CompressedGraph* compressed,
+                                           unsigned int src, unsigned int dest,
+                                           DijkstraWorkspace* workspace,
+                                           unsigned int* maxWeight,
+                                           unsigned int** path,
+                                           unsigned int* pathLength);
 
 /**
     @brief Prints the path found by the DijkstraMaxPath function.
@@ -15,224 +15,409 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-#include "dijkstra-structure.h"
+#include "dijkstra-heap.h"
+#include "dijkstra-queue.h"
+#include "dijkstra-workspace.h"
+#include "graph-snapshot.h"
+#include "search-path.h"
 #include "vertices.h"
 
 /**
-    @brief Creates a new MinHeap with the specified capacity.
-    @param capacity The initial capacity of the MinHeap.
-    @return A pointer to the newly created MinHeap, or NULL if memory allocation
-            fails.
+    @brief Returns the default options of a Dijkstra search, which choose the
+           priority queue from the highest edge weight of the graph, stop at
+           the destination and set no bound.
+    @return The default options.
 **/
-MinHeap* CreateMinHeap(unsigned int capacity) {
-  MinHeap* heap = (MinHeap*)malloc(sizeof(MinHeap));
-  if (heap == NULL) {
-    return NULL;
-  }
-
-  heap->nodes = (HeapNode*)malloc(capacity * sizeof(HeapNode));
-  if (heap->nodes == NULL) {
-    free(heap);
-    return NULL;
-  }
-
-  heap->size = 0;
-  heap->capacity = capacity;
-  return heap;
+DijkstraOptions DefaultDijkstraOptions(void) {
+  DijkstraOptions options;
+  options.queue = DIJKSTRA_QUEUE_AUTO;
+  options.stopAtTarget = true;  // Later vertices cannot change the result
+  options.maxDistance = DIJKSTRA_NO_LIMIT;
+  options.maxHops = DIJKSTRA_NO_LIMIT;
+  options.maxSettled = DIJKSTRA_NO_LIMIT;
+  return options;
 }
 
 /**
-    @brief Swaps two HeapNode elements.
-
-    @param a Pointer to the first HeapNode.
-    @param b Pointer to the second HeapNode.
+    @brief Runs a shortest path search between two vertices of a graph, and
+           stores the path if the destination is settled.
+    @param graph Pointer to the graph structure.
+    @param srcIndex Dense index of the source vertex.
+    @param destIndex Dense index of the destination vertex.
+    @param options Pointer to the options of the search.
+    @param workspace Pointer to the workspace of the search.
+    @param minSum Pointer to store the minimum path sum.
+    @param path Pointer to store the shortest path vertices.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, or FAILURE_ALLOCATING_SEARCH if memory
+            allocation fails.
 **/
-void SwapHeapNode(HeapNode* a, HeapNode* b) {
-  HeapNode temp = *a;
-  *a = *b;
-  *b = temp;
-}
+static int SearchMinPath(const Graph* graph, unsigned int srcIndex,
+                         unsigned int destIndex,
+                         const DijkstraOptions* options,
+                         DijkstraWorkspace* workspace, unsigned int* minSum,
+                         unsigned int** path, unsigned int* pathLength) {
+  // Arrays are indexed by dense index, so their size follows the vertices
+  if (!BeginDijkstraQuery(workspace, graph->indexCount)) {
+    return FAILURE_ALLOCATING_SEARCH;
+  }
 
-/**
-    @brief Maintains heap property for a given node.
+  MinQueue queue;
+  if (!GetWorkspaceMinQueue(workspace, options->queue, graph->maxEdgeWeight,
+                            &queue)) {
+    return FAILURE_ALLOCATING_SEARCH;
+  }
 
-    @param heap Pointer to the MinHeap.
-    @param idx Index of the node to start heapifying from.
-**/
-void MinHeapify(MinHeap* heap, int idx) {
-  int smallest = idx;
-  int left = 2 * idx + 1;
-  int right = 2 * idx + 2;
+  unsigned int* dist = workspace->dist;
+  unsigned int* prev = workspace->prev;
+  unsigned int* hops = workspace->hops;
+  unsigned int generation = workspace->generation;
 
-  if (left < heap->size &&
-    heap->nodes[left].weight < heap->nodes[smallest].weight) {
-    smallest = left;
-  }
-  if (right < heap->size &&
-    heap->nodes[right].weight < heap->nodes[smallest].weight) {
-    smallest = right;
-  }
-  if (smallest != idx) {
-    SwapHeapNode(&heap->nodes[smallest], &heap->nodes[idx]);
-    MinHeapify(heap, smallest);
-  }
-}
+  ReachVertex(workspace, srcIndex, 0, UINT_MAX, 0);
+  PushMinQueue(&queue, srcIndex, 0);
 
-/**
-    @brief Extracts the minimum node (root) from the MinHeap.
+  unsigned int numSettled = 0;
+  unsigned int maxDistance = options->maxDistance;
+  while (MinQueueSize(&queue) > 0) {
+    unsigned int u = PopMinQueue(&queue);
 
-    @param heap Pointer to the MinHeap.
+    // The queue holds each vertex once, never stale
+    workspace->settled[u] = generation;
+    numSettled++;
 
-    @return The minimum HeapNode extracted from the heap.
-**/
-HeapNode ExtractMin(MinHeap* heap) {
-  if (heap->size == 0) {
-    HeapNode emptyNode = { 0, UINT_MAX };
-    return emptyNode;
+    if ((u == destIndex && options->stopAtTarget) ||
+        numSettled >= options->maxSettled) {
+      break;
+    }
+    if (hops[u] >= options->maxHops) {
+      continue;  // Settled, but its edges would exceed the hop bound
+    }
+
+    const EdgeBlock* block = graph->vertexByIndex[u]->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        unsigned int v = block->dest[i];
+        unsigned int newDist = dist[u] + block->weight[i];
+
+        // Vertices beyond maxDistance are never queued
+        if (!IsVertexSettled(workspace, v) &&
+            (!IsVertexReached(workspace, v) || newDist < dist[v]) &&
+            newDist <= maxDistance) {
+          ReachVertex(workspace, v, newDist, u, hops[u] + 1);
+          PushMinQueue(&queue, v, newDist);
+        }
+      }
+    }
   }
 
-  HeapNode root = heap->nodes[0];
-  heap->nodes[0] = heap->nodes[heap->size - 1];
-  heap->size--;
-  MinHeapify(heap, 0);
+  // Only a settled destination has its final distance
+  if (IsVertexSettled(workspace, destIndex)) {
+    if (!BuildPathFromPrev(graph, prev, destIndex, path, pathLength)) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
+    *minSum = dist[destIndex];
+  }
 
-  return root;
+  return SUCCESS_SEARCHING_PATH;
 }
 
 /**
-    @brief Ensures the capacity of the MinHeap.
-
-    @param heap Pointer to the MinHeap.
+    @brief Computes the shortest path in a graph using Dijkstra's algorithm.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void EnsureCapacity(MinHeap* heap) {
-  if (heap->size == heap->capacity) {
-    heap->capacity *= 2;
-    HeapNode* new_nodes =
-      (HeapNode*)realloc(heap->nodes, heap->capacity * sizeof(HeapNode));
-    if (new_nodes == NULL) {
-      exit(EXIT_FAILURE);
-    }
-    heap->nodes = new_nodes;
-  }
+int DijkstraMinPath(const Graph* graph, unsigned int src, unsigned int dest,
+  unsigned int* minSum, unsigned int** path,
+  unsigned int* pathLength) {
+  DijkstraOptions options = DefaultDijkstraOptions();
+  return DijkstraMinPathWithOptions(graph, src, dest, &options, NULL, minSum,
+                                    path, pathLength);
 }
 
 /**
-    @brief Inserts a new node into the MinHeap.
-
-    @param heap Pointer to the MinHeap.
-    @param vertex Vertex index to insert.
-    @param weight Weight associated with the vertex.
-
-    @note If the heap is full, it will be resized to accommodate more elements.
+    @brief Computes the shortest path in a graph using Dijkstra's algorithm,
+           with the given options.
+
+    @details With DIJKSTRA_QUEUE_AUTO, Dial's bucket queue is used when no
+             edge weight of the graph exceeds DIAL_MAX_WEIGHT, and the indexed
+             heap otherwise.
+
+             The hop count of a vertex is the one of the best path found to
+             it, and vertices at maxHops are not expanded. Paths with fewer
+             hops but a higher sum are not searched for, so the path reported
+             under maxHops never exceeds the bound but is not always the
+             shortest one within it.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param options Pointer to the options of the search.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void InsertNode(MinHeap* heap, unsigned int vertex, unsigned int weight) {
-  EnsureCapacity(heap);
+int DijkstraMinPathWithOptions(const Graph* graph, unsigned int src,
+                               unsigned int dest,
+                               const DijkstraOptions* options,
+                               DijkstraWorkspace* workspace,
+                               unsigned int* minSum, unsigned int** path,
+                               unsigned int* pathLength) {
+  *minSum = UINT_MAX;
+  *path = NULL;
+  *pathLength = 0;
+
+  if (graph == NULL) {
+    return INVALID_GRAPH;
+  }
+
+  const Vertex* srcVertex = FindVertex(graph, src);
+  const Vertex* destVertex = FindVertex(graph, dest);
+  if (srcVertex == NULL || destVertex == NULL) {
+    return VERTEX_DOES_NOT_EXIST;
+  }
 
-  int i = heap->size;
-  heap->size++;
+  DijkstraWorkspace* used = workspace;
+  if (used == NULL) {
+    used = CreateDijkstraWorkspace(graph->indexCount);
+    if (used == NULL) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
+  }
 
-  heap->nodes[i].vertex = vertex;
-  heap->nodes[i].weight = weight;
+  int result = SearchMinPath(graph, srcVertex->index, destVertex->index,
+                             options, used, minSum, path, pathLength);
 
-  // Perform heapify-up
-  while (i != 0 && heap->nodes[(i - 1) / 2].weight > heap->nodes[i].weight) {
-    SwapHeapNode(&heap->nodes[i], &heap->nodes[(i - 1) / 2]);
-    i = (i - 1) / 2;
+  if (workspace == NULL) {
+    FreeDijkstraWorkspace(used);
   }
+
+  return result;
 }
 
 /**
-    @brief Computes the shortest path in a graph using Dijkstra's algorithm.
-    @param graph Pointer to the graph structure.
-    @param src Source vertex index.
-    @param dest Destination vertex index.
+    @brief Runs a shortest path search between two vertices of a read-only
+           snapshot, and stores the path if the destination is settled.
+           Shared by the frozen and compressed variants, which only differ in
+           how the outgoing edges of a vertex are read.
+    @param snapshot Pointer to the snapshot.
+    @param srcIndex Dense index of the source vertex.
+    @param destIndex Dense index of the destination vertex.
+    @param workspace Pointer to the workspace of the search.
     @param minSum Pointer to store the minimum path sum.
     @param path Pointer to store the shortest path vertices.
     @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, or FAILURE_ALLOCATING_SEARCH if memory
+            allocation fails.
 **/
-void DijkstraMinPath(const Graph* graph, unsigned int src, unsigned int dest,
-  unsigned int* minSum, unsigned int** path,
-  unsigned int* pathLength) {
-  unsigned int* dist =
-    (unsigned int*)malloc(graph->hashSize * sizeof(unsigned int));
-  if (dist == NULL) {
-    exit(EXIT_FAILURE);
-  }
-  bool* visited = (bool*)malloc(graph->hashSize * sizeof(bool));
-  if (visited == NULL) {
-    exit(EXIT_FAILURE);
+static int SearchMinSnapshot(const GraphSnapshot* snapshot,
+                             unsigned int srcIndex, unsigned int destIndex,
+                             DijkstraWorkspace* workspace,
+                             unsigned int* minSum, unsigned int** path,
+                             unsigned int* pathLength) {
+  if (!BeginDijkstraQuery(workspace, snapshot->numVertices)) {
+    return FAILURE_ALLOCATING_SEARCH;
   }
 
-  unsigned int* prev =
-    (unsigned int*)malloc(graph->hashSize * sizeof(unsigned int));
-  if (prev == NULL) {
-    exit(EXIT_FAILURE);
-  }
-
-  for (unsigned int i = 0; i < graph->hashSize; i++) {
-    dist[i] = UINT_MAX;
-    visited[i] = false;
-    prev[i] = UINT_MAX;
-  }
-
-  MinHeap* minHeap = CreateMinHeap(graph->hashSize);
+  IndexedHeap* minHeap = GetWorkspaceHeap(workspace, false);
   if (minHeap == NULL) {
-    exit(EXIT_FAILURE);
+    return FAILURE_ALLOCATING_SEARCH;
   }
 
-  InsertNode(minHeap, src, 0);
-  dist[src] = 0;
+  unsigned int* dist = workspace->dist;
+  unsigned int* prev = workspace->prev;
+  unsigned int generation = workspace->generation;
+
+  ReachVertex(workspace, srcIndex, 0, UINT_MAX, 0);
+  PushOrImproveKey(minHeap, srcIndex, 0);
 
   while (minHeap->size > 0) {
-    HeapNode minNode = ExtractMin(minHeap);
-    unsigned int u = minNode.vertex;
+    unsigned int u = ExtractHeapRoot(minHeap).vertex;
 
-    if (visited[u]) {
-      continue;
+    // The heap holds each vertex once, never stale
+    workspace->settled[u] = generation;
+    if (u == destIndex) {
+      break;  // Later vertices cannot change the result
     }
-    visited[u] = true;
-
-    Vertex* vertex = FindVertex(graph, u);
-    if (vertex) {
-      Edge* edge = vertex->edges;
-      while (edge != NULL) {
-        unsigned int v = edge->dest;
-        unsigned int weight = edge->weight;
-
-        if (!visited[v] && dist[u] != UINT_MAX && dist[u] + weight < dist[v]) {
-          dist[v] = dist[u] + weight;
-          prev[v] = u;
-          InsertNode(minHeap, v, dist[v]);
-        }
-        edge = edge->next;
+
+    SnapshotEdges edges = BeginSnapshotEdges(snapshot, u);
+    unsigned int v;
+    unsigned int weight;
+    while (NextSnapshotEdge(&edges, &v, &weight)) {
+      unsigned int newDist = dist[u] + weight;
+
+      if (!IsVertexSettled(workspace, v) &&
+          (!IsVertexReached(workspace, v) || newDist < dist[v])) {
+        ReachVertex(workspace, v, newDist, u, 0);
+        PushOrImproveKey(minHeap, v, newDist);
       }
     }
   }
 
-  *minSum = dist[dest];
+  if (IsVertexSettled(workspace, destIndex)) {
+    if (!BuildSnapshotPathFromPrev(snapshot->ids, prev, destIndex, path,
+                                   pathLength)) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
+    *minSum = dist[destIndex];
+  }
+
+  return SUCCESS_SEARCHING_PATH;
+}
 
-  // Reconstruct the path
-  unsigned int count = 0;
-  for (unsigned int v = dest; v != UINT_MAX; v = prev[v]) {
-    count++;
+/**
+    @brief Computes the shortest path in a read-only snapshot, reusing the
+           memory of a workspace.
+    @param snapshot Pointer to the snapshot.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param minSum Pointer to store the minimum path sum.
+    @param path Pointer to store the shortest path vertices.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+static int FindMinSnapshotPath(const GraphSnapshot* snapshot, unsigned int src,
+                               unsigned int dest, DijkstraWorkspace* workspace,
+                               unsigned int* minSum, unsigned int** path,
+                               unsigned int* pathLength) {
+  *minSum = UINT_MAX;
+  *path = NULL;
+  *pathLength = 0;
+
+  unsigned int srcIndex = FindSnapshotIndex(snapshot, src);
+  unsigned int destIndex = FindSnapshotIndex(snapshot, dest);
+  if (srcIndex == NO_VERTEX_INDEX || destIndex == NO_VERTEX_INDEX) {
+    return VERTEX_DOES_NOT_EXIST;
   }
 
-  *path = (unsigned int*)malloc(count * sizeof(unsigned int));
-  if (path == NULL) {
-    exit(EXIT_FAILURE);
+  DijkstraWorkspace* used = workspace;
+  if (used == NULL) {
+    used = CreateDijkstraWorkspace(snapshot->numVertices);
+    if (used == NULL) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
   }
 
-  unsigned int idx = count - 1;
-  for (unsigned int v = dest; v != UINT_MAX; v = prev[v]) {
-    (*path)[idx--] = v;
+  int result = SearchMinSnapshot(snapshot, srcIndex, destIndex, used, minSum,
+                                 path, pathLength);
+
+  if (workspace == NULL) {
+    FreeDijkstraWorkspace(used);
   }
-  *pathLength = count;
 
-  free(dist);
-  free(visited);
-  free(prev);
-  free(minHeap->nodes);
-  free(minHeap);
+  return result;
+}
+
+/**
+    @brief Computes the shortest path in a frozen CSR snapshot using Dijkstra's
+           algorithm.
+    @param frozen Pointer to the frozen graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraMinPathFrozen(const FrozenGraph* frozen, unsigned int src,
+                         unsigned int dest, unsigned int* minSum,
+                         unsigned int** path, unsigned int* pathLength) {
+  return DijkstraMinPathFrozenWithWorkspace(frozen, src, dest, NULL, minSum,
+                                            path, pathLength);
+}
+
+/**
+    @brief Computes the shortest path in a frozen CSR snapshot using Dijkstra's
+           algorithm, reusing the memory of a workspace.
+    @param frozen Pointer to the frozen graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraMinPathFrozenWithWorkspace(const FrozenGraph* frozen,
+                                       unsigned int src, unsigned int dest,
+                                       DijkstraWorkspace* workspace,
+                                       unsigned int* minSum,
+                                       unsigned int** path,
+                                       unsigned int* pathLength) {
+  GraphSnapshot snapshot = ViewFrozenGraph(frozen);
+  return FindMinSnapshotPath(&snapshot, src, dest, workspace, minSum, path,
+                             pathLength);
+}
+
+/**
+    @brief Computes the shortest path in a compressed snapshot using Dijkstra's
+           algorithm.
+    @param compressed Pointer to the compressed graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraMinPathCompressed(const CompressedGraph* compressed,
+                             unsigned int src, unsigned int dest,
+                             unsigned int* minSum, unsigned int** path,
+                             unsigned int* pathLength) {
+  return DijkstraMinPathCompressedWithWorkspace(compressed, src, dest, NULL,
+                                                minSum, path, pathLength);
+}
+
+/**
+    @brief Computes the shortest path in a compressed snapshot using Dijkstra's
+           algorithm, reusing the memory of a workspace.
+    @param compressed Pointer to the compressed graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraMinPathCompressedWithWorkspace(const CompressedGraph* compressed,
+                                           unsigned int src, unsigned int dest,
+                                           DijkstraWorkspace* workspace,
+                                           unsigned int* minSum,
+                                           unsigned int** path,
+                                           unsigned int* pathLength) {
+  GraphSnapshot snapshot = ViewCompressedGraph(compressed);
+  return FindMinSnapshotPath(&snapshot, src, dest, workspace, minSum, path,
+                             pathLength);
 }
 
 /**
@@ -15,68 +15,146 @@
 #include "graph.h"
 
 /**
-    @brief Creates a new MinHeap with the specified capacity.
-    @param capacity The initial capacity of the MinHeap.
-    @return A pointer to the newly created MinHeap, or NULL if memory allocation
-            fails.
+    @brief Returns the default options of a Dijkstra search, which choose the
+           priority queue from the highest edge weight of the graph, stop at
+           the destination and set no bound.
+    @return The default options.
 **/
-MinHeap* CreateMinHeap(unsigned int capacity);
+DijkstraOptions DefaultDijkstraOptions(void);
 
 /**
-    @brief Swaps two HeapNode elements.
-
-    @param a Pointer to the first HeapNode.
-    @param b Pointer to the second HeapNode.
+    @brief Computes the shortest path in a graph using Dijkstra's algorithm.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void SwapHeapNode(HeapNode* a, HeapNode* b);
+int DijkstraMinPath(const Graph* graph, unsigned int src, unsigned int dest,
+  unsigned int* minSum, unsigned int** path,
+  unsigned int* pathLength);
 
 /**
-    @brief Maintains heap property for a given node.
-
-    @param heap Pointer to the MinHeap.
-    @param idx Index of the node to start heapifying from.
+    @brief Computes the shortest path in a graph using Dijkstra's algorithm,
+           with the given options.
+
+    @details With DIJKSTRA_QUEUE_AUTO, Dial's bucket queue is used when no
+             edge weight of the graph exceeds DIAL_MAX_WEIGHT, and the indexed
+             heap otherwise.
+
+             The hop count of a vertex is the one of the best path found to
+             it, and vertices at maxHops are not expanded. Paths with fewer
+             hops but a higher sum are not searched for, so the path reported
+             under maxHops never exceeds the bound but is not always the
+             shortest one within it.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param options Pointer to the options of the search.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void MinHeapify(MinHeap* heap, int idx);
+int DijkstraMinPathWithOptions(const Graph* graph, unsigned int src,
+                               unsigned int dest,
+                               const DijkstraOptions* options,
+                               DijkstraWorkspace* workspace,
+                               unsigned int* minSum, unsigned int** path,
+                               unsigned int* pathLength);
 
 /**
-    @brief Extracts the minimum node (root) from the MinHeap.
-
-    @param heap Pointer to the MinHeap.
-
-    @return The minimum HeapNode extracted from the heap.
+    @brief Computes the shortest path in a frozen CSR snapshot using Dijkstra's
+           algorithm.
+    @param frozen Pointer to the frozen graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-HeapNode ExtractMin(MinHeap* heap);
+int DijkstraMinPathFrozen(const FrozenGraph* frozen, unsigned int src,
+                         unsigned int dest, unsigned int* minSum,
+                         unsigned int** path, unsigned int* pathLength);
 
 /**
-    @brief Ensures the capacity of the MinHeap.
-
-    @param heap Pointer to the MinHeap.
+    @brief Computes the shortest path in a frozen CSR snapshot using Dijkstra's
+           algorithm, reusing the memory of a workspace.
+    @param frozen Pointer to the frozen graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void EnsureCapacity(MinHeap* heap);
+int DijkstraMinPathFrozenWithWorkspace(const FrozenGraph* frozen,
+                                       unsigned int src, unsigned int dest,
+                                       DijkstraWorkspace* workspace,
+                                       unsigned int* minSum,
+                                       unsigned int** path,
+                                       unsigned int* pathLength);
 
 /**
-    @brief Inserts a new node into the MinHeap.
-
-    @param heap Pointer to the MinHeap.
-    @param vertex Vertex index to insert.
-    @param weight Weight associated with the vertex.
-
-    @note If the heap is full, it will be resized to accommodate more elements.
+    @brief Computes the shortest path in a compressed snapshot using Dijkstra's
+           algorithm.
+    @param compressed Pointer to the compressed graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
+    @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void InsertNode(MinHeap* heap, unsigned int vertex, unsigned int weight);
+int DijkstraMinPathCompressed(const CompressedGraph* compressed,
+                             unsigned int src, unsigned int dest,
+                             unsigned int* minSum, unsigned int** path,
+                             unsigned int* pathLength);
 
 /**
-    @brief Computes the shortest path in a graph using Dijkstra's algorithm.
-    @param graph Pointer to the graph structure.
-    @param src Source vertex index.
-    @param dest Destination vertex index.
-    @param minSum Pointer to store the minimum path sum.
-    @param path Pointer to store the shortest path vertices.
+    @brief Computes the shortest path in a compressed snapshot using Dijkstra's
+           algorithm, reusing the memory of a workspace.
+    @param compressed Pointer to the compressed graph.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param workspace Pointer to a workspace reused across queries, or NULL to
+                     use a temporary one.
+    @param minSum Pointer to store the minimum path sum, UINT_MAX if there is
+                  no path.
+    @param path Pointer to store the shortest path vertices, NULL if there is
+                no path.
     @param pathLength Pointer to store the length of the shortest path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path,
+            VERTEX_DOES_NOT_EXIST or FAILURE_ALLOCATING_SEARCH.
 **/
-void DijkstraMinPath(const Graph* graph, unsigned int src, unsigned int dest,
-  unsigned int* minSum, unsigned int** path,
-  unsigned int* pathLength);
+int DijkstraMinPathCompressedWithWorkspace(const CompressedGraph* compressed,
+                                           unsigned int src, unsigned int dest,
+                                           DijkstraWorkspace* workspace,
+                                           unsigned int* minSum,
+                                           unsigned int** path,
+                                           unsigned int* pathLength);
 
 /**
     @brief Prints the shortest path found by Dijkstra's algorithm.
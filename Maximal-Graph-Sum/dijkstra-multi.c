@@ -0,0 +1,351 @@
+/**
+
+    @file      dijkstra-multi.c
+    @brief     Function implementations of Dijkstra searches started from many
+               sources at once, to find the nearest facilities of every
+               vertex.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#include "dijkstra-multi.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "dijkstra-queue.h"
+#include "dijkstra-workspace.h"
+#include "vertices.h"
+
+/**
+    @struct FacilityLabels
+    @brief  Settled and pending distances of every vertex in a nearest
+            facilities search, k of each per vertex.
+**/
+typedef struct FacilityLabels {
+  unsigned int k;              // Labels of each kind per vertex
+  unsigned int* dist;          // Settled distances, the output array
+  unsigned int* owner;         // Facility of every settled distance
+  unsigned int* numSettled;    // Settled labels of every vertex
+  unsigned int* pendingDist;   // Pending distances, not yet final
+  unsigned int* pendingOwner;  // Facility of every pending distance
+  unsigned int* numPending;    // Pending labels of every vertex
+} FacilityLabels;
+
+/**
+    @brief Finds the dense index of every vertex of a list.
+    @param graph Pointer to the graph structure.
+    @param ids Array of vertex identifiers.
+    @param count Number of identifiers.
+    @param indices Array to store the dense index of every vertex.
+    @return True in the case of success, false if a vertex does not exist.
+**/
+static bool FindSourceIndices(const Graph* graph, const unsigned int* ids,
+                              unsigned int count, unsigned int* indices) {
+  for (unsigned int i = 0; i < count; i++) {
+    const Vertex* vertex = FindVertex(graph, ids[i]);
+    if (vertex == NULL) {
+      return false;
+    }
+    indices[i] = vertex->index;
+  }
+  return true;
+}
+
+/**
+    @brief Computes, for every vertex of a graph, the nearest of several
+           sources and its distance, in a single Dijkstra search.
+
+    @details Every source is queued at distance 0, and each vertex inherits
+             the owner of the vertex it is reached from, so the owners form a
+             Voronoi partition of the reachable vertices. Distances follow
+             the direction of the edges, from the source to the vertex. On a
+             tie, the owner is the source whose path was found first.
+    @param graph Pointer to the graph structure.
+    @param srcs Array of source vertex identifiers.
+    @param nsrc Number of sources.
+    @param dist Array of indexCount entries to store the distance of every
+                dense index from its nearest source, UINT_MAX if no source
+                reaches it.
+    @param owner Array of indexCount entries to store the position in srcs of
+                 the nearest source of every dense index, UINT_MAX if no
+                 source reaches it.
+    @return SUCCESS_SEARCHING_PATH, INVALID_GRAPH, VERTEX_DOES_NOT_EXIST or
+            FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraMultiSource(const Graph* graph, const unsigned int* srcs,
+                        unsigned int nsrc, unsigned int* dist,
+                        unsigned int* owner) {
+  if (graph == NULL) {
+    return INVALID_GRAPH;
+  }
+
+  unsigned int n = graph->indexCount;
+  unsigned int* srcIndex =
+      (unsigned int*)malloc((nsrc > 0 ? nsrc : 1) * sizeof(unsigned int));
+  if (srcIndex == NULL) {
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+  if (!FindSourceIndices(graph, srcs, nsrc, srcIndex)) {
+    free(srcIndex);
+    return VERTEX_DOES_NOT_EXIST;
+  }
+
+  DijkstraWorkspace* workspace = CreateDijkstraWorkspace(n);
+  MinQueue queue;
+  if (workspace == NULL || !BeginDijkstraQuery(workspace, n) ||
+      !GetWorkspaceMinQueue(workspace, DIJKSTRA_QUEUE_AUTO,
+                            graph->maxEdgeWeight, &queue)) {
+    FreeDijkstraWorkspace(workspace);
+    free(srcIndex);
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+
+  // A source listed twice belongs to its first position
+  for (unsigned int i = 0; i < nsrc; i++) {
+    if (!IsVertexReached(workspace, srcIndex[i])) {
+      ReachVertex(workspace, srcIndex[i], 0, UINT_MAX, 0);
+      owner[srcIndex[i]] = i;
+      PushMinQueue(&queue, srcIndex[i], 0);
+    }
+  }
+
+  unsigned int generation = workspace->generation;
+  while (MinQueueSize(&queue) > 0) {
+    unsigned int u = PopMinQueue(&queue);
+    workspace->settled[u] = generation;
+
+    const EdgeBlock* block = graph->vertexByIndex[u]->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        unsigned int v = block->dest[i];
+        unsigned int newDist = workspace->dist[u] + block->weight[i];
+
+        if (!IsVertexSettled(workspace, v) &&
+            (!IsVertexReached(workspace, v) ||
+             newDist < workspace->dist[v])) {
+          ReachVertex(workspace, v, newDist, u, 0);
+          owner[v] = owner[u];
+          PushMinQueue(&queue, v, newDist);
+        }
+      }
+    }
+  }
+
+  for (unsigned int v = 0; v < n; v++) {
+    if (IsVertexReached(workspace, v)) {
+      dist[v] = workspace->dist[v];
+    } else {
+      dist[v] = UINT_MAX;
+      owner[v] = UINT_MAX;
+    }
+  }
+
+  FreeDijkstraWorkspace(workspace);
+  free(srcIndex);
+
+  return SUCCESS_SEARCHING_PATH;
+}
+
+/**
+    @brief Finds the lowest pending distance of a vertex.
+    @param labels Pointer to the labels of the search.
+    @param v Dense index of the vertex, which has pending distances.
+    @return The position of the lowest one among the labels of v.
+**/
+static unsigned int FindLowestPending(const FacilityLabels* labels,
+                                      unsigned int v) {
+  const unsigned int* pending = labels->pendingDist + (size_t)v * labels->k;
+  unsigned int lowest = 0;
+  for (unsigned int i = 1; i < labels->numPending[v]; i++) {
+    if (pending[i] < pending[lowest]) {
+      lowest = i;
+    }
+  }
+  return lowest;
+}
+
+/**
+    @brief Offers a vertex a distance from a facility, kept if the facility
+           is not yet settled for it and the distance is among its k best
+           pending ones.
+    @param labels Pointer to the labels of the search.
+    @param queue Pointer to the queue of the search.
+    @param v Dense index of the vertex.
+    @param newDist Distance offered.
+    @param facility Position of the facility.
+**/
+static void OfferFacility(FacilityLabels* labels, MinQueue* queue,
+                          unsigned int v, unsigned int newDist,
+                          unsigned int facility) {
+  unsigned int k = labels->k;
+  size_t base = (size_t)v * k;
+
+  if (labels->numSettled[v] == k) {
+    return;
+  }
+  for (unsigned int i = 0; i < labels->numSettled[v]; i++) {
+    if (labels->owner[base + i] == facility) {
+      return;  // Settled first, so already nearer
+    }
+  }
+
+  unsigned int* pendingDist = labels->pendingDist + base;
+  unsigned int* pendingOwner = labels->pendingOwner + base;
+  unsigned int count = labels->numPending[v];
+
+  // The queue key of v is its lowest pending distance, taken before the
+  // change, which may only lower it
+  unsigned int key = count > 0 ? pendingDist[FindLowestPending(labels, v)]
+                               : UINT_MAX;
+
+  unsigned int slot = count;
+  unsigned int worst = 0;
+  for (unsigned int i = 0; i < count; i++) {
+    if (pendingOwner[i] == facility) {
+      slot = i;
+      break;
+    }
+    if (pendingDist[i] > pendingDist[worst]) {
+      worst = i;
+    }
+  }
+
+  if (slot == count && count == k) {
+    slot = worst;  // Full, the farthest pending facility may be replaced
+  }
+  if (slot < count && newDist >= pendingDist[slot]) {
+    return;
+  }
+
+  pendingDist[slot] = newDist;
+  pendingOwner[slot] = facility;
+  if (slot == count) {
+    labels->numPending[v]++;
+  }
+
+  if (newDist < key) {
+    PushMinQueue(queue, v, newDist);
+  }
+}
+
+/**
+    @brief Computes, for every vertex of a graph, its k nearest facilities and
+           their distances, in a single Dijkstra search.
+
+    @details Every vertex may be settled up to k times, once per facility,
+             in increasing order of distance. Each vertex keeps at most k
+             pending distances from distinct facilities, and is queued by the
+             lowest of them. Distances follow the direction of the edges, from
+             the facility to the vertex. With k equal to 1, the result is the
+             one of DijkstraMultiSource.
+    @param graph Pointer to the graph structure.
+    @param facilities Array of facility vertex identifiers.
+    @param nfac Number of facilities.
+    @param k Number of facilities to find for every vertex, at least 1.
+    @param dist Array of indexCount * k entries to store, from v * k, the
+                distances of the k nearest facilities of the dense index v in
+                increasing order, UINT_MAX past the facilities which reach it.
+    @param owner Array of indexCount * k entries to store the positions in
+                 facilities matching dist, UINT_MAX past the facilities which
+                 reach the vertex.
+    @return SUCCESS_SEARCHING_PATH, INVALID_GRAPH, VERTEX_DOES_NOT_EXIST or
+            FAILURE_ALLOCATING_SEARCH.
+**/
+int NearestFacilities(const Graph* graph, const unsigned int* facilities,
+                      unsigned int nfac, unsigned int k, unsigned int* dist,
+                      unsigned int* owner) {
+  if (graph == NULL) {
+    return INVALID_GRAPH;
+  }
+  if (k == 0) {
+    return SUCCESS_SEARCHING_PATH;
+  }
+
+  unsigned int n = graph->indexCount;
+  size_t numLabels = (size_t)n * k;
+  unsigned int* facilityIndex =
+      (unsigned int*)malloc((nfac > 0 ? nfac : 1) * sizeof(unsigned int));
+  if (facilityIndex == NULL) {
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+  if (!FindSourceIndices(graph, facilities, nfac, facilityIndex)) {
+    free(facilityIndex);
+    return VERTEX_DOES_NOT_EXIST;
+  }
+
+  FacilityLabels labels;
+  labels.k = k;
+  labels.dist = dist;
+  labels.owner = owner;
+  labels.numSettled = (unsigned int*)calloc(n, sizeof(unsigned int));
+  labels.pendingDist =
+      (unsigned int*)malloc(numLabels * sizeof(unsigned int));
+  labels.pendingOwner =
+      (unsigned int*)malloc(numLabels * sizeof(unsigned int));
+  labels.numPending = (unsigned int*)calloc(n, sizeof(unsigned int));
+
+  // The workspace only lends its queue, vertices are requeued after a pop
+  DijkstraWorkspace* workspace = CreateDijkstraWorkspace(n);
+  MinQueue queue;
+  bool success = labels.numSettled != NULL && labels.pendingDist != NULL &&
+                 labels.pendingOwner != NULL && labels.numPending != NULL &&
+                 workspace != NULL && BeginDijkstraQuery(workspace, n) &&
+                 GetWorkspaceMinQueue(workspace, DIJKSTRA_QUEUE_AUTO,
+                                      graph->maxEdgeWeight, &queue);
+
+  if (success) {
+    for (unsigned int i = 0; i < nfac; i++) {
+      OfferFacility(&labels, &queue, facilityIndex[i], 0, i);
+    }
+
+    while (MinQueueSize(&queue) > 0) {
+      unsigned int u = PopMinQueue(&queue);
+      size_t base = (size_t)u * k;
+
+      // Settle the nearest pending facility of u
+      unsigned int lowest = FindLowestPending(&labels, u);
+      unsigned int uDist = labels.pendingDist[base + lowest];
+      unsigned int facility = labels.pendingOwner[base + lowest];
+      unsigned int last = --labels.numPending[u];
+      labels.pendingDist[base + lowest] = labels.pendingDist[base + last];
+      labels.pendingOwner[base + lowest] = labels.pendingOwner[base + last];
+
+      unsigned int settled = labels.numSettled[u]++;
+      dist[base + settled] = uDist;
+      owner[base + settled] = facility;
+
+      const EdgeBlock* block = graph->vertexByIndex[u]->edges.head;
+      for (; block != NULL; block = block->next) {
+        for (unsigned int i = 0; i < block->count; i++) {
+          OfferFacility(&labels, &queue, block->dest[i],
+                        uDist + block->weight[i], facility);
+        }
+      }
+
+      // The next pending facility of u waits for its own turn
+      if (labels.numSettled[u] < k && labels.numPending[u] > 0) {
+        PushMinQueue(&queue, u,
+                     labels.pendingDist[base + FindLowestPending(&labels, u)]);
+      }
+    }
+
+    for (unsigned int v = 0; v < n; v++) {
+      for (unsigned int i = labels.numSettled[v]; i < k; i++) {
+        dist[(size_t)v * k + i] = UINT_MAX;
+        owner[(size_t)v * k + i] = UINT_MAX;
+      }
+    }
+  }
+
+  FreeDijkstraWorkspace(workspace);
+  free(labels.numSettled);
+  free(labels.pendingDist);
+  free(labels.pendingOwner);
+  free(labels.numPending);
+  free(facilityIndex);
+
+  return success ? SUCCESS_SEARCHING_PATH : FAILURE_ALLOCATING_SEARCH;
+}
@@ -0,0 +1,69 @@
+/**
+
+    @file      dijkstra-multi.h
+    @brief     Function definitions for Dijkstra searches started from many
+               sources at once, to find the nearest facilities of every
+               vertex.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef DIJKSTRA_MULTI_H
+#define DIJKSTRA_MULTI_H
+
+#include "graph.h"
+
+/**
+    @brief Computes, for every vertex of a graph, the nearest of several
+           sources and its distance, in a single Dijkstra search.
+
+    @details Every source is queued at distance 0, and each vertex inherits
+             the owner of the vertex it is reached from, so the owners form a
+             Voronoi partition of the reachable vertices. Distances follow
+             the direction of the edges, from the source to the vertex. On a
+             tie, the owner is the source whose path was found first.
+    @param graph Pointer to the graph structure.
+    @param srcs Array of source vertex identifiers.
+    @param nsrc Number of sources.
+    @param dist Array of indexCount entries to store the distance of every
+                dense index from its nearest source, UINT_MAX if no source
+                reaches it.
+    @param owner Array of indexCount entries to store the position in srcs of
+                 the nearest source of every dense index, UINT_MAX if no
+                 source reaches it.
+    @return SUCCESS_SEARCHING_PATH, INVALID_GRAPH, VERTEX_DOES_NOT_EXIST or
+            FAILURE_ALLOCATING_SEARCH.
+**/
+int DijkstraMultiSource(const Graph* graph, const unsigned int* srcs,
+                        unsigned int nsrc, unsigned int* dist,
+                        unsigned int* owner);
+
+/**
+    @brief Computes, for every vertex of a graph, its k nearest facilities and
+           their distances, in a single Dijkstra search.
+
+    @details Every vertex may be settled up to k times, once per facility,
+             in increasing order of distance. Each vertex keeps at most k
+             pending distances from distinct facilities, and is queued by the
+             lowest of them. Distances follow the direction of the edges, from
+             the facility to the vertex. With k equal to 1, the result is the
+             one of DijkstraMultiSource.
+    @param graph Pointer to the graph structure.
+    @param facilities Array of facility vertex identifiers.
+    @param nfac Number of facilities.
+    @param k Number of facilities to find for every vertex, at least 1.
+    @param dist Array of indexCount * k entries to store, from v * k, the
+                distances of the k nearest facilities of the dense index v in
+                increasing order, UINT_MAX past the facilities which reach it.
+    @param owner Array of indexCount * k entries to store the positions in
+                 facilities matching dist, UINT_MAX past the facilities which
+                 reach the vertex.
+    @return SUCCESS_SEARCHING_PATH, INVALID_GRAPH, VERTEX_DOES_NOT_EXIST or
+            FAILURE_ALLOCATING_SEARCH.
+**/
+int NearestFacilities(const Graph* graph, const unsigned int* facilities,
+                      unsigned int nfac, unsigned int k, unsigned int* dist,
+                      unsigned int* owner);
+
+#endif  // !DIJKSTRA_MULTI_H
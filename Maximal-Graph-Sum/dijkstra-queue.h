@@ -0,0 +1,68 @@
+/**
+
+    @file      dijkstra-queue.h
+    @brief     Inline operations on the priority queue of a shortest path
+               search, forwarded to its heap or its buckets.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef DIJKSTRA_QUEUE_H
+#define DIJKSTRA_QUEUE_H
+
+#include <stdbool.h>
+
+#include "dijkstra-buckets.h"
+#include "dijkstra-heap.h"
+#include "dijkstra-structure.h"
+
+/**
+    @brief Adds a vertex to a queue, or lowers its key if it is already there.
+    @param queue Pointer to the queue.
+    @param vertex Dense index of the vertex.
+    @param key New key of the vertex.
+**/
+static inline void PushMinQueue(MinQueue* queue, unsigned int vertex,
+                                unsigned int key) {
+  if (queue->buckets != NULL) {
+    PushOrDecreaseBucketKey(queue->buckets, vertex, key);
+  } else {
+    PushOrImproveKey(queue->heap, vertex, key);
+  }
+}
+
+/**
+    @brief Removes the vertex with the lowest key from a non-empty queue.
+    @param queue Pointer to the queue.
+    @return The dense index of the vertex.
+**/
+static inline unsigned int PopMinQueue(MinQueue* queue) {
+  if (queue->buckets != NULL) {
+    return ExtractBucketMin(queue->buckets).vertex;
+  }
+  return ExtractHeapRoot(queue->heap).vertex;
+}
+
+/**
+    @brief Returns the lowest key of a non-empty queue.
+    @param queue Pointer to the queue.
+    @return The lowest key.
+**/
+static inline unsigned int PeekMinQueueKey(MinQueue* queue) {
+  if (queue->buckets != NULL) {
+    return PeekBucketMin(queue->buckets).weight;
+  }
+  return PeekHeapRoot(queue->heap).weight;
+}
+
+/**
+    @brief Returns the number of vertices in a queue.
+    @param queue Pointer to the queue.
+    @return The number of queued vertices.
+**/
+static inline unsigned int MinQueueSize(const MinQueue* queue) {
+  return queue->buckets != NULL ? queue->buckets->size : queue->heap->size;
+}
+
+#endif  // !DIJKSTRA_QUEUE_H
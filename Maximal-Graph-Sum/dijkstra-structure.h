@@ -10,6 +10,8 @@
 #ifndef DIJKSTRA_STRUCTURE_H
 #define DIJKSTRA_STRUCTURE_H
 
+#include <stdbool.h>
+
 /**
     @struct HeapNode
     @brief  Represents a node in the heap used for Dijkstra's algorithm.
@@ -20,23 +22,158 @@ typedef struct HeapNode {
 } HeapNode;
 
 /**
-    @struct MinHeap
-    @brief Min-heap data structure for Dijkstra's algorithm.
+    @struct IndexedHeap
+    @brief  Indexed 4-ary heap of vertices for Dijkstra's algorithm.
+
+    @details Every vertex is in the heap at most once. The position of each
+             vertex is kept, so its key can be lowered in place instead of
+             pushing a duplicate, and the heap never holds more than one
+             entry per vertex. A max-heap stores every key with its bits
+             inverted, so both orders share the same min-heap code.
+**/
+typedef struct IndexedHeap {
+  HeapNode* nodes;          // Heap ordered array of vertices and their keys
+  unsigned int* position;   // Position of every vertex in nodes
+  unsigned int size;        // Number of vertices in the heap
+  unsigned int capacity;    // Number of vertices the heap is built for
+  unsigned int keyMask;     // Applied to every key, all ones for a max-heap
+} IndexedHeap;
+
+/**
+    @struct BucketQueue
+    @brief  Dial's bucket queue of vertices for Dijkstra's algorithm with
+            small integer weights.
+
+    @details There is one bucket per possible key modulo numBuckets, which is
+             one more than the highest edge weight. All keys in the queue lie
+             between the last extracted key and that key plus the highest
+             weight, so they never share a bucket with a different key. Each
+             bucket is a doubly linked list threaded through arrays indexed
+             by vertex, so a vertex moves between buckets when its key
+             improves and is queued at most once.
+**/
+typedef struct BucketQueue {
+  unsigned int* head;       // First vertex of every bucket
+  unsigned int* next;       // Next vertex in the bucket of every vertex
+  unsigned int* prev;       // Previous vertex in the bucket of every vertex
+  unsigned int* key;        // Key of every queued vertex
+  unsigned int numBuckets;  // Number of buckets, highest weight + 1
+  unsigned int size;        // Number of vertices in the queue
+  unsigned int cursor;      // Lowest key which may still be queued
+} BucketQueue;
+
+/**
+    @struct MinQueue
+    @brief  Priority queue of a shortest path search, either an indexed heap
+            or Dial's buckets. The other member is NULL.
+**/
+typedef struct MinQueue {
+  IndexedHeap* heap;     // Indexed heap, for arbitrary weights
+  BucketQueue* buckets;  // Bucket queue, for small weights
+} MinQueue;
+
+#define DIJKSTRA_QUEUE_AUTO 0     // Buckets for small weights, heap otherwise
+#define DIJKSTRA_QUEUE_HEAP 1     // Always use the indexed heap
+#define DIJKSTRA_QUEUE_BUCKETS 2  // Always use Dial's buckets
+
+#define DIJKSTRA_NO_LIMIT 0xFFFFFFFF  // Disables a bound of DijkstraOptions
+
+/**
+    @struct DijkstraOptions
+    @brief  Options of a Dijkstra search, see DefaultDijkstraOptions.
+
+    @details The bounds let a point-to-point query settle only the vertices
+             around the source. When a bound ends the search before the
+             destination is settled, no path is reported.
+**/
+typedef struct DijkstraOptions {
+  unsigned int queue;        // One of the DIJKSTRA_QUEUE_* values
+  bool stopAtTarget;         // Stop as soon as the destination is settled
+  unsigned int maxDistance;  // Vertices farther than this are never reached
+  unsigned int maxHops;      // Edges followed from the source, at most
+  unsigned int maxSettled;   // Vertices settled before the search gives up
+} DijkstraOptions;
+
+/**
+    @struct DijkstraWorkspace
+    @brief  Reusable memory for Dijkstra searches, created once per thread.
+
+    @details Every query takes a new generation number. The distance, parent
+             and hop count of a vertex are only valid when its reached stamp
+             equals the current generation, and it is settled when its
+             settled stamp does, so nothing is cleared between queries. The
+             queues are created on first use and emptied after each query.
+**/
+typedef struct DijkstraWorkspace {
+  unsigned int capacity;    // Number of vertices the arrays can hold
+  unsigned int generation;  // Stamp of the current query, never 0
+  unsigned int* reached;    // Generation in which each vertex was reached
+  unsigned int* settled;    // Generation in which each vertex was settled
+  unsigned int* dist;       // Best distance found to each vertex
+  unsigned int* prev;       // Parent of each vertex, UINT_MAX for the source
+  unsigned int* hops;       // Edges on the best path to each vertex
+  IndexedHeap* minHeap;     // Heap of shortest path queries, or NULL
+  IndexedHeap* maxHeap;     // Heap of longest path queries, or NULL
+  BucketQueue* buckets;     // Buckets of shortest path queries, or NULL
+  struct DijkstraWorkspace* reverse;  // Backward half of bidirectional
+                                      // queries, or NULL
+} DijkstraWorkspace;
+
+/**
+    @struct Landmarks
+    @brief  Distances between every vertex and a few landmark vertices, used
+            by the ALT search for lower bounds.
+
+    @details The distances of the vertex with dense index v are stored
+             together, from fromLandmark[v * count] and toLandmark[v * count],
+             one per landmark. UINT_MAX marks a vertex which cannot be
+             reached. The distances stay valid while the graph is unchanged.
 **/
-typedef struct MinHeap {
-  HeapNode* nodes;        // Array of HeapNode elements
-  unsigned int size;      // Number of elements in the heap
-  unsigned int capacity;  // Maximum capacity of heap
-} MinHeap;
+typedef struct Landmarks {
+  unsigned int count;          // Number of landmarks
+  unsigned int numVertices;    // Dense indices covered by the distances
+  unsigned int* ids;           // Identifier of every landmark
+  unsigned int* fromLandmark;  // Distance from each landmark to each vertex
+  unsigned int* toLandmark;    // Distance from each vertex to each landmark
+} Landmarks;
+
+#define NO_SHORTCUT_MIDDLE 0xFFFFFFFF  // Middle vertex of an original edge
 
 /**
-    @struct MaxHeap
-    @brief Max-heap data structure for finding the path with maximum weight.
+    @struct HierarchyEdge
+    @brief  Edge of a contraction hierarchy, either an edge of the graph or
+            a shortcut replacing two edges through a middle vertex.
+**/
+typedef struct HierarchyEdge {
+  unsigned int vertex;  // Dense index of the other end of the edge
+  unsigned int weight;  // Weight of the edge, or of both replaced edges
+  unsigned int middle;  // Middle vertex of a shortcut, or NO_SHORTCUT_MIDDLE
+} HierarchyEdge;
+
+/**
+    @struct ContractionHierarchy
+    @brief  Edges of a graph split by the rank of their ends, with the
+            shortcuts added while contracting the vertices outside the core.
+
+    @details Vertices are contracted one at a time in ascending rank. The
+             upward edges of the vertex with dense index v lead to vertices
+             of higher rank, between up[upOffsets[v]] and up[upOffsets[v + 1]].
+             The downward edges stored at v come into v from vertices of
+             higher rank, so a backward search climbs them as well. The
+             middle vertex of a shortcut has a lower rank than both ends, and
+             every pair of vertices is joined by at most one edge. Vertices
+             ranked from coreRank on were left uncontracted. Their upward and
+             downward edges are all their edges between each other, in both
+             directions, so an edge of the core is stored at both ends.
 **/
-typedef struct MaxHeap {
-  HeapNode* nodes;        // Array of heap nodes
-  unsigned int size;      // Current number of elements in heap
-  unsigned int capacity;  // Capacity of heap
-} MaxHeap;
+typedef struct ContractionHierarchy {
+  unsigned int numVertices;   // Dense indices covered by the hierarchy
+  unsigned int coreRank;      // Rank of the first vertex of the core
+  unsigned int* rank;         // Position of every vertex in the order
+  unsigned int* upOffsets;    // First upward edge of each vertex
+  HierarchyEdge* up;          // Edges towards vertices of higher rank
+  unsigned int* downOffsets;  // First downward edge of each vertex
+  HierarchyEdge* down;        // Edges from vertices of higher rank
+} ContractionHierarchy;
 
 #endif  // !DIJKSTRA_STRUCTURE_H
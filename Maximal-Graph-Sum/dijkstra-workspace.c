@@ -0,0 +1,235 @@
+/**
+
+    @file      dijkstra-workspace.c
+    @brief     Function implementations for the reusable memory of Dijkstra
+               searches.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#include "dijkstra-workspace.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dijkstra-buckets.h"
+#include "dijkstra-heap.h"
+
+/**
+    @brief Resizes an array of the workspace, keeping its contents.
+    @param array Pointer to the array, unchanged if memory allocation fails.
+    @param capacity New number of elements.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool ResizeWorkspaceArray(unsigned int** array, unsigned int capacity) {
+  unsigned int* resized =
+      (unsigned int*)realloc(*array, capacity * sizeof(unsigned int));
+  if (resized == NULL) {
+    return false;
+  }
+
+  *array = resized;
+  return true;
+}
+
+/**
+    @brief Grows the arrays of a workspace. The queues are dropped and
+           recreated with the new capacity on their next use.
+    @param workspace Pointer to the workspace.
+    @param capacity New number of vertices, above the current one.
+    @return True in the case of success, false if memory allocation fails.
+**/
+static bool GrowDijkstraWorkspace(DijkstraWorkspace* workspace,
+                                  unsigned int capacity) {
+  // Arrays already resized by a failed attempt keep their contents, so the
+  // next attempt simply resizes them again
+  if (!ResizeWorkspaceArray(&workspace->reached, capacity) ||
+      !ResizeWorkspaceArray(&workspace->settled, capacity) ||
+      !ResizeWorkspaceArray(&workspace->dist, capacity) ||
+      !ResizeWorkspaceArray(&workspace->prev, capacity) ||
+      !ResizeWorkspaceArray(&workspace->hops, capacity)) {
+    return false;
+  }
+
+  // Stamps of new vertices must never match a generation
+  unsigned int added = capacity - workspace->capacity;
+  memset(workspace->reached + workspace->capacity, 0,
+         added * sizeof(unsigned int));
+  memset(workspace->settled + workspace->capacity, 0,
+         added * sizeof(unsigned int));
+  workspace->capacity = capacity;
+
+  FreeIndexedHeap(workspace->minHeap);
+  FreeIndexedHeap(workspace->maxHeap);
+  FreeBucketQueue(workspace->buckets);
+  workspace->minHeap = NULL;
+  workspace->maxHeap = NULL;
+  workspace->buckets = NULL;
+
+  return true;
+}
+
+/**
+    @brief Creates a workspace for searches over graphs with dense indices
+           below numVertices. It grows on demand for larger graphs.
+    @param numVertices Number of vertices the workspace is sized for.
+    @return A pointer to the newly created workspace, or NULL if memory
+            allocation fails.
+**/
+DijkstraWorkspace* CreateDijkstraWorkspace(unsigned int numVertices) {
+  DijkstraWorkspace* workspace =
+      (DijkstraWorkspace*)calloc(1, sizeof(DijkstraWorkspace));
+  if (workspace == NULL) {
+    return NULL;
+  }
+
+  if (!GrowDijkstraWorkspace(workspace, numVertices > 0 ? numVertices : 1)) {
+    FreeDijkstraWorkspace(workspace);
+    return NULL;
+  }
+
+  workspace->generation = 0;  // The first query takes generation 1
+  return workspace;
+}
+
+/**
+    @brief Frees a workspace and its queues from memory.
+
+    @param workspace Pointer to the workspace, ignored if NULL.
+**/
+void FreeDijkstraWorkspace(DijkstraWorkspace* workspace) {
+  if (workspace == NULL) {
+    return;
+  }
+
+  free(workspace->reached);
+  free(workspace->settled);
+  free(workspace->dist);
+  free(workspace->prev);
+  free(workspace->hops);
+  FreeIndexedHeap(workspace->minHeap);
+  FreeIndexedHeap(workspace->maxHeap);
+  FreeBucketQueue(workspace->buckets);
+  FreeDijkstraWorkspace(workspace->reverse);
+  free(workspace);
+}
+
+/**
+    @brief Starts a new query, growing the workspace to numVertices if needed.
+           Every vertex becomes unreached and unsettled in O(1).
+    @param workspace Pointer to the workspace.
+    @param numVertices Number of dense indices of the graph being searched.
+    @return True in the case of success, false if memory allocation fails.
+**/
+bool BeginDijkstraQuery(DijkstraWorkspace* workspace,
+                        unsigned int numVertices) {
+  if (numVertices > workspace->capacity) {
+    // Grow geometrically, as the graph usually keeps growing
+    unsigned int capacity = workspace->capacity * 2;
+    if (capacity < numVertices) {
+      capacity = numVertices;
+    }
+    if (!GrowDijkstraWorkspace(workspace, capacity)) {
+      return false;
+    }
+  }
+
+  // Once every 2^32 queries the stamps are cleared, so none is stale
+  workspace->generation++;
+  if (workspace->generation == 0) {
+    memset(workspace->reached, 0, workspace->capacity * sizeof(unsigned int));
+    memset(workspace->settled, 0, workspace->capacity * sizeof(unsigned int));
+    workspace->generation = 1;
+  }
+
+  return true;
+}
+
+/**
+    @brief Returns the workspace of the backward half of bidirectional
+           queries, creating it on first use with the same capacity.
+    @param workspace Pointer to the workspace of the forward half.
+    @return A pointer to the backward workspace, or NULL if memory allocation
+            fails.
+**/
+DijkstraWorkspace* GetReverseWorkspace(DijkstraWorkspace* workspace) {
+  if (workspace->reverse == NULL) {
+    workspace->reverse = CreateDijkstraWorkspace(workspace->capacity);
+  }
+
+  return workspace->reverse;
+}
+
+/**
+    @brief Returns the empty heap of the workspace, creating it on first use.
+    @param workspace Pointer to the workspace.
+    @param maxHeap True for the heap of longest path queries.
+    @return A pointer to the heap, or NULL if memory allocation fails.
+**/
+IndexedHeap* GetWorkspaceHeap(DijkstraWorkspace* workspace, bool maxHeap) {
+  IndexedHeap** heap = maxHeap ? &workspace->maxHeap : &workspace->minHeap;
+  if (*heap == NULL) {
+    *heap = CreateIndexedHeap(workspace->capacity, maxHeap);
+  } else {
+    ClearIndexedHeap(*heap);  // A query may stop before the heap is empty
+  }
+
+  return *heap;
+}
+
+/**
+    @brief Returns the empty bucket queue of the workspace, creating it on
+           first use or when it has too few buckets for maxWeight.
+    @param workspace Pointer to the workspace.
+    @param maxWeight Highest edge weight of the graph, below UINT_MAX.
+    @return A pointer to the queue, or NULL if memory allocation fails.
+**/
+BucketQueue* GetWorkspaceBuckets(DijkstraWorkspace* workspace,
+                                 unsigned int maxWeight) {
+  // More buckets than needed still keep every key in its own bucket
+  if (workspace->buckets != NULL &&
+      workspace->buckets->numBuckets <= maxWeight) {
+    FreeBucketQueue(workspace->buckets);
+    workspace->buckets = NULL;
+  }
+
+  if (workspace->buckets == NULL) {
+    workspace->buckets = CreateBucketQueue(workspace->capacity, maxWeight);
+  } else {
+    ClearBucketQueue(workspace->buckets);
+  }
+
+  return workspace->buckets;
+}
+
+/**
+    @brief Takes from a workspace the empty priority queue requested by the
+           options of a shortest path search. With DIJKSTRA_QUEUE_AUTO, the
+           buckets are chosen when maxWeight is at most DIAL_MAX_WEIGHT.
+    @param workspace Pointer to the workspace which owns the queues.
+    @param kind One of the DIJKSTRA_QUEUE_* values.
+    @param maxWeight Highest edge weight of the graph.
+    @param queue Pointer to the queue to be set.
+    @return True in the case of success, false if memory allocation fails.
+**/
+bool GetWorkspaceMinQueue(DijkstraWorkspace* workspace, unsigned int kind,
+                          unsigned int maxWeight, MinQueue* queue) {
+  // A bucket per possible weight, so UINT_MAX weights can never use them
+  bool useBuckets = kind == DIJKSTRA_QUEUE_BUCKETS ||
+                    (kind == DIJKSTRA_QUEUE_AUTO && maxWeight <= DIAL_MAX_WEIGHT);
+  if (maxWeight == UINT_MAX) {
+    useBuckets = false;
+  }
+
+  queue->heap = NULL;
+  queue->buckets = NULL;
+  if (useBuckets) {
+    queue->buckets = GetWorkspaceBuckets(workspace, maxWeight);
+    return queue->buckets != NULL;
+  }
+
+  queue->heap = GetWorkspaceHeap(workspace, false);
+  return queue->heap != NULL;
+}
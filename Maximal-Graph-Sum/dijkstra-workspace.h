@@ -0,0 +1,124 @@
+/**
+
+    @file      dijkstra-workspace.h
+    @brief     Function definitions for the reusable memory of Dijkstra
+               searches.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef DIJKSTRA_WORKSPACE_H
+#define DIJKSTRA_WORKSPACE_H
+
+#include <stdbool.h>
+
+#include "dijkstra-structure.h"
+
+/**
+    @brief Creates a workspace for searches over graphs with dense indices
+           below numVertices. It grows on demand for larger graphs.
+    @param numVertices Number of vertices the workspace is sized for.
+    @return A pointer to the newly created workspace, or NULL if memory
+            allocation fails.
+**/
+DijkstraWorkspace* CreateDijkstraWorkspace(unsigned int numVertices);
+
+/**
+    @brief Frees a workspace and its queues from memory.
+
+    @param workspace Pointer to the workspace, ignored if NULL.
+**/
+void FreeDijkstraWorkspace(DijkstraWorkspace* workspace);
+
+/**
+    @brief Starts a new query, growing the workspace to numVertices if needed.
+           Every vertex becomes unreached and unsettled in O(1).
+    @param workspace Pointer to the workspace.
+    @param numVertices Number of dense indices of the graph being searched.
+    @return True in the case of success, false if memory allocation fails.
+**/
+bool BeginDijkstraQuery(DijkstraWorkspace* workspace,
+                        unsigned int numVertices);
+
+/**
+    @brief Returns the workspace of the backward half of bidirectional
+           queries, creating it on first use with the same capacity.
+    @param workspace Pointer to the workspace of the forward half.
+    @return A pointer to the backward workspace, or NULL if memory allocation
+            fails.
+**/
+DijkstraWorkspace* GetReverseWorkspace(DijkstraWorkspace* workspace);
+
+/**
+    @brief Returns the empty heap of the workspace, creating it on first use.
+    @param workspace Pointer to the workspace.
+    @param maxHeap True for the heap of longest path queries.
+    @return A pointer to the heap, or NULL if memory allocation fails.
+**/
+IndexedHeap* GetWorkspaceHeap(DijkstraWorkspace* workspace, bool maxHeap);
+
+/**
+    @brief Returns the empty bucket queue of the workspace, creating it on
+           first use or when it has too few buckets for maxWeight.
+    @param workspace Pointer to the workspace.
+    @param maxWeight Highest edge weight of the graph, below UINT_MAX.
+    @return A pointer to the queue, or NULL if memory allocation fails.
+**/
+BucketQueue* GetWorkspaceBuckets(DijkstraWorkspace* workspace,
+                                 unsigned int maxWeight);
+
+/**
+    @brief Takes from a workspace the empty priority queue requested by the
+           options of a shortest path search. With DIJKSTRA_QUEUE_AUTO, the
+           buckets are chosen when maxWeight is at most DIAL_MAX_WEIGHT.
+    @param workspace Pointer to the workspace which owns the queues.
+    @param kind One of the DIJKSTRA_QUEUE_* values.
+    @param maxWeight Highest edge weight of the graph.
+    @param queue Pointer to the queue to be set.
+    @return True in the case of success, false if memory allocation fails.
+**/
+bool GetWorkspaceMinQueue(DijkstraWorkspace* workspace, unsigned int kind,
+                          unsigned int maxWeight, MinQueue* queue);
+
+/**
+    @brief Marks a vertex as reached in the current query, with its distance
+           and parent.
+    @param workspace Pointer to the workspace.
+    @param vertex Dense index of the vertex.
+    @param dist Distance of the vertex.
+    @param prev Dense index of the parent, UINT_MAX for the source.
+    @param hops Number of edges from the source.
+**/
+static inline void ReachVertex(DijkstraWorkspace* workspace,
+                               unsigned int vertex, unsigned int dist,
+                               unsigned int prev, unsigned int hops) {
+  workspace->reached[vertex] = workspace->generation;
+  workspace->dist[vertex] = dist;
+  workspace->prev[vertex] = prev;
+  workspace->hops[vertex] = hops;
+}
+
+/**
+    @brief Checks if a vertex was reached in the current query.
+    @param workspace Pointer to the workspace.
+    @param vertex Dense index of the vertex.
+    @return True if the distance and parent of the vertex are valid.
+**/
+static inline bool IsVertexReached(const DijkstraWorkspace* workspace,
+                                   unsigned int vertex) {
+  return workspace->reached[vertex] == workspace->generation;
+}
+
+/**
+    @brief Checks if a vertex was settled in the current query.
+    @param workspace Pointer to the workspace.
+    @param vertex Dense index of the vertex.
+    @return True if the distance of the vertex is final.
+**/
+static inline bool IsVertexSettled(const DijkstraWorkspace* workspace,
+                                   unsigned int vertex) {
+  return workspace->settled[vertex] == workspace->generation;
+}
+
+#endif  // !DIJKSTRA_WORKSPACE_H
@@ -0,0 +1,211 @@
+/**
+ *
+ *  @file      edge-index.c
+ *  @brief     Function implementations for the per-vertex index of outgoing
+ *             edges, used by vertices of high degree.
+ *  @details   The index is a linear-probing hash table keyed by the dense
+ *             index of the destination. Removals shift the following entries
+ *             back, so the table never holds deleted markers.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "edge-index.h"
+
+#include <stdlib.h>
+
+#include "vertices.h"
+
+#define EMPTY_ENTRY NO_DENSE_INDEX
+
+/**
+ *  @brief  Allocates the entries of an index, all of them empty.
+ *  @param  capacity - The number of entries, a power of two.
+ *  @retval          - The entries.
+ *  @retval          - NULL if memory allocation fails.
+ */
+static EdgeIndexEntry* AllocateEntries(unsigned int capacity) {
+  EdgeIndexEntry* entries =
+      (EdgeIndexEntry*)malloc(capacity * sizeof(EdgeIndexEntry));
+  if (entries == NULL) {
+    return NULL;
+  }
+
+  for (unsigned int i = 0; i < capacity; i++) {
+    entries[i].dest = EMPTY_ENTRY;
+  }
+
+  return entries;
+}
+
+/**
+ *  @brief  Finds the entry of a destination, or the empty entry where it
+ *          would be inserted.
+ *  @param  index - The index to be searched.
+ *  @param  dest  - The dense index of the destination.
+ *  @retval       - The position of the entry.
+ */
+static unsigned int ProbeEntry(const EdgeIndex* index, unsigned int dest) {
+  unsigned int mask = index->capacity - 1;
+  unsigned int position = Hash(dest) & mask;
+
+  while (index->entries[position].dest != dest &&
+         index->entries[position].dest != EMPTY_ENTRY) {
+    position = (position + 1) & mask;
+  }
+
+  return position;
+}
+
+/**
+ *  @brief  Doubles the capacity of an index, reinserting every entry.
+ *  @param  index - The index to be grown.
+ *  @retval       - True in the case of success.
+ *  @retval       - False if memory allocation fails.
+ */
+static bool GrowEdgeIndex(EdgeIndex* index) {
+  EdgeIndexEntry* oldEntries = index->entries;
+  unsigned int oldCapacity = index->capacity;
+
+  EdgeIndexEntry* entries = AllocateEntries(oldCapacity * 2);
+  if (entries == NULL) {
+    return false;
+  }
+
+  index->entries = entries;
+  index->capacity = oldCapacity * 2;
+  for (unsigned int i = 0; i < oldCapacity; i++) {
+    if (oldEntries[i].dest != EMPTY_ENTRY) {
+      index->entries[ProbeEntry(index, oldEntries[i].dest)] = oldEntries[i];
+    }
+  }
+
+  free(oldEntries);
+  return true;
+}
+
+/**
+ *  @brief  Creates an empty edge index.
+ *  @param  minEdges - The number of edges the index should hold without
+ *                     growing.
+ *  @retval          - A pointer to the newly created index.
+ *  @retval          - NULL if memory allocation fails.
+ */
+EdgeIndex* CreateEdgeIndex(unsigned int minEdges) {
+  unsigned int capacity = DEFAULT_EDGE_INDEX_SIZE;
+  while (capacity * MAX_EDGE_INDEX_LOAD_FACTOR < minEdges &&
+         capacity <= 0x40000000u) {
+    capacity <<= 1;
+  }
+
+  EdgeIndex* index = (EdgeIndex*)malloc(sizeof(EdgeIndex));
+  if (index == NULL) {
+    return NULL;
+  }
+
+  index->entries = AllocateEntries(capacity);
+  if (index->entries == NULL) {
+    free(index);
+    return NULL;
+  }
+
+  index->capacity = capacity;
+  index->size = 0;
+
+  return index;
+}
+
+/**
+ *  @brief Frees an edge index from memory. The edges are not freed.
+ *  @param index - The index to be freed.
+ */
+void FreeEdgeIndex(EdgeIndex* index) {
+  if (index == NULL) {
+    return;
+  }
+
+  free(index->entries);
+  free(index);
+}
+
+/**
+ *  @brief  Finds the location of the edge towards a destination.
+ *  @param  index - The index of an edge list.
+ *  @param  dest  - The dense index of the destination vertex.
+ *  @retval       - The entry holding the block and slot of the edge.
+ *  @retval       - NULL if the list has no edge towards dest.
+ */
+const EdgeIndexEntry* FindIndexedEdge(const EdgeIndex* index,
+                                      unsigned int dest) {
+  const EdgeIndexEntry* entry = &index->entries[ProbeEntry(index, dest)];
+  return entry->dest == dest ? entry : NULL;
+}
+
+/**
+ *  @brief  Adds the location of an edge whose destination is not yet
+ *          indexed, growing the index when needed.
+ *  @param  index - The index where the edge is added.
+ *  @param  dest  - The dense index of the destination of the edge.
+ *  @param  block - The block which holds the edge.
+ *  @param  slot  - The position of the edge in the block.
+ *  @retval       - True in the case of success.
+ *  @retval       - False if memory allocation fails.
+ */
+bool InsertIndexedEdge(EdgeIndex* index, unsigned int dest, EdgeBlock* block,
+                       unsigned int slot) {
+  if (index->size + 1 > index->capacity * MAX_EDGE_INDEX_LOAD_FACTOR &&
+      !GrowEdgeIndex(index)) {
+    return false;
+  }
+
+  EdgeIndexEntry* entry = &index->entries[ProbeEntry(index, dest)];
+  entry->dest = dest;
+  entry->slot = slot;
+  entry->block = block;
+  index->size++;
+
+  return true;
+}
+
+/**
+ *  @brief Updates the location of an indexed edge which was moved to fill
+ *         the place of a removed one.
+ *  @param index - The index which contains the edge.
+ *  @param dest  - The dense index of the destination of the edge.
+ *  @param block - The block which now holds the edge.
+ *  @param slot  - The new position of the edge in the block.
+ */
+void MoveIndexedEdge(EdgeIndex* index, unsigned int dest, EdgeBlock* block,
+                     unsigned int slot) {
+  EdgeIndexEntry* entry = &index->entries[ProbeEntry(index, dest)];
+  entry->slot = slot;
+  entry->block = block;
+}
+
+/**
+ *  @brief Removes an edge from the index.
+ *  @param index - The index which contains the edge.
+ *  @param dest  - The dense index of the destination of the edge.
+ */
+void EraseIndexedEdge(EdgeIndex* index, unsigned int dest) {
+  unsigned int mask = index->capacity - 1;
+  unsigned int hole = ProbeEntry(index, dest);
+  if (index->entries[hole].dest == EMPTY_ENTRY) {
+    return;
+  }
+
+  // Shift back every following entry whose probe sequence passes the hole
+  unsigned int position = (hole + 1) & mask;
+  while (index->entries[position].dest != EMPTY_ENTRY) {
+    unsigned int home = Hash(index->entries[position].dest) & mask;
+    if (((position - home) & mask) >= ((position - hole) & mask)) {
+      index->entries[hole] = index->entries[position];
+      hole = position;
+    }
+    position = (position + 1) & mask;
+  }
+
+  index->entries[hole].dest = EMPTY_ENTRY;
+  index->size--;
+}
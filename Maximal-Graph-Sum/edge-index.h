@@ -0,0 +1,77 @@
+/**
+ *  @file      edge-index.h
+ *  @brief     Function definitions for the per-vertex index of outgoing edges,
+ *             used by vertices of high degree.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef EDGE_INDEX_H
+#define EDGE_INDEX_H
+
+#include <stdbool.h>
+
+#include "graph.h"
+
+#define EDGE_INDEX_MIN_DEGREE 32  // Degree at which a vertex gets an index
+#define EDGE_INDEX_DROP_DEGREE 8  // Degree below which the index is dropped
+#define DEFAULT_EDGE_INDEX_SIZE 64
+#define MAX_EDGE_INDEX_LOAD_FACTOR 0.5
+
+/**
+ *  @brief  Creates an empty edge index.
+ *  @param  minEdges - The number of edges the index should hold without
+ *                     growing.
+ *  @retval          - A pointer to the newly created index.
+ *  @retval          - NULL if memory allocation fails.
+ */
+EdgeIndex* CreateEdgeIndex(unsigned int minEdges);
+
+/**
+ *  @brief Frees an edge index from memory. The edges are not freed.
+ *  @param index - The index to be freed.
+ */
+void FreeEdgeIndex(EdgeIndex* index);
+
+/**
+ *  @brief  Finds the location of the edge towards a destination.
+ *  @param  index - The index of an edge list.
+ *  @param  dest  - The dense index of the destination vertex.
+ *  @retval       - The entry holding the block and slot of the edge.
+ *  @retval       - NULL if the list has no edge towards dest.
+ */
+const EdgeIndexEntry* FindIndexedEdge(const EdgeIndex* index,
+                                      unsigned int dest);
+
+/**
+ *  @brief  Adds the location of an edge whose destination is not yet
+ *          indexed, growing the index when needed.
+ *  @param  index - The index where the edge is added.
+ *  @param  dest  - The dense index of the destination of the edge.
+ *  @param  block - The block which holds the edge.
+ *  @param  slot  - The position of the edge in the block.
+ *  @retval       - True in the case of success.
+ *  @retval       - False if memory allocation fails.
+ */
+bool InsertIndexedEdge(EdgeIndex* index, unsigned int dest, EdgeBlock* block,
+                       unsigned int slot);
+
+/**
+ *  @brief Updates the location of an indexed edge which was moved to fill
+ *         the place of a removed one.
+ *  @param index - The index which contains the edge.
+ *  @param dest  - The dense index of the destination of the edge.
+ *  @param block - The block which now holds the edge.
+ *  @param slot  - The new position of the edge in the block.
+ */
+void MoveIndexedEdge(EdgeIndex* index, unsigned int dest, EdgeBlock* block,
+                     unsigned int slot);
+
+/**
+ *  @brief Removes an edge from the index.
+ *  @param index - The index which contains the edge.
+ *  @param dest  - The dense index of the destination of the edge.
+ */
+void EraseIndexedEdge(EdgeIndex* index, unsigned int dest);
+
+#endif  // !EDGE_INDEX_H
@@ -13,92 +13,345 @@
 #include <stdbool.h>
 #include <stdlib.h>
 
+#include "edge-index.h"
 #include "graph.h"
+#include "node-pool.h"
 #include "vertices.h"
 
 /**
-  @brief  Creates a new edge with the specified destination and weight.
-  @param  dest   - The destination of this edge.
-  @param  weight - The weight of this edge.
-  @retval        - A pointer to the newly created edge.
-  @retval        - NULL if memory allocation fails.
+  @brief  Finds the block and slot of the edge of a list towards a dense
+          vertex index, through the edge index when the list has one.
+  @param  list      - The list which should contain the edge.
+  @param  destIndex - The dense index of the other end of the edge.
+  @param  block     - Pointer to store the block which holds the edge.
+  @param  slot      - Pointer to store the position of the edge in the block.
+  @retval           - True if the edge exists.
+  @retval           - False if the edge does not exist.
 **/
-Edge* CreateEdge(unsigned int dest, unsigned int weight) {
-  Edge* newEdge = (Edge*)malloc(sizeof(Edge));
-  if (newEdge == NULL) {
-    return NULL;  // Memory allocation for edge failed
+static bool FindEdgeSlot(const EdgeList* list, unsigned int destIndex,
+                         EdgeBlock** block, unsigned int* slot) {
+  if (list->index != NULL) {
+    const EdgeIndexEntry* entry = FindIndexedEdge(list->index, destIndex);
+    if (entry == NULL) {
+      return false;
+    }
+    *block = entry->block;
+    *slot = entry->slot;
+    return true;
+  }
+
+  for (EdgeBlock* current = list->head; current != NULL;
+       current = current->next) {
+    for (unsigned int i = 0; i < current->count; i++) {
+      if (current->dest[i] == destIndex) {
+        *block = current;
+        *slot = i;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+/**
+  @brief  Checks if a list has an edge towards a dense vertex index.
+  @param  list      - The list which should contain the edge.
+  @param  destIndex - The dense index of the other end of the edge.
+  @retval           - True if the edge exists.
+**/
+static bool HasEdgeTo(const EdgeList* list, unsigned int destIndex) {
+  EdgeBlock* block;
+  unsigned int slot;
+  return FindEdgeSlot(list, destIndex, &block, &slot);
+}
+
+/**
+  @brief  Builds the edge index of a list whose degree became high. If memory
+          allocation fails, the list simply keeps being scanned.
+  @param  list - The list to be indexed.
+**/
+static void BuildEdgeIndex(EdgeList* list) {
+  EdgeIndex* index = CreateEdgeIndex(list->degree * 2);
+  if (index == NULL) {
+    return;
+  }
+
+  for (EdgeBlock* block = list->head; block != NULL; block = block->next) {
+    for (unsigned int i = 0; i < block->count; i++) {
+      if (!InsertIndexedEdge(index, block->dest[i], block, i)) {
+        FreeEdgeIndex(index);
+        return;
+      }
+    }
+  }
+
+  list->index = index;
+}
+
+/**
+  @brief Drops the edge index of a list, which is then scanned again.
+  @param list - The list whose index is dropped.
+**/
+static void DropEdgeIndex(EdgeList* list) {
+  FreeEdgeIndex(list->index);
+  list->index = NULL;
+}
+
+/**
+  @brief  Stores an edge in the first block of a list, without updating its
+          index. The list must not already have an edge towards the same
+          vertex.
+  @param  graph     - The graph whose pool provides the blocks.
+  @param  list      - The list which receives the edge.
+  @param  destIndex - The dense index of the other end of the edge.
+  @param  weight    - The weight of the edge.
+  @retval           - True in the case of success, with the edge in the last
+                      slot of the first block.
+  @retval           - False if memory allocation fails.
+**/
+static bool StoreEdge(Graph* graph, EdgeList* list, unsigned int destIndex,
+                      unsigned int weight) {
+  EdgeBlock* block = list->head;
+  if (block == NULL || block->count == EDGE_BLOCK_CAPACITY) {
+    block = (EdgeBlock*)AllocateNode(&graph->edgePool);
+    if (block == NULL) {
+      return false;  // Memory allocation for the block failed
+    }
+    block->count = 0;
+    block->next = list->head;
+    list->head = block;
+  }
+
+  unsigned int slot = block->count++;
+  block->dest[slot] = destIndex;
+  block->weight[slot] = weight;
+  list->degree++;
+  if (weight > graph->maxEdgeWeight) {
+    graph->maxEdgeWeight = weight;
+  }
+
+  return true;
+}
+
+/**
+  @brief  Appends an edge to the first block of a list, keeping its index up
+          to date. The list must not already have an edge towards the same
+          vertex.
+  @param  graph     - The graph whose pool provides the blocks.
+  @param  list      - The list which receives the edge.
+  @param  destIndex - The dense index of the other end of the edge.
+  @param  weight    - The weight of the edge.
+  @retval           - True in the case of success.
+  @retval           - False if memory allocation fails.
+**/
+static bool AppendEdge(Graph* graph, EdgeList* list, unsigned int destIndex,
+                       unsigned int weight) {
+  if (!StoreEdge(graph, list, destIndex, weight)) {
+    return false;
+  }
+
+  if (list->index != NULL) {
+    if (!InsertIndexedEdge(list->index, destIndex, list->head,
+                           list->head->count - 1)) {
+      DropEdgeIndex(list);
+    }
+  } else if (list->degree >= EDGE_INDEX_MIN_DEGREE) {
+    BuildEdgeIndex(list);
   }
 
-  newEdge->dest = dest;
-  newEdge->weight = weight;
-  newEdge->next = NULL;
+  return true;
+}
 
-  return newEdge;
+/**
+  @brief Removes the edge held in a slot, moving the last edge of the first
+         block into its place so that only the first block has free slots.
+  @param graph - The graph whose pool provided the blocks.
+  @param list  - The list which contains the edge.
+  @param block - The block which holds the edge.
+  @param slot  - The position of the edge in the block.
+**/
+static void RemoveEdgeSlot(Graph* graph, EdgeList* list, EdgeBlock* block,
+                           unsigned int slot) {
+  EdgeBlock* head = list->head;
+  unsigned int last = head->count - 1;
+
+  if (list->index != NULL) {
+    EraseIndexedEdge(list->index, block->dest[slot]);
+  }
+
+  if (block != head || slot != last) {
+    block->dest[slot] = head->dest[last];
+    block->weight[slot] = head->weight[last];
+    if (list->index != NULL) {
+      MoveIndexedEdge(list->index, block->dest[slot], block, slot);
+    }
+  }
+
+  list->degree--;
+  if (--head->count == 0) {
+    list->head = head->next;
+    ReleaseNode(&graph->edgePool, head);
+  }
+
+  if (list->index != NULL && list->degree < EDGE_INDEX_DROP_DEGREE) {
+    DropEdgeIndex(list);
+  }
 }
 
 /**
-  @brief  Adds an edge to a vertex.
-  @param  vertex - The vertex to which we add the edge.
-  @param  edge   - The edge to be added.
-  @retval        - True in the case of success.
-  @retval        - False if vertex or edge are NULL.
+  @brief Releases every block of a list and leaves it empty.
+  @param graph - The graph whose pool provided the blocks.
+  @param list  - The list to be emptied.
 **/
-bool AddEdgeToVertex(Vertex* vertex, Edge* edge) {
-  if (vertex == NULL || edge == NULL) {
+static void ReleaseEdgeList(Graph* graph, EdgeList* list) {
+  EdgeBlock* block = list->head;
+  while (block != NULL) {
+    EdgeBlock* next = block->next;
+    ReleaseNode(&graph->edgePool, block);
+    block = next;
+  }
+
+  list->head = NULL;
+  list->degree = 0;
+  DropEdgeIndex(list);
+}
+
+/**
+  @brief Removes the incoming edge which mirrors an outgoing edge, when the
+         graph tracks incoming edges.
+  @param graph     - The graph which contains both vertices.
+  @param srcIndex  - The dense index of the source of the edge.
+  @param destIndex - The dense index of the destination of the edge.
+**/
+static void RemoveMirroredInEdge(Graph* graph, unsigned int srcIndex,
+                                 unsigned int destIndex) {
+  if (!graph->trackInEdges) {
+    return;
+  }
+
+  EdgeList* inEdges = &graph->vertexByIndex[destIndex]->inEdges;
+  EdgeBlock* block;
+  unsigned int slot;
+  if (FindEdgeSlot(inEdges, srcIndex, &block, &slot)) {
+    RemoveEdgeSlot(graph, inEdges, block, slot);
+  }
+}
+
+/**
+  @brief  Removes the outgoing edge of a vertex towards a dense vertex index,
+          along with its incoming mirror.
+  @param  graph     - The graph which contains the vertex.
+  @param  vertex    - The vertex which contains the edge.
+  @param  destIndex - The dense index of the destination of the edge.
+  @retval           - True if the edge was removed.
+  @retval           - False if the edge does not exist.
+**/
+static bool RemoveEdgeTo(Graph* graph, Vertex* vertex,
+                         unsigned int destIndex) {
+  EdgeBlock* block;
+  unsigned int slot;
+  if (!FindEdgeSlot(&vertex->edges, destIndex, &block, &slot)) {
     return false;
   }
 
-  edge->next = vertex->edges;
-  vertex->edges = edge;
+  RemoveEdgeSlot(graph, &vertex->edges, block, slot);
+  RemoveMirroredInEdge(graph, vertex->index, destIndex);
 
   return true;
 }
 
 /**
     @brief  Creates an edge and adds it to a vertex.
+    @param  graph  - The graph which contains the vertex.
     @param  vertex - The vertex which will have the new edge.
-    @param  dest   - The destination of the edge.
+    @param  dest   - The identifier of the destination of the edge.
     @param  weight - The weight of the edge.
     @retval        - True if the edge was succesfully created and added.
-    @retval        - False if edge already exists or in the event of an error.
+    @retval        - False if edge already exists, the destination is not a
+                     vertex of the graph or in the event of an error.
 **/
-bool CreateAddEdge(Vertex* vertex, unsigned int dest, unsigned int weight) {
-  if (EdgeExists(vertex, dest)) {
+bool CreateAddEdge(Graph* graph, Vertex* vertex, unsigned int dest,
+                   unsigned int weight) {
+  if (vertex == NULL) {
     return false;
   }
 
-  Edge* edge = CreateEdge(dest, weight);
-  if (edge == NULL) {
+  Vertex* destVertex = FindVertex(graph, dest);
+  if (destVertex == NULL || HasEdgeTo(&vertex->edges, destVertex->index)) {
     return false;
   }
 
-  bool res = AddEdgeToVertex(vertex, edge);
-  if (res == false) {
-    free(edge);
+  if (graph->trackInEdges &&
+      !AppendEdge(graph, &destVertex->inEdges, vertex->index, weight)) {
     return false;
   }
 
+  if (!AppendEdge(graph, &vertex->edges, destVertex->index, weight)) {
+    RemoveMirroredInEdge(graph, vertex->index, destVertex->index);
+    return false;
+  }
+
+  return true;
+}
+
+/**
+  @brief  Adds a run of edges to a vertex, by the dense indices of their
+          destinations. Used to build graphs in bulk, so duplicates are not
+          checked and the edge index is only built once, at the end.
+  @param  graph   - The graph which contains the vertex.
+  @param  vertex  - The vertex which will have the new edges.
+  @param  dest    - The dense index of the destination of every edge. None
+                    of them may already be a destination of the vertex, nor
+                    appear twice.
+  @param  weight  - The weight of every edge.
+  @param  count   - The number of edges.
+  @retval         - True in the case of success.
+  @retval         - False if memory allocation fails, in which case only
+                    some of the edges were added.
+**/
+bool AppendEdgesByIndex(Graph* graph, Vertex* vertex, const unsigned int* dest,
+                        const unsigned int* weight, unsigned int count) {
+  EdgeList* list = &vertex->edges;
+
+  for (unsigned int i = 0; i < count; i++) {
+    if (graph->trackInEdges &&
+        !AppendEdge(graph, &graph->vertexByIndex[dest[i]]->inEdges,
+                    vertex->index, weight[i])) {
+      return false;
+    }
+
+    bool stored = list->index != NULL
+                      ? AppendEdge(graph, list, dest[i], weight[i])
+                      : StoreEdge(graph, list, dest[i], weight[i]);
+    if (!stored) {
+      RemoveMirroredInEdge(graph, vertex->index, dest[i]);
+      return false;
+    }
+  }
+
+  if (list->index == NULL && list->degree >= EDGE_INDEX_MIN_DEGREE) {
+    BuildEdgeIndex(list);
+  }
+
   return true;
 }
 
 /**
   @brief  Checks if an edge exists.
+  @param  graph  - The graph which contains the vertex.
   @param  vertex - The vertex where the edge starts.
-  @param  dest   - The destination of the edge.
+  @param  dest   - The identifier of the destination of the edge.
   @retval        - True if the edge exists.
   @retval        - False if the edge does not exist.
 **/
-bool EdgeExists(Vertex* vertex, unsigned int dest) {
-  Edge* currentEdge = vertex->edges;
-  while (currentEdge != NULL) {
-    if (currentEdge->dest == dest) {
-      // Edge already exists
-      return true;
-    }
-    currentEdge = currentEdge->next;
+bool EdgeExists(const Graph* graph, const Vertex* vertex, unsigned int dest) {
+  const Vertex* destVertex = FindVertex(graph, dest);
+  if (destVertex == NULL) {
+    // Edges only point to vertices of the graph
+    return false;
   }
-  // Edge does not exist
-  return false;
+
+  return HasEdgeTo(&vertex->edges, destVertex->index);
 }
 
 /**
@@ -116,144 +369,204 @@ bool EdgeExistsBetweenVertices(const Graph* graph, unsigned int src,
     return false;
   }
 
-  return EdgeExists(sourceVertex, dest);
+  return EdgeExists(graph, sourceVertex, dest);
 }
 
 /**
   @brief Removes a specific edge from a vertex.
+  @param graph  - The graph which contains the vertex.
   @param vertex - The vertex which contains the edge.
-  @param dest   - The destination of the edge.
+  @param dest   - The identifier of the destination of the edge.
   @retval       - SUCCESS_REMOVING_EDGE if the edge was removed.
   @retval       - INVALID_VERTEX if the vertex is invalid.
   @retval       - EDGE_DOES_NOT_EXIST if the edge does not exist.
-  @retval       - UNDEFINED_ERROR if edge was not found.
 **/
-int RemoveEdge(Vertex* vertex, unsigned int dest) {
-  if (vertex == NULL || vertex->edges == NULL) {
+int RemoveEdge(Graph* graph, Vertex* vertex, unsigned int dest) {
+  if (vertex == NULL || vertex->edges.head == NULL) {
     return INVALID_VERTEX;
   }
 
-  if (!EdgeExists(vertex, dest)) {
+  Vertex* destVertex = FindVertex(graph, dest);
+  if (destVertex == NULL) {
     return EDGE_DOES_NOT_EXIST;
   }
 
-  Edge* prevEdge = NULL;
-  Edge* currentEdge = vertex->edges;
-
-  // Traverse the list of edges to find the edge to remove
-  while (currentEdge != NULL) {
-    if (currentEdge->dest == dest) {
-      // Remove the edge from the list
-      if (prevEdge == NULL) {
-        // Edge is the first one in the list
-        vertex->edges = currentEdge->next;
-      } else {
-        // Edge is somewhere in the middle or at the end of the list
-        prevEdge->next = currentEdge->next;
-      }
-      free(currentEdge);
-      return SUCCESS_REMOVING_EDGE;
-    }
-    prevEdge = currentEdge;
-    currentEdge = currentEdge->next;
+  if (!RemoveEdgeTo(graph, vertex, destVertex->index)) {
+    return EDGE_DOES_NOT_EXIST;
   }
 
-  return UNDEFINED_ERROR;
+  return SUCCESS_REMOVING_EDGE;
 }
 
 /**
   @brief Removes all outgoing edges from a vertex.
+  @param graph  - The graph which contains the vertex.
   @param vertex - The vertex from which to remove all outgoing edges.
   @retval       - SUCCESS_REMOVING_OUTGOING_EDGES if all edges were removed.
   @retval       - VERTEX_EDGES_NULL if the vertex or its edges are NULL.
   @retval       - ERROR_REMOVING_EDGE if there was an error removing an edge.
 **/
-int RemoveOutgoingEdges(Vertex* vertex) {
-  if (vertex == NULL || vertex->edges == NULL) {
+int RemoveOutgoingEdges(Graph* graph, Vertex* vertex) {
+  if (vertex == NULL || vertex->edges.head == NULL) {
     return VERTEX_EDGES_NULL;
   }
 
-  // Initialize a temporary pointer to hold the next edge
-  Edge* currentEdge = vertex->edges;
-  Edge* tempEdge = NULL;
-
-  // Iterate over the outgoing edges
-  while (currentEdge != NULL) {
-    // Store the next edge in tempEdge before freeing currentEdge
-    tempEdge = currentEdge->next;
-
-    // Free the current edge
-    free(currentEdge);
-
-    // Move to the next edge
-    currentEdge = tempEdge;
+  // Remove the incoming mirror of every edge from its destination
+  if (graph->trackInEdges) {
+    for (EdgeBlock* block = vertex->edges.head; block != NULL;
+         block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        RemoveMirroredInEdge(graph, vertex->index, block->dest[i]);
+      }
+    }
   }
 
-  // Set the vertex's edges to NULL as all edges are removed
-  vertex->edges = NULL;
+  // Give every outgoing edge back to the pool
+  ReleaseEdgeList(graph, &vertex->edges);
 
   return SUCCESS_REMOVING_OUTGOING_EDGES;
 }
 
+/**
+  @brief Removes edges pointing to a dense vertex index from a vertex's edge
+         list.
+  @param graph          - The graph which contains the vertex.
+  @param vertex         - The vertex from which to remove edges.
+  @param targetIndex    - The dense index of the vertex to which the edges
+                          point.
+  @retval               - SUCCESS_REMOVING_EDGES if all edges were removed.
+  @retval               - ERROR_REMOVING_EDGE if there was an error removing
+                          an edge.
+**/
+static int RemoveEdgesPointingToIndex(Graph* graph, Vertex* vertex,
+                                      unsigned int targetIndex) {
+  // A vertex has at most one edge towards each destination
+  RemoveEdgeTo(graph, vertex, targetIndex);
+
+  return SUCCESS_REMOVING_EDGES;
+}
+
 /**
   @brief Removes edges pointing to a specific vertex from a vertex's edge
          list.
+  @param graph          - The graph which contains the vertex.
   @param vertex         - The vertex from which to remove edges.
   @param targetVertexId - The ID of the vertex to which the edges point.
   @retval               - SUCCESS_REMOVING_EDGES if all edges were removed.
   @retval               - ERROR_REMOVING_EDGE if there was an error removing
                           an edge.
 **/
-int RemoveEdgesPointingTo(Vertex* vertex, unsigned int targetVertexId) {
-  Edge* currentEdge = vertex->edges;
-  Edge* prevEdge = NULL;
-
-  while (currentEdge != NULL) {
-    if (currentEdge->dest == targetVertexId) {
-      // Save the next edge before removing the current one
-      Edge* nextEdge = currentEdge->next;
-
-      // Remove the edge pointing to the target vertex
-      if (prevEdge == NULL) {
-        vertex->edges = nextEdge;
-      } else {
-        prevEdge->next = nextEdge;
-      }
-      free(currentEdge);
-
-      currentEdge = nextEdge;
-    } else {
-      prevEdge = currentEdge;
-      currentEdge = currentEdge->next;
-    }
+int RemoveEdgesPointingTo(Graph* graph, Vertex* vertex,
+                          unsigned int targetVertexId) {
+  Vertex* targetVertex = FindVertex(graph, targetVertexId);
+  if (targetVertex == NULL) {
+    return SUCCESS_REMOVING_EDGES;  // No edge can point to a missing vertex
   }
 
-  return SUCCESS_REMOVING_EDGES;
+  return RemoveEdgesPointingToIndex(graph, vertex, targetVertex->index);
 }
 
 /**
-  @brief Removes all incoming edges to a specified vertex in the graph.
+  @brief Removes all incoming edges to a specified vertex in the graph. Only
+         the sources of those edges are visited when incoming edges are
+         tracked, otherwise every vertex of the graph is.
   @param graph    - The graph from which to remove incoming edges.
   @param vertexId - The ID of the vertex for which to remove incoming edges.
   @retval         - SUCCESS_REMOVING_INCOMING_EDGES if all edges were removed.
   @retval         - INVALID_GRAPH if the graph is NULL.
   @retval         - ERROR_REMOVING_EDGE if there was an error removing an edge.
 **/
-int RemoveIncomingEdges(const Graph* graph, unsigned int vertexId) {
+int RemoveIncomingEdges(Graph* graph, unsigned int vertexId) {
   if (graph == NULL) {
     return INVALID_GRAPH;
   }
 
-  // Iterate through all slots in the hash table
-  for (unsigned int i = 0; i < graph->hashSize; i++) {
-    Vertex* vertex = graph->vertices[i];
-    if (vertex != NULL) {
-      int result = RemoveEdgesPointingTo(vertex, vertexId);
-      if (result != SUCCESS_REMOVING_EDGES) {
-        return ERROR_REMOVING_EDGE;
-      }
+  Vertex* target = FindVertex(graph, vertexId);
+  if (target == NULL) {
+    return SUCCESS_REMOVING_INCOMING_EDGES;  // Nothing can point to it
+  }
+
+  if (graph->trackInEdges) {
+    // Each incoming edge names its source, so only those vertices are
+    // visited. Removing the outgoing edge also removes its incoming mirror.
+    while (target->inEdges.head != NULL) {
+      Vertex* source = graph->vertexByIndex[target->inEdges.head->dest[0]];
+      RemoveEdgesPointingToIndex(graph, source, target->index);
+    }
+    return SUCCESS_REMOVING_INCOMING_EDGES;
+  }
+
+  // Iterate through every vertex in the hash table
+  VertexIterator iterator;
+  InitVertexIterator(&iterator, graph);
+
+  Vertex* vertex;
+  while ((vertex = NextVertex(&iterator)) != NULL) {
+    int result = RemoveEdgesPointingToIndex(graph, vertex, target->index);
+    if (result != SUCCESS_REMOVING_EDGES) {
+      return ERROR_REMOVING_EDGE;
     }
   }
 
   return SUCCESS_REMOVING_INCOMING_EDGES;
 }
+
+/**
+  @brief  Starts tracking the incoming edges of every vertex, mirroring the
+          edges already in the graph. Once enabled, removing a vertex only
+          visits its own edges, instead of every edge of the graph.
+  @param  graph - The graph whose incoming edges are tracked.
+  @retval       - True in the case of success, or if already enabled.
+  @retval       - False if the graph is NULL or memory allocation fails, in
+                  which case incoming edges stay untracked.
+**/
+bool EnableInEdgeIndex(Graph* graph) {
+  if (graph == NULL) {
+    return false;
+  }
+  if (graph->trackInEdges) {
+    return true;
+  }
+
+  for (unsigned int i = 0; i < graph->indexCount; i++) {
+    Vertex* vertex = graph->vertexByIndex[i];
+    if (vertex == NULL) {
+      continue;
+    }
+
+    for (EdgeBlock* block = vertex->edges.head; block != NULL;
+         block = block->next) {
+      for (unsigned int j = 0; j < block->count; j++) {
+        Vertex* dest = graph->vertexByIndex[block->dest[j]];
+        if (!AppendEdge(graph, &dest->inEdges, vertex->index,
+                        block->weight[j])) {
+          DisableInEdgeIndex(graph);
+          return false;
+        }
+      }
+    }
+  }
+
+  graph->trackInEdges = true;
+
+  return true;
+}
+
+/**
+  @brief Stops tracking incoming edges and releases them.
+  @param graph - The graph whose incoming edges are released.
+**/
+void DisableInEdgeIndex(Graph* graph) {
+  if (graph == NULL) {
+    return;
+  }
+
+  for (unsigned int i = 0; i < graph->indexCount; i++) {
+    Vertex* vertex = graph->vertexByIndex[i];
+    if (vertex != NULL) {
+      ReleaseEdgeList(graph, &vertex->inEdges);
+    }
+  }
+
+  graph->trackInEdges = false;
+}
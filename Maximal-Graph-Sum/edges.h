@@ -12,42 +12,46 @@
 
 #include "graph.h"
 
-/**
-  @brief  Creates a new edge with the specified destination and weight.
-  @param  dest   - The destination of this edge.
-  @param  weight - The weight of this edge.
-  @retval        - A pointer to the newly created edge.
-  @retval        - NULL if memory allocation fails.
-**/
-Edge* CreateEdge(unsigned int dest, unsigned int weight);
-
-/**
-  @brief  Adds an edge to a vertex.
-  @param  vertex - The vertex to which we add the edge.
-  @param  edge   - The edge to be added.
-  @retval        - True in the case of success.
-  @retval        - False if vertex or edge are NULL.
-**/
-bool AddEdgeToVertex(Vertex* vertex, Edge* edge);
-
 /**
     @brief  Creates an edge and adds it to a vertex.
+    @param  graph  - The graph which contains the vertex.
     @param  vertex - The vertex which will have the new edge.
-    @param  dest   - The destination of the edge.
+    @param  dest   - The identifier of the destination of the edge.
     @param  weight - The weight of the edge.
     @retval        - True if the edge was succesfully created and added.
-    @retval        - False if edge already exists or in the event of an error.
+    @retval        - False if edge already exists, the destination is not a
+                     vertex of the graph or in the event of an error.
 **/
-bool CreateAddEdge(Vertex* vertex, unsigned int dest, unsigned int weight);
+bool CreateAddEdge(Graph* graph, Vertex* vertex, unsigned int dest,
+                   unsigned int weight);
+
+/**
+  @brief  Adds a run of edges to a vertex, by the dense indices of their
+          destinations. Used to build graphs in bulk, so duplicates are not
+          checked and the edge index is only built once, at the end.
+  @param  graph   - The graph which contains the vertex.
+  @param  vertex  - The vertex which will have the new edges.
+  @param  dest    - The dense index of the destination of every edge. None
+                    of them may already be a destination of the vertex, nor
+                    appear twice.
+  @param  weight  - The weight of every edge.
+  @param  count   - The number of edges.
+  @retval         - True in the case of success.
+  @retval         - False if memory allocation fails, in which case only
+                    some of the edges were added.
+**/
+bool AppendEdgesByIndex(Graph* graph, Vertex* vertex, const unsigned int* dest,
+                        const unsigned int* weight, unsigned int count);
 
 /**
   @brief  Checks if an edge exists.
+  @param  graph  - The graph which contains the vertex.
   @param  vertex - The vertex where the edge starts.
-  @param  dest   - The destination of the edge.
+  @param  dest   - The identifier of the destination of the edge.
   @retval        - True if the edge exists.
   @retval        - False if the edge does not exist.
 **/
-bool EdgeExists(Vertex* vertex, unsigned int dest);
+bool EdgeExists(const Graph* graph, const Vertex* vertex, unsigned int dest);
 
 /**
   @brief  Checks if an edge exists between two given vertex ID's.
@@ -62,43 +66,65 @@ bool EdgeExistsBetweenVertices(const Graph* graph, unsigned int src,
 
 /**
   @brief Removes a specific edge from a vertex.
+  @param graph  - The graph which contains the vertex.
   @param vertex - The vertex which contains the edge.
-  @param dest   - The destination of the edge.
+  @param dest   - The identifier of the destination of the edge.
   @retval       - SUCCESS_REMOVING_EDGE if the edge was removed.
   @retval       - INVALID_VERTEX if the vertex is invalid.
   @retval       - EDGE_DOES_NOT_EXIST if the edge does not exist.
-  @retval       - UNDEFINED_ERROR if edge was not found.
 **/
-int RemoveEdge(Vertex* vertex, unsigned int dest);
+int RemoveEdge(Graph* graph, Vertex* vertex, unsigned int dest);
 
 /**
   @brief Removes all outgoing edges from a vertex.
+  @param graph  - The graph which contains the vertex.
   @param vertex - The vertex from which to remove all outgoing edges.
   @retval       - SUCCESS_REMOVING_OUTGOING_EDGES if all edges were removed.
   @retval       - VERTEX_EDGES_NULL if the vertex or its edges are NULL.
   @retval       - ERROR_REMOVING_EDGE if there was an error removing an edge.
 **/
-int RemoveOutgoingEdges(Vertex* vertex);
+int RemoveOutgoingEdges(Graph* graph, Vertex* vertex);
 
 /**
   @brief Removes edges pointing to a specific vertex from a vertex's edge
          list.
+  @param graph          - The graph which contains the vertex.
   @param vertex         - The vertex from which to remove edges.
   @param targetVertexId - The ID of the vertex to which the edges point.
   @retval               - SUCCESS_REMOVING_EDGES if all edges were removed.
   @retval               - ERROR_REMOVING_EDGE if there was an error removing
                           an edge.
 **/
-int RemoveEdgesPointingTo(Vertex* vertex, unsigned int targetVertexId);
+int RemoveEdgesPointingTo(Graph* graph, Vertex* vertex,
+                          unsigned int targetVertexId);
 
 /**
-  @brief Removes all incoming edges to a specified vertex in the graph.
+  @brief Removes all incoming edges to a specified vertex in the graph. Only
+         the sources of those edges are visited when incoming edges are
+         tracked, otherwise every vertex of the graph is.
   @param graph    - The graph from which to remove incoming edges.
   @param vertexId - The ID of the vertex for which to remove incoming edges.
   @retval         - SUCCESS_REMOVING_INCOMING_EDGES if all edges were removed.
   @retval         - INVALID_GRAPH if the graph is NULL.
   @retval         - ERROR_REMOVING_EDGE if there was an error removing an edge.
 **/
-int RemoveIncomingEdges(const Graph* graph, unsigned int vertexId);
+int RemoveIncomingEdges(Graph* graph, unsigned int vertexId);
+
+/**
+  @brief  Starts tracking the incoming edges of every vertex, mirroring the
+          edges already in the graph. Once enabled, removing a vertex only
+          visits its own edges, instead of every edge of the graph.
+  @param  graph - The graph whose incoming edges are tracked.
+  @retval       - True in the case of success, or if already enabled.
+  @retval       - False if the graph is NULL or memory allocation fails, in
+                  which case incoming edges stay untracked.
+**/
+bool EnableInEdgeIndex(Graph* graph);
+
+/**
+  @brief Stops tracking incoming edges and releases them.
+  @param graph - The graph whose incoming edges are released.
+**/
+void DisableInEdgeIndex(Graph* graph);
 
 #endif  // !EDGES_H
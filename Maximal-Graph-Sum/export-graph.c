@@ -15,6 +15,7 @@
 #include <stdlib.h>
 
 #include "graph-structure.h"
+#include "vertices.h"
 
  /**
   *  @brief  Exports a graph to a CSV file format.
@@ -29,19 +30,20 @@ int ExportGraph(const char* filename, const Graph* graph) {
     return ERROR_OPENING_FILE;
   }
 
-  for (unsigned int i = 0; i < graph->hashSize; ++i) {
-    Vertex* vertex = graph->vertices[i];
-    while (vertex) {
-      fprintf(file, "%u", vertex->id);  // Write the vertex ID
-      Edge* edge = vertex->edges;
-      while (edge) {
-        fprintf(file, ";%u;%u", edge->dest,
-          edge->weight);  // Write the destination and weight
-        edge = edge->next;
+  VertexIterator iterator;
+  InitVertexIterator(&iterator, graph);
+
+  Vertex* vertex;
+  while ((vertex = NextVertex(&iterator)) != NULL) {
+    fprintf(file, "%u", vertex->id);  // Write the vertex ID
+    const EdgeBlock* block = vertex->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        fprintf(file, ";%u;%u", graph->vertexByIndex[block->dest[i]]->id,
+          block->weight[i]);  // Write the destination and weight
       }
-      fprintf(file, "\n");  // Newline for the next vertex
-      vertex = vertex->next;
     }
+    fprintf(file, "\n");  // Newline for the next vertex
   }
 
   fclose(file);
@@ -51,7 +53,8 @@ int ExportGraph(const char* filename, const Graph* graph) {
 
 static int WriteHeaderToBinFile(FILE* file, const Graph* graph) {
   // Write size of hash table to file
-  size_t header = fwrite(&graph->hashSize, sizeof(unsigned int), 1, file);
+  size_t header =
+      fwrite(&graph->index.capacity, sizeof(unsigned int), 1, file);
   if (header != 1) {
     fclose(file);
     return EXIT_FAILURE;
@@ -73,13 +76,16 @@ static int WriteVertexIDToFile(FILE* file, const Vertex* vertex) {
   return EXIT_SUCCESS;
 }
 
-static int WriteEdgeToFile(FILE* file, const Edge* edge) {
+static int WriteEdgeToFile(FILE* file, const Graph* graph,
+                           const EdgeBlock* block, unsigned int slot) {
   if (file == NULL) {
     return EXIT_FAILURE;
   }
 
-  if (fwrite(&edge->dest, sizeof(unsigned int), 1, file) != 1 ||
-    fwrite(&edge->weight, sizeof(unsigned int), 1, file) != 1) {
+  // Files hold identifiers, as dense indices change between runs
+  unsigned int destID = graph->vertexByIndex[block->dest[slot]]->id;
+  if (fwrite(&destID, sizeof(unsigned int), 1, file) != 1 ||
+    fwrite(&block->weight[slot], sizeof(unsigned int), 1, file) != 1) {
     fclose(file);
     return EXIT_FAILURE;
   }
@@ -101,21 +107,21 @@ static int WriteEndMarkerToFile(FILE* file) {
 }
 
 static int WriteVerticesToBinFile(FILE* file, const Graph* graph) {
-  for (unsigned int i = 0; i < graph->hashSize; ++i) {
-    Vertex* vertex = graph->vertices[i];
-    while (vertex) {
-      WriteVertexIDToFile(file, vertex);
-
-      Edge* edge = vertex->edges;
-      while (edge) {
-        WriteEdgeToFile(file, edge);
-        edge = edge->next;
-      }
+  VertexIterator iterator;
+  InitVertexIterator(&iterator, graph);
 
-      WriteEndMarkerToFile(file);
+  Vertex* vertex;
+  while ((vertex = NextVertex(&iterator)) != NULL) {
+    WriteVertexIDToFile(file, vertex);
 
-      vertex = vertex->next;
+    const EdgeBlock* block = vertex->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        WriteEdgeToFile(file, graph, block, i);
+      }
     }
+
+    WriteEndMarkerToFile(file);
   }
   return 0;  // Indicate success
 }
@@ -0,0 +1,178 @@
+/**
+ *
+ *  @file      frozen-graph.c
+ *  @brief     Function implementations for building and querying immutable
+ *             compressed sparse row (CSR) snapshots of a graph.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "frozen-graph.h"
+
+#include <stdlib.h>
+
+#include "vertices.h"
+
+/**
+ *  @brief  Comparison function used to sort vertex identifiers.
+ *  @param  a - Pointer to the first identifier.
+ *  @param  b - Pointer to the second identifier.
+ *  @retval   - Negative, zero or positive as in qsort.
+ */
+static int CompareIds(const void* a, const void* b) {
+  unsigned int x = *(const unsigned int*)a;
+  unsigned int y = *(const unsigned int*)b;
+  return (x > y) - (x < y);
+}
+
+/**
+ *  @brief  Collects the sorted identifiers of every vertex of a graph.
+ *  @param  graph    - The graph whose identifiers are collected.
+ *  @param  numEdges - Pointer to store the number of edges in the graph.
+ *  @retval          - The sorted array of identifiers.
+ *  @retval          - NULL if memory allocation fails.
+ */
+static unsigned int* CollectSortedIds(const Graph* graph,
+                                      unsigned int* numEdges) {
+  unsigned int* ids = (unsigned int*)malloc(
+      (graph->numVertices > 0 ? graph->numVertices : 1) *
+      sizeof(unsigned int));
+  if (ids == NULL) {
+    return NULL;
+  }
+
+  VertexIterator iterator;
+  InitVertexIterator(&iterator, graph);
+
+  Vertex* vertex;
+  unsigned int count = 0;
+  unsigned int edgeCount = 0;
+  while ((vertex = NextVertex(&iterator)) != NULL) {
+    ids[count++] = vertex->id;
+    edgeCount += vertex->edges.degree;
+  }
+
+  qsort(ids, count, sizeof(unsigned int), CompareIds);
+
+  *numEdges = edgeCount;
+  return ids;
+}
+
+/**
+ *  @brief  Builds an immutable CSR snapshot of a graph.
+ *  @param  graph - The graph to be frozen.
+ *  @retval       - A pointer to the newly created snapshot.
+ *  @retval       - NULL if the graph is NULL or memory allocation fails.
+ */
+FrozenGraph* FreezeGraph(const Graph* graph) {
+  if (graph == NULL) {
+    return NULL;
+  }
+
+  FrozenGraph* frozen = (FrozenGraph*)calloc(1, sizeof(FrozenGraph));
+  if (frozen == NULL) {
+    return NULL;
+  }
+
+  frozen->numVertices = graph->numVertices;
+  frozen->ids = CollectSortedIds(graph, &frozen->numEdges);
+  frozen->offsets = (unsigned int*)calloc((size_t)frozen->numVertices + 1,
+                                          sizeof(unsigned int));
+  frozen->dest = (unsigned int*)malloc(
+      (frozen->numEdges > 0 ? frozen->numEdges : 1) * sizeof(unsigned int));
+  frozen->weight = (unsigned int*)malloc(
+      (frozen->numEdges > 0 ? frozen->numEdges : 1) * sizeof(unsigned int));
+
+  // Snapshot index of every dense index of the graph, so edges are mapped
+  // without searching
+  unsigned int* frozenIndex = (unsigned int*)malloc(
+      (graph->indexCount > 0 ? graph->indexCount : 1) * sizeof(unsigned int));
+  if (frozen->ids == NULL || frozen->offsets == NULL || frozen->dest == NULL ||
+      frozen->weight == NULL || frozenIndex == NULL) {
+    free(frozenIndex);
+    FreeFrozenGraph(frozen);
+    return NULL;
+  }
+
+  for (unsigned int i = 0; i < frozen->numVertices; i++) {
+    frozenIndex[FindVertex(graph, frozen->ids[i])->index] = i;
+  }
+
+  VertexIterator iterator;
+  Vertex* vertex;
+
+  // Count the out-degree of every vertex, shifted by one for the prefix sum
+  InitVertexIterator(&iterator, graph);
+  while ((vertex = NextVertex(&iterator)) != NULL) {
+    unsigned int index = frozenIndex[vertex->index];
+    frozen->offsets[index + 1] = vertex->edges.degree;
+  }
+
+  for (unsigned int i = 0; i < frozen->numVertices; i++) {
+    frozen->offsets[i + 1] += frozen->offsets[i];
+  }
+
+  // Each vertex owns a contiguous range, so its edges are copied in order
+  InitVertexIterator(&iterator, graph);
+  while ((vertex = NextVertex(&iterator)) != NULL) {
+    unsigned int position = frozen->offsets[frozenIndex[vertex->index]];
+    const EdgeBlock* block = vertex->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        frozen->dest[position] = frozenIndex[block->dest[i]];
+        frozen->weight[position] = block->weight[i];
+        position++;
+      }
+    }
+  }
+
+  free(frozenIndex);
+
+  return frozen;
+}
+
+/**
+ *  @brief  Finds the dense index of a vertex in a snapshot.
+ *  @param  frozen   - The snapshot which should contain the vertex.
+ *  @param  vertexID - The identifier of the vertex.
+ *  @retval          - The dense index of the vertex.
+ *  @retval          - NO_VERTEX_INDEX if the vertex is not in the snapshot.
+ */
+unsigned int FindFrozenIndex(const FrozenGraph* frozen,
+                             unsigned int vertexID) {
+  unsigned int low = 0;
+  unsigned int high = frozen->numVertices;
+
+  // Binary search over the sorted identifiers
+  while (low < high) {
+    unsigned int mid = low + (high - low) / 2;
+    if (frozen->ids[mid] < vertexID) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  if (low < frozen->numVertices && frozen->ids[low] == vertexID) {
+    return low;
+  }
+
+  return NO_VERTEX_INDEX;
+}
+
+/**
+ *  @brief Frees a snapshot from memory.
+ *  @param frozen - The snapshot to be freed.
+ */
+void FreeFrozenGraph(FrozenGraph* frozen) {
+  if (frozen == NULL) {
+    return;
+  }
+
+  free(frozen->ids);
+  free(frozen->offsets);
+  free(frozen->dest);
+  free(frozen->weight);
+  free(frozen);
+}
@@ -0,0 +1,39 @@
+/**
+ *  @file      frozen-graph.h
+ *  @brief     Function definitions for building and querying immutable
+ *             compressed sparse row (CSR) snapshots of a graph.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef FROZEN_GRAPH_H
+#define FROZEN_GRAPH_H
+
+#include "graph.h"
+
+#define NO_VERTEX_INDEX 0xFFFFFFFF
+
+/**
+ *  @brief  Builds an immutable CSR snapshot of a graph.
+ *  @param  graph - The graph to be frozen.
+ *  @retval       - A pointer to the newly created snapshot.
+ *  @retval       - NULL if the graph is NULL or memory allocation fails.
+ */
+FrozenGraph* FreezeGraph(const Graph* graph);
+
+/**
+ *  @brief  Finds the dense index of a vertex in a snapshot.
+ *  @param  frozen   - The snapshot which should contain the vertex.
+ *  @param  vertexID - The identifier of the vertex.
+ *  @retval          - The dense index of the vertex.
+ *  @retval          - NO_VERTEX_INDEX if the vertex is not in the snapshot.
+ */
+unsigned int FindFrozenIndex(const FrozenGraph* frozen, unsigned int vertexID);
+
+/**
+ *  @brief Frees a snapshot from memory.
+ *  @param frozen - The snapshot to be freed.
+ */
+void FreeFrozenGraph(FrozenGraph* frozen);
+
+#endif  // !FROZEN_GRAPH_H
@@ -31,4 +31,10 @@
 #define VERTEX_DOES_NOT_EXIST -8
 #define FAILURE_CREATING_VERTEX -9
 
+/* Path search return codes */
+#define SUCCESS_SEARCHING_PATH 0
+#define FAILURE_ALLOCATING_SEARCH -10
+#define GRAPH_HAS_CYCLE -11
+#define GRAPH_TOO_LARGE -12
+
 #endif  // !GRAPH_ERROR_CODES_H
@@ -0,0 +1,140 @@
+/**
+ *  @file      graph-snapshot.h
+ *  @brief     Function definitions for iterating over the edges of either
+ *             read-only snapshot, so a search is written once for both.
+ *  @author    Enrique Rodrigues
+ *  @date      17.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef GRAPH_SNAPSHOT_H
+#define GRAPH_SNAPSHOT_H
+
+#include <stdbool.h>
+
+#include "compressed-graph.h"
+#include "frozen-graph.h"
+
+/**
+ *  @struct GraphSnapshot
+ *  @brief  A frozen or a compressed snapshot. Exactly one of them is set.
+ */
+typedef struct GraphSnapshot {
+  unsigned int numVertices;           // Number of vertices in the snapshot
+  const unsigned int* ids;            // Dense index -> vertex id
+  const FrozenGraph* frozen;          // NULL for a compressed snapshot
+  const CompressedGraph* compressed;  // NULL for a frozen snapshot
+} GraphSnapshot;
+
+/**
+ *  @struct SnapshotEdges
+ *  @brief  Position in the outgoing edges of a vertex of a snapshot.
+ */
+typedef struct SnapshotEdges {
+  const FrozenGraph* frozen;  // NULL when the edges are decoded
+  unsigned int next;          // Next CSR edge
+  unsigned int end;           // End of the CSR edges of the vertex
+  const unsigned char* data;  // Next encoded edge
+  const unsigned char* stop;  // End of the encoded edges of the vertex
+  unsigned int dest;          // Previous decoded destination
+  bool first;                 // True until the first edge is decoded
+} SnapshotEdges;
+
+/**
+ *  @brief  Views a frozen snapshot as a GraphSnapshot.
+ *  @param  frozen - The frozen snapshot.
+ *  @retval        - The view, valid while the snapshot is.
+ */
+static inline GraphSnapshot ViewFrozenGraph(const FrozenGraph* frozen) {
+  GraphSnapshot snapshot = {frozen->numVertices, frozen->ids, frozen, NULL};
+  return snapshot;
+}
+
+/**
+ *  @brief  Views a compressed snapshot as a GraphSnapshot.
+ *  @param  compressed - The compressed snapshot.
+ *  @retval            - The view, valid while the snapshot is.
+ */
+static inline GraphSnapshot ViewCompressedGraph(
+    const CompressedGraph* compressed) {
+  GraphSnapshot snapshot = {compressed->numVertices, compressed->ids, NULL,
+                            compressed};
+  return snapshot;
+}
+
+/**
+ *  @brief  Finds the dense index of a vertex in a snapshot.
+ *  @param  snapshot - The snapshot which should contain the vertex.
+ *  @param  vertexID - The identifier of the vertex.
+ *  @retval          - The dense index of the vertex.
+ *  @retval          - NO_VERTEX_INDEX if the vertex is not in the snapshot.
+ */
+static inline unsigned int FindSnapshotIndex(const GraphSnapshot* snapshot,
+                                             unsigned int vertexID) {
+  if (snapshot->frozen != NULL) {
+    return FindFrozenIndex(snapshot->frozen, vertexID);
+  }
+
+  return FindCompressedIndex(snapshot->compressed, vertexID);
+}
+
+/**
+ *  @brief  Starts iterating over the outgoing edges of a vertex.
+ *  @param  snapshot - The snapshot which contains the vertex.
+ *  @param  vertex   - The dense index of the vertex.
+ *  @retval          - The position before the first edge.
+ */
+static inline SnapshotEdges BeginSnapshotEdges(const GraphSnapshot* snapshot,
+                                               unsigned int vertex) {
+  SnapshotEdges edges;
+  edges.frozen = snapshot->frozen;
+  edges.next = 0;
+  edges.end = 0;
+  edges.data = NULL;
+  edges.stop = NULL;
+  edges.dest = vertex;  // The first destination is stored relative to it
+  edges.first = true;
+
+  if (edges.frozen != NULL) {
+    edges.next = edges.frozen->offsets[vertex];
+    edges.end = edges.frozen->offsets[vertex + 1];
+  } else {
+    const CompressedGraph* compressed = snapshot->compressed;
+    edges.data = compressed->data + compressed->offsets[vertex];
+    edges.stop = compressed->data + compressed->offsets[vertex + 1];
+  }
+
+  return edges;
+}
+
+/**
+ *  @brief  Moves to the next outgoing edge of a vertex.
+ *  @param  edges  - The position in the edges, advanced past the edge.
+ *  @param  dest   - Receives the dense index of the destination.
+ *  @param  weight - Receives the weight of the edge.
+ *  @retval        - True if there was an edge.
+ *  @retval        - False once every edge was visited.
+ */
+static inline bool NextSnapshotEdge(SnapshotEdges* edges, unsigned int* dest,
+                                    unsigned int* weight) {
+  // Branches the same way for every edge of a search, so it is predicted
+  if (edges->frozen != NULL) {
+    if (edges->next == edges->end) {
+      return false;
+    }
+
+    *dest = edges->frozen->dest[edges->next];
+    *weight = edges->frozen->weight[edges->next++];
+    return true;
+  }
+
+  if (edges->data == edges->stop) {
+    return false;
+  }
+
+  *weight = DecodeCompressedEdge(&edges->data, &edges->dest, edges->first);
+  *dest = edges->dest;
+  edges->first = false;
+  return true;
+}
+
+#endif  // !GRAPH_SNAPSHOT_H
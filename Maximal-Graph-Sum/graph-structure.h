@@ -8,43 +8,242 @@
 #ifndef GRAPH_STRUCTURE_H
 #define GRAPH_STRUCTURE_H
 
+#include <stdbool.h>
+#include <stddef.h>
+
+#define EDGE_BLOCK_CAPACITY 14  // Fills a block of 128 bytes, two cache lines
+
+/**
+  @struct EdgeBlock
+  @brief  Block of up to EDGE_BLOCK_CAPACITY edges of a vertex, in a linked
+          list of blocks.
+
+  @details Destinations and weights are stored in separate arrays, so a
+           traversal reads them sequentially instead of following a pointer
+           per edge. Only the first block of a list may be partially filled.
+**/
+typedef struct EdgeBlock {
+  unsigned int dest[EDGE_BLOCK_CAPACITY];    // Dense index of the destination
+                                             // vertex, or of the source vertex
+                                             // in a list of incoming edges
+  unsigned int weight[EDGE_BLOCK_CAPACITY];  // Weight of each edge
+  unsigned int count;                        // Number of edges in the block
+  struct EdgeBlock* next;                    // Next block, which is full
+} EdgeBlock;
+
 /**
-  @struct Edge
-  @brief  Structure of an edge in the graph which contains a destination
-          vertex, weight and pointer to the next edge in the linked list.
+  @struct EdgeIndexEntry
+  @brief  Entry of an edge index, locating the edge towards a destination.
 **/
-typedef struct Edge {
-  unsigned int dest;    // Destination vertex
-  unsigned int weight;  // Weight of the edge
-  struct Edge* next;    // Pointer to the next edge in the list
-} Edge;
+typedef struct EdgeIndexEntry {
+  unsigned int dest;  // Dense index of the destination, empty if NO_DENSE_INDEX
+  unsigned int slot;  // Position of the edge in its block
+  EdgeBlock* block;   // Block which holds the edge
+} EdgeIndexEntry;
+
+/**
+  @struct EdgeIndex
+  @brief  Hash table from destinations to the edges of one edge list.
+
+  @details Only lists of high degree have an index. It stores the block and
+           position of each edge, so an edge can be found and removed
+           without walking the list.
+**/
+typedef struct EdgeIndex {
+  unsigned int capacity;    // Number of entries, a power of two
+  unsigned int size;        // Number of entries holding an edge
+  EdgeIndexEntry* entries;  // Entries, probed linearly
+} EdgeIndex;
+
+/**
+  @struct EdgeList
+  @brief  Linked list of blocks holding the edges of a vertex in one
+          direction.
+
+  @details New edges go into the first block, and a new first block is added
+           when it is full. A removed edge is replaced by the last edge of the
+           first block, so every other block stays full.
+**/
+typedef struct EdgeList {
+  EdgeBlock* head;      // First block of the linked list
+  unsigned int degree;  // Number of edges in the list
+  EdgeIndex* index;     // Index of the edges, NULL while the degree is low
+} EdgeList;
 
 /**
   @struct Vertex
   @brief  Structure of a vertex of a graph which contains an identification
-          number, a linked list of all edges and a next position to traverse
-          to the next vertices.
+          number and a linked list of all edges.
 
-  @details This structure contains a next field to traverse to other vertices
-           which were hashed to the same position of the hash table. This
-           solution is a simple yet effective way to handle collisions in the
-           hash table.
+  @details The incoming edges are only kept while the graph tracks them, see
+           EnableInEdgeIndex. Each one mirrors an outgoing edge of another
+           vertex, with dest holding the dense index of that source vertex.
 **/
 typedef struct Vertex {
-  unsigned int id;      // Vertex id (identification)
-  Edge* edges;          // Start of linked list of adjacent vertices
-  struct Vertex* next;  // Next vertex in the hash position
+  unsigned int id;     // Vertex id (identification)
+  unsigned int index;  // Dense index, stable while the vertex exists
+  EdgeList edges;      // Outgoing edges, to adjacent vertices
+  EdgeList inEdges;    // Incoming edges, empty unless they are tracked
 } Vertex;
 
+/**
+  @struct VertexIndex
+  @brief  Open-addressing hash table from vertex identifiers to vertices.
+
+  @details The table follows the layout of a Swiss table. Slots are grouped,
+           and every slot has a control byte which is either empty, deleted,
+           or holds 7 bits of the hash of the identifier stored in it. A
+           lookup compares a whole group of control bytes at once and only
+           reads the identifiers of the few slots whose byte matches. The
+           identifiers are stored inline, apart from the vertex pointers, so
+           they share as few cache lines as possible.
+**/
+typedef struct VertexIndex {
+  unsigned int capacity;    // Number of slots, a power of two
+  unsigned int size;        // Number of slots holding a vertex
+  unsigned int tombstones;  // Number of slots marked as deleted
+  signed char* control;     // Control byte of every slot
+  unsigned int* ids;        // Identifier of the vertex in every slot
+  Vertex** vertices;        // Vertex in every slot
+} VertexIndex;
+
+/**
+  @struct Slab
+  @brief  Header of a block of memory holding many nodes of a NodePool.
+**/
+typedef struct Slab {
+  struct Slab* next;  // Previously allocated slab
+} Slab;
+
+/**
+  @struct NodePool
+  @brief  Slab allocator for nodes of a single size, such as vertices or
+          edges.
+
+  @details Nodes are carved out of large slabs, so creating a node rarely
+           calls malloc. Released nodes are kept in a free list, linked
+           through their own memory, and are reused first. The nodes are only
+           returned to the system when the whole pool is freed, one slab at a
+           time.
+**/
+typedef struct NodePool {
+  size_t nodeSize;            // Size of each node, rounded up for alignment
+  unsigned int nodesPerSlab;  // Number of nodes held by each new slab
+  unsigned int slabCapacity;  // Number of nodes held by the newest slab
+  unsigned int usedInSlab;    // Nodes already carved out of the newest slab
+  Slab* slabs;                // Newest slab, linked to the older ones
+  void* freeList;             // Released nodes waiting to be reused
+} NodePool;
+
 /**
   @struct Graph
   @brief  Structure of a graph built with a hash table for vertices and linked
-          lists for edges.
+          lists of edge blocks for edges.
+
+  @details The hash table grows and shrinks with the number of vertices. A
+           resize allocates the new table and then migrates a few slots of
+           the old one on every later insertion or removal, so the cost is
+           spread out instead of being paid by a single call. While a
+           migration is in progress, vertices may live in either table.
+
+           Besides its identifier, every vertex has a dense index below
+           indexCount. Edges refer to their destination by this index and
+           algorithms size their arrays by indexCount, so memory per query
+           follows the number of vertices instead of the identifiers in use.
+           The indices of removed vertices are reused by new ones.
 **/
 typedef struct Graph {
-  unsigned int numVertices;  // Current number of vertices of the graph
-  unsigned int hashSize;     // Current size of hash table
-  Vertex** vertices;         // Hash table of vertices
+  unsigned int numVertices;     // Current number of vertices of the graph
+  VertexIndex index;            // Hash table of vertices
+  VertexIndex oldIndex;         // Table being migrated, capacity 0 if none
+  unsigned int rehashIndex;     // Next slot of oldIndex to be migrated
+  NodePool vertexPool;          // Allocator of the vertices of the graph
+  NodePool edgePool;            // Allocator of the edge blocks of the graph
+  Vertex** vertexByIndex;       // Vertex of every dense index, NULL if unused
+  unsigned int indexCount;      // Dense indices handed out so far
+  unsigned int indexCapacity;   // Length of vertexByIndex and freeIndices
+  unsigned int* freeIndices;    // Stack of indices of removed vertices
+  unsigned int numFreeIndices;  // Number of indices in freeIndices
+  bool trackInEdges;            // True if vertices keep their incoming edges
+  unsigned int maxEdgeWeight;   // Highest weight ever added, kept after the
+                                // edge is removed, so it is an upper bound
 } Graph;
 
+/**
+  @struct VertexIterator
+  @brief  Cursor used to visit every vertex of a graph, in both hash tables
+          while a migration is in progress.
+**/
+typedef struct VertexIterator {
+  const Graph* graph;  // Graph being iterated
+  bool inOldTable;     // True once the current table has been exhausted
+  unsigned int slot;   // Next slot to be visited
+} VertexIterator;
+
+/**
+  @struct FrozenGraph
+  @brief  Immutable compressed sparse row (CSR) snapshot of a graph.
+
+  @details Vertices are renumbered densely from 0 to numVertices - 1 in
+           ascending order of their identifiers. The outgoing edges of the
+           vertex with dense index i are stored contiguously in dest and
+           weight, between offsets[i] and offsets[i + 1].
+**/
+typedef struct FrozenGraph {
+  unsigned int numVertices;  // Number of vertices in the snapshot
+  unsigned int numEdges;     // Number of edges in the snapshot
+  unsigned int* ids;         // Dense index -> vertex id, sorted ascending
+  unsigned int* offsets;     // First edge of each vertex (numVertices + 1)
+  unsigned int* dest;        // Dense index of the destination of each edge
+  unsigned int* weight;      // Weight of each edge
+} FrozenGraph;
+
+/**
+  @struct CompressedGraph
+  @brief  Immutable snapshot of a graph with compressed adjacency.
+
+  @details Vertices are numbered as in a FrozenGraph. The outgoing edges of
+           the vertex with dense index i are sorted by destination and stored
+           between bytes offsets[i] and offsets[i + 1] of data. Each edge is
+           a variable-byte destination followed by a variable-byte weight,
+           with 7 bits per byte and the high bit set on every byte but the
+           last. The first destination is stored as the zigzag-encoded
+           difference from i, and every other one as the difference from the
+           previous destination, so neighbouring ids take a single byte.
+**/
+typedef struct CompressedGraph {
+  unsigned int numVertices;  // Number of vertices in the snapshot
+  unsigned int numEdges;     // Number of edges in the snapshot
+  unsigned int* ids;         // Dense index -> vertex id, sorted ascending
+  size_t* offsets;           // First byte of each vertex (numVertices + 1)
+  unsigned char* data;       // Encoded edges of every vertex
+} CompressedGraph;
+
+/**
+  @struct Condensation
+  @brief  Strongly connected components of a graph and the acyclic graph
+          joining them.
+
+  @details Components are numbered in reverse topological order, so every
+           edge of the condensed graph leads from a component to one with a
+           lower number, and sinks come first. The vertices of component c
+           are members[memberOffsets[c]] to members[memberOffsets[c + 1] - 1],
+           and the components it has edges to are stored likewise between
+           edgeOffsets[c] and edgeOffsets[c + 1], each one once.
+**/
+typedef struct Condensation {
+  unsigned int numComponents;   // Number of strongly connected components
+  unsigned int indexCount;      // Dense indices of the graph, length of
+                                // component
+  unsigned int* component;      // Component of every dense index, or
+                                // NO_COMPONENT if the index is unused
+  unsigned int* memberOffsets;  // First member of each component
+                                // (numComponents + 1)
+  unsigned int* members;        // Dense indices grouped by component
+  unsigned int numEdges;        // Number of edges of the condensed graph
+  unsigned int* edgeOffsets;    // First edge of each component
+                                // (numComponents + 1)
+  unsigned int* edgeDest;       // Component reached by each edge
+} Condensation;
+
 #endif  // !GRAPH_STRUCTURE_H
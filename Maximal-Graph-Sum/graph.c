@@ -13,10 +13,17 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "edge-index.h"
+#include "node-pool.h"
+#include "vertex-index.h"
+#include "vertices.h"
+
 /**
  *  @brief  Creates a new graph with the specified number of vertices and hash
  *          table size.
- *  @param  hashSize    - The size of the hash table used to store vertices.
+ *  @param  hashSize    - The initial size of the hash table used to store
+ *                        vertices, rounded up to a power of two. The table
+ *                        grows and shrinks with the graph afterwards.
  *  @retval             - A pointer to the newly created graph.
  *  @retval             - NULL if memory allocation fails.
  */
@@ -27,9 +34,18 @@ Graph* CreateGraph(unsigned int hashSize) {
   }
 
   graph->numVertices = 0;
-  graph->hashSize = hashSize;
-  graph->vertices = (Vertex**)calloc(hashSize, sizeof(Vertex*));
-  if (graph->vertices == NULL) {  // Additional check for calloc failure
+  graph->rehashIndex = 0;
+  graph->oldIndex = (VertexIndex){ 0 };  // No migration in progress
+  InitNodePool(&graph->vertexPool, sizeof(Vertex), DEFAULT_NODES_PER_SLAB);
+  InitNodePool(&graph->edgePool, sizeof(EdgeBlock), DEFAULT_BLOCKS_PER_SLAB);
+  graph->vertexByIndex = NULL;  // Dense indices are allocated on demand
+  graph->indexCount = 0;
+  graph->indexCapacity = 0;
+  graph->freeIndices = NULL;
+  graph->numFreeIndices = 0;
+  graph->trackInEdges = false;  // Enabled on demand by EnableInEdgeIndex
+  graph->maxEdgeWeight = 0;
+  if (!InitVertexIndex(&graph->index, hashSize)) {
     free(graph);  // Free previously allocated memory to avoid memory leak
     return NULL;
   }
@@ -49,32 +65,33 @@ void DisplayGraph(const Graph* graph) {
 
   printf("Graph with %u vertices:\n", graph->numVertices);
 
-  // Iterate over the hash table array to display graph
-  for (unsigned int i = 0; i < graph->hashSize; ++i) {
-    Vertex* vertex = graph->vertices[i];
-
-    while (vertex != NULL) {  // Traverse the linked list of vertices
-      printf("Vertex ID %d -> ", vertex->id);
+  // Iterate over every vertex of the hash table to display graph
+  VertexIterator iterator;
+  InitVertexIterator(&iterator, graph);
 
-      if (vertex->edges == NULL) {
-        printf("No edges\n");
-      } else {
-        PrintEdges(vertex->edges);
-      }
+  Vertex* vertex;
+  while ((vertex = NextVertex(&iterator)) != NULL) {
+    printf("Vertex ID %d -> ", vertex->id);
 
-      vertex = vertex->next;  // Move to the next vertex in the linked list
+    if (vertex->edges.head == NULL) {
+      printf("No edges\n");
+    } else {
+      PrintEdges(graph, &vertex->edges);
     }
   }
 }
 
 /**
-    @brief Prints all edges within an edges linked list.
-    @param edge - The first edge.
+    @brief Prints all edges within an edge list.
+    @param graph - The graph which contains the edges.
+    @param edges - The edge list to be printed.
 **/
-void PrintEdges(const Edge* edge) {
-  while (edge != NULL) {
-    printf("(%d, %d) ", edge->dest, edge->weight);
-    edge = edge->next;
+void PrintEdges(const Graph* graph, const EdgeList* edges) {
+  for (const EdgeBlock* block = edges->head; block; block = block->next) {
+    for (unsigned int i = 0; i < block->count; i++) {
+      printf("(%d, %d) ", graph->vertexByIndex[block->dest[i]]->id,
+             block->weight[i]);
+    }
   }
   printf("\n");
 }
@@ -84,31 +101,30 @@ void PrintEdges(const Edge* edge) {
     @param graph - The graph to be freed.
 **/
 void FreeGraph(Graph* graph) {
-  if (graph == NULL || graph->vertices == NULL) {
-    return;  // Early return if graph or vertices are NULL
+  if (graph == NULL) {
+    return;  // Early return if graph is NULL
   }
 
-  // Free each vertex's edges
-  for (unsigned int i = 0; i < graph->hashSize; i++) {
-    Vertex* vertex = graph->vertices[i];
-    while (vertex != NULL) {
-      Vertex* nextVertex = vertex->next;
-
-      // Free all edges of the current vertex
-      Edge* edge = vertex->edges;
-      while (edge != NULL) {
-        Edge* nextEdge = edge->next;
-        free(edge);       // Free the edge
-        edge = nextEdge;  // Move to the next edge
-      }
-
-      free(vertex);         // Free the vertex itself
-      vertex = nextVertex;  // Move to the next vertex in the linked list
+  // Only the edge indices of high-degree vertices live outside the pools
+  for (unsigned int i = 0; i < graph->indexCount; i++) {
+    Vertex* vertex = graph->vertexByIndex[i];
+    if (vertex != NULL) {
+      FreeEdgeIndex(vertex->edges.index);
+      FreeEdgeIndex(vertex->inEdges.index);
     }
   }
 
-  // Free the array of vertices
-  free(graph->vertices);
+  // Every vertex and edge lives in a slab of the pools, so they are freed a
+  // slab at a time instead of walking the graph node by node
+  FreeNodePool(&graph->vertexPool);
+  FreeNodePool(&graph->edgePool);
+
+  // Free the vertex index, including one still being migrated
+  FreeVertexIndex(&graph->index);
+  FreeVertexIndex(&graph->oldIndex);
+
+  free(graph->vertexByIndex);
+  free(graph->freeIndices);
 
   // Free the graph itself
   free(graph);
@@ -18,7 +18,9 @@
 /**
  *  @brief  Creates a new graph with the specified number of vertices and hash
  *          table size.
- *  @param  hashSize    - The size of the hash table used to store vertices.
+ *  @param  hashSize    - The initial size of the hash table used to store
+ *                        vertices, rounded up to a power of two. The table
+ *                        grows and shrinks with the graph afterwards.
  *  @retval             - A pointer to the newly created graph.
  *  @retval             - NULL if memory allocation fails.
  */
@@ -31,10 +33,11 @@ Graph* CreateGraph(unsigned int hashSize);
 void DisplayGraph(const Graph* graph);
 
 /**
-    @brief Prints all edges within an edges linked list.
-    @param edge - The first edge.
+    @brief Prints all edges within an edge list.
+    @param graph - The graph which contains the edges.
+    @param edges - The edge list to be printed.
 **/
-void PrintEdges(const Edge* edge);
+void PrintEdges(const Graph* graph, const EdgeList* edges);
 
 /**
     @brief Frees a given graph from memory.
@@ -0,0 +1,482 @@
+/**
+
+    @file      held-karp.c
+    @brief     Function implementations for the exact search of the simple
+               path with maximum weight in a small graph, by dynamic
+               programming over subsets of vertices.
+    @details   The reductions use AVX2 when it is enabled, SSE2 on any x64 or
+               SSE2 target, and a portable loop otherwise.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#include "held-karp.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parallel.h"
+#include "path-subgraph.h"
+#include "vertices.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LANE_WIDTH 8
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LANE_WIDTH 4
+#define USE_SSE2_LANES
+#else
+#define LANE_WIDTH 4
+#endif
+
+#define DIRECT_EDGE 0xFFFFFFFF  // Last vertex of a path which is one edge
+
+/**
+    @struct PathEnd
+    @brief Best complete path found by a task.
+**/
+typedef struct PathEnd {
+  uint32_t value;     // Weight of the path plus 1, 0 if none was found
+  uint32_t subset;    // Vertices between src and dest
+  unsigned int last;  // Vertex before dest, DIRECT_EDGE for the edge src-dest
+} PathEnd;
+
+/**
+    @struct HeldKarpContext
+    @brief Table and edges shared by the tasks of every layer.
+
+    @details Entries are stored as the weight of the path plus 1, so 0 marks
+             a missing path or edge, and rows are padded with 0 to a multiple
+             of LANE_WIDTH.
+**/
+typedef struct HeldKarpContext {
+  unsigned int numInner;   // Vertices between src and dest
+  unsigned int stride;     // Entries per row, numInner rounded up
+  uint32_t* table;         // Row of every subset, entry v for the paths
+                           // ending at v
+  uint32_t* inWeight;      // Row of every vertex v, entry u for the weight
+                           // of the edge from u to v
+  uint32_t* inMask;        // Same rows, all bits set where the edge exists
+  uint32_t* fromSrc;       // Weight plus 1 of the edge from src, or 0
+  uint32_t* toDest;        // Weight plus 1 of the edge to dest, or 0
+  unsigned int layer;      // Size of the subsets of the current layer
+  uint32_t binomial[HELD_KARP_MAX_VERTICES + 1][HELD_KARP_MAX_VERTICES + 1];
+  unsigned int numTasks;   // Number of tasks of the current layer
+  PathEnd best[MAX_THREADS];  // Best path of each task in the current layer
+} HeldKarpContext;
+
+/**
+    @brief Finds the heaviest path into a vertex, given the row of the subset
+           without it and the row of its incoming edges.
+    @param row Row of the table for the smaller subset.
+    @param weight Weight of the edge from each vertex.
+    @param mask All bits set for each vertex with an edge.
+    @param stride Number of entries of each row.
+    @return The weight of the heaviest path plus 1, or 0 if there is none.
+**/
+static inline uint32_t MaxIncoming(const uint32_t* row, const uint32_t* weight,
+                                   const uint32_t* mask, unsigned int stride) {
+#if defined(__AVX2__)
+  __m256i zero = _mm256_setzero_si256();
+  __m256i best = zero;
+  for (unsigned int u = 0; u < stride; u += LANE_WIDTH) {
+    __m256i value = _mm256_loadu_si256((const __m256i*)(row + u));
+    __m256i valid = _mm256_andnot_si256(
+        _mm256_cmpeq_epi32(value, zero),
+        _mm256_loadu_si256((const __m256i*)(mask + u)));
+    __m256i sum = _mm256_add_epi32(
+        value, _mm256_loadu_si256((const __m256i*)(weight + u)));
+    best = _mm256_max_epu32(best, _mm256_and_si256(sum, valid));
+  }
+  __m128i half = _mm_max_epu32(_mm256_castsi256_si128(best),
+                               _mm256_extracti128_si256(best, 1));
+  half = _mm_max_epu32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+  half = _mm_max_epu32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+  return (uint32_t)_mm_cvtsi128_si32(half);
+#elif defined(USE_SSE2_LANES)
+  // SSE2 only compares signed lanes, so the sign bit is flipped to compare
+  // the sums as unsigned
+  __m128i zero = _mm_setzero_si128();
+  __m128i sign = _mm_set1_epi32((int)0x80000000);
+  __m128i best = sign;
+  for (unsigned int u = 0; u < stride; u += LANE_WIDTH) {
+    __m128i value = _mm_loadu_si128((const __m128i*)(row + u));
+    __m128i valid =
+        _mm_andnot_si128(_mm_cmpeq_epi32(value, zero),
+                         _mm_loadu_si128((const __m128i*)(mask + u)));
+    __m128i sum =
+        _mm_add_epi32(value, _mm_loadu_si128((const __m128i*)(weight + u)));
+    __m128i candidate = _mm_xor_si128(_mm_and_si128(sum, valid), sign);
+    __m128i greater = _mm_cmpgt_epi32(candidate, best);
+    best = _mm_or_si128(_mm_and_si128(greater, candidate),
+                        _mm_andnot_si128(greater, best));
+  }
+  uint32_t lanes[LANE_WIDTH];
+  _mm_storeu_si128((__m128i*)lanes, _mm_xor_si128(best, sign));
+  uint32_t result = lanes[0];
+  for (unsigned int i = 1; i < LANE_WIDTH; i++) {
+    if (lanes[i] > result) {
+      result = lanes[i];
+    }
+  }
+  return result;
+#else
+  uint32_t result = 0;
+  for (unsigned int u = 0; u < stride; u++) {
+    if (row[u] != 0 && mask[u] != 0 && row[u] + weight[u] > result) {
+      result = row[u] + weight[u];
+    }
+  }
+  return result;
+#endif
+}
+
+/**
+    @brief Finds the subset of a given size and rank, in the increasing order
+           of the subsets as integers.
+    @param context Pointer to the context, with the binomial coefficients.
+    @param rank Rank of the subset, below the number of subsets of that size.
+    @param size Number of vertices of the subset.
+    @return The subset, with bit v set for each vertex v.
+**/
+static uint32_t UnrankSubset(const HeldKarpContext* context, uint32_t rank,
+                             unsigned int size) {
+  uint32_t subset = 0;
+  unsigned int top = context->numInner;
+  for (unsigned int i = size; i > 0; i--) {
+    // Highest vertex first, the one whose subsets below it outnumber rank
+    top--;
+    while (context->binomial[top][i] > rank) {
+      top--;
+    }
+    subset |= 1u << top;
+    rank -= context->binomial[top][i];
+  }
+  return subset;
+}
+
+/**
+    @brief Fills the rows of a range of subsets of the current layer, and
+           keeps the best path which ends through one of them.
+    @param context Pointer to the HeldKarpContext.
+    @param task Number of the task, which picks the range of subsets.
+**/
+static void LayerTask(void* context, unsigned int task) {
+  HeldKarpContext* karp = (HeldKarpContext*)context;
+  unsigned int size = karp->layer;
+  uint32_t count = karp->binomial[karp->numInner][size];
+  uint32_t first = (uint32_t)((uint64_t)count * task / karp->numTasks);
+  uint32_t last = (uint32_t)((uint64_t)count * (task + 1) / karp->numTasks);
+
+  PathEnd best = {0, 0, DIRECT_EDGE};
+  if (first == last) {
+    karp->best[task] = best;
+    return;
+  }
+
+  uint32_t subset = UnrankSubset(karp, first, size);
+  for (uint32_t rank = first; rank < last; rank++) {
+    uint32_t* row = karp->table + (size_t)subset * karp->stride;
+    for (unsigned int v = 0; v < karp->numInner; v++) {
+      if ((subset & (1u << v)) == 0) {
+        continue;
+      }
+
+      uint32_t value;
+      if (size == 1) {
+        value = karp->fromSrc[v];
+      } else {
+        uint32_t smaller = subset ^ (1u << v);
+        value = MaxIncoming(karp->table + (size_t)smaller * karp->stride,
+                            karp->inWeight + (size_t)v * karp->stride,
+                            karp->inMask + (size_t)v * karp->stride,
+                            karp->stride);
+      }
+      row[v] = value;
+
+      if (value != 0 && karp->toDest[v] != 0) {
+        uint32_t total = value + karp->toDest[v] - 1;
+        if (total > best.value) {
+          best.value = total;
+          best.subset = subset;
+          best.last = v;
+        }
+      }
+    }
+
+    // Next subset of the same size, in increasing order
+    uint32_t lowest = subset & (0u - subset);
+    uint32_t ripple = subset + lowest;
+    subset = (((ripple ^ subset) >> 2) / lowest) | ripple;
+  }
+
+  karp->best[task] = best;
+}
+
+/**
+    @brief Builds the edges of the context from the vertices on paths between
+           src and dest, numbering the others from 0 in their local order.
+    @param karp Pointer to the context, with numInner and stride set.
+    @param subgraph Pointer to the subgraph.
+    @param inner Array of the numVertices of the subgraph, set to the number
+                 of each vertex between src and dest.
+    @param direct Pointer to store the weight plus 1 of the edge from src to
+                  dest, or 0.
+**/
+static void FillEdges(HeldKarpContext* karp, const PathSubgraph* subgraph,
+                      unsigned int* inner, uint32_t* direct) {
+  unsigned int count = 0;
+  for (unsigned int u = 0; u < subgraph->numVertices; u++) {
+    inner[u] = (u == subgraph->src || u == subgraph->dest) ? DIRECT_EDGE
+                                                            : count++;
+  }
+
+  *direct = 0;
+  for (unsigned int u = 0; u < subgraph->numVertices; u++) {
+    for (unsigned int e = subgraph->offsets[u]; e < subgraph->offsets[u + 1];
+         e++) {
+      unsigned int v = subgraph->edges[e].vertex;
+      uint32_t weight = subgraph->edges[e].weight;
+      if (u == subgraph->src) {
+        if (v == subgraph->dest) {
+          *direct = weight + 1;
+        } else {
+          karp->fromSrc[inner[v]] = weight + 1;
+        }
+      } else if (v == subgraph->dest) {
+        karp->toDest[inner[u]] = weight + 1;
+      } else {
+        size_t position = (size_t)inner[v] * karp->stride + inner[u];
+        karp->inWeight[position] = weight;
+        karp->inMask[position] = 0xFFFFFFFF;
+      }
+    }
+  }
+}
+
+/**
+    @brief Rebuilds the best path from the table, walking back from its last
+           vertex through the subsets.
+    @param karp Pointer to the filled context.
+    @param end Best complete path.
+    @param subgraph Pointer to the subgraph.
+    @param local Array of the numInner local indices of the vertices between
+                 src and dest.
+    @param path Array to store the identifiers of the path, from src to dest.
+    @return The number of vertices of the path.
+**/
+static unsigned int RebuildPath(const HeldKarpContext* karp, PathEnd end,
+                                const PathSubgraph* subgraph,
+                                const unsigned int* local,
+                                unsigned int* path) {
+  unsigned int length = 2;
+  for (uint32_t s = end.subset; s != 0; s &= s - 1) {
+    length++;
+  }
+
+  path[0] = subgraph->ids[subgraph->src];
+  path[length - 1] = subgraph->ids[subgraph->dest];
+
+  uint32_t subset = end.subset;
+  unsigned int v = end.last;
+  for (unsigned int position = length - 2; position > 0; position--) {
+    path[position] = subgraph->ids[local[v]];
+
+    uint32_t smaller = subset ^ (1u << v);
+    if (smaller == 0) {
+      break;
+    }
+
+    // Any vertex whose path plus its edge gives the stored value will do
+    uint32_t value = karp->table[(size_t)subset * karp->stride + v];
+    const uint32_t* row = karp->table + (size_t)smaller * karp->stride;
+    size_t edges = (size_t)v * karp->stride;
+    for (unsigned int u = 0; u < karp->numInner; u++) {
+      if (row[u] != 0 && karp->inMask[edges + u] != 0 &&
+          row[u] + karp->inWeight[edges + u] == value) {
+        v = u;
+        break;
+      }
+    }
+    subset = smaller;
+  }
+
+  return length;
+}
+
+/**
+    @brief Frees the arrays of a context.
+    @param karp Pointer to the context.
+**/
+static void FreeHeldKarpContext(HeldKarpContext* karp) {
+  free(karp->table);
+  free(karp->inWeight);
+  free(karp->inMask);
+  free(karp->fromSrc);
+  free(karp->toDest);
+}
+
+/**
+    @brief Finds the simple path with maximum weight between two vertices of
+           any graph, cycles included, in a time which only depends on the
+           number of vertices lying on paths between them.
+
+    @details The vertices reachable from src which can also reach dest are
+             kept, and the ones between src and dest are numbered 0 to
+             n - 1, with n = numVertices - 2. For every subset of them and
+             every vertex v of the subset, the table holds the heaviest path
+             from src through exactly that subset ending at v, computed as in
+             the Held-Karp algorithm from the subsets one vertex smaller. The
+             heaviest edge into v is a max-reduction over a row of the table,
+             done 8 or 4 entries at a time with AVX2 or SSE2. Subsets of the
+             same size only depend on smaller ones, so each size is a layer
+             whose subsets are split among the threads.
+
+             The search takes O(2^n * n^2) time and about 4 * 2^n * n bytes,
+             400 MB with HELD_KARP_MAX_VERTICES, whatever the number of
+             edges, unlike FindAllPaths whose time follows the number of
+             paths. Sums are kept in 32 bits, as CalculatePathSum does.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param numThreads Number of threads, or 0 for GetThreadCount.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices with maximum weight, NULL if
+                there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST, GRAPH_TOO_LARGE if more than
+            HELD_KARP_MAX_VERTICES vertices lie on paths from src to dest,
+            or FAILURE_ALLOCATING_SEARCH.
+**/
+int HeldKarpMaxPath(const Graph* graph, unsigned int src, unsigned int dest,
+                    unsigned int numThreads, unsigned int* maxWeight,
+                    unsigned int** path, unsigned int* pathLength) {
+  *maxWeight = 0;
+  *path = NULL;
+  *pathLength = 0;
+
+  if (graph == NULL) {
+    return INVALID_GRAPH;
+  }
+
+  const Vertex* srcVertex = FindVertex(graph, src);
+  const Vertex* destVertex = FindVertex(graph, dest);
+  if (srcVertex == NULL || destVertex == NULL) {
+    return VERTEX_DOES_NOT_EXIST;
+  }
+
+  if (src == dest) {
+    *path = (unsigned int*)malloc(sizeof(unsigned int));
+    if (*path == NULL) {
+      return FAILURE_ALLOCATING_SEARCH;
+    }
+    (*path)[0] = src;
+    *pathLength = 1;
+    return SUCCESS_SEARCHING_PATH;
+  }
+
+  if (numThreads == 0 || numThreads > MAX_THREADS) {
+    numThreads = numThreads == 0 ? GetThreadCount() : MAX_THREADS;
+  }
+
+  PathSubgraph subgraph;
+  if (!BuildPathSubgraph(graph, srcVertex->index, destVertex->index,
+                         &subgraph)) {
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+  if (subgraph.numVertices == 0) {
+    return SUCCESS_SEARCHING_PATH;
+  }
+  if (subgraph.numVertices > HELD_KARP_MAX_VERTICES) {
+    FreePathSubgraph(&subgraph);
+    return GRAPH_TOO_LARGE;
+  }
+
+  HeldKarpContext* karp =
+      (HeldKarpContext*)calloc(1, sizeof(HeldKarpContext));
+  if (karp == NULL) {
+    FreePathSubgraph(&subgraph);
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+
+  unsigned int n = subgraph.numVertices - 2;
+  karp->numInner = n;
+  karp->stride = (n + LANE_WIDTH - 1) / LANE_WIDTH * LANE_WIDTH;
+  size_t rowBytes = (size_t)(karp->stride > 0 ? karp->stride : 1) *
+                    sizeof(uint32_t);
+  karp->table = (uint32_t*)calloc((size_t)1 << n, rowBytes);
+  karp->inWeight = (uint32_t*)calloc(n > 0 ? n : 1, rowBytes);
+  karp->inMask = (uint32_t*)calloc(n > 0 ? n : 1, rowBytes);
+  karp->fromSrc = (uint32_t*)calloc(n > 0 ? n : 1, sizeof(uint32_t));
+  karp->toDest = (uint32_t*)calloc(n > 0 ? n : 1, sizeof(uint32_t));
+  unsigned int* inner =
+      (unsigned int*)malloc(subgraph.numVertices * sizeof(unsigned int));
+  unsigned int* local =
+      (unsigned int*)malloc(subgraph.numVertices * sizeof(unsigned int));
+  if (karp->table == NULL || karp->inWeight == NULL || karp->inMask == NULL ||
+      karp->fromSrc == NULL || karp->toDest == NULL || inner == NULL ||
+      local == NULL) {
+    free(inner);
+    free(local);
+    FreeHeldKarpContext(karp);
+    free(karp);
+    FreePathSubgraph(&subgraph);
+    return FAILURE_ALLOCATING_SEARCH;
+  }
+
+  for (unsigned int i = 0; i <= n; i++) {
+    karp->binomial[i][0] = 1;
+    for (unsigned int j = 1; j <= i; j++) {
+      karp->binomial[i][j] =
+          karp->binomial[i - 1][j - 1] + karp->binomial[i - 1][j];
+    }
+  }
+
+  PathEnd best = {0, 0, DIRECT_EDGE};
+  FillEdges(karp, &subgraph, inner, &best.value);
+  for (unsigned int u = 0; u < subgraph.numVertices; u++) {
+    if (inner[u] != DIRECT_EDGE) {
+      local[inner[u]] = u;
+    }
+  }
+
+  for (unsigned int size = 1; size <= n; size++) {
+    uint32_t count = karp->binomial[n][size];
+    karp->layer = size;
+    karp->numTasks = count < HELD_KARP_PARALLEL_MIN_SUBSETS ? 1 : numThreads;
+    ParallelFor(karp->numTasks, LayerTask, karp);
+
+    // Tasks cover the subsets in order, so ties keep the first subset and
+    // the result does not depend on the number of threads
+    for (unsigned int task = 0; task < karp->numTasks; task++) {
+      if (karp->best[task].value > best.value) {
+        best = karp->best[task];
+      }
+    }
+  }
+
+  int result = SUCCESS_SEARCHING_PATH;
+  if (best.value != 0) {
+    *path = (unsigned int*)malloc((n + 2) * sizeof(unsigned int));
+    if (*path == NULL) {
+      result = FAILURE_ALLOCATING_SEARCH;
+    } else {
+      *pathLength = RebuildPath(karp, best, &subgraph, local, *path);
+      *maxWeight = best.value - 1;
+    }
+  }
+
+  free(inner);
+  free(local);
+  FreeHeldKarpContext(karp);
+  free(karp);
+  FreePathSubgraph(&subgraph);
+
+  return result;
+}
@@ -0,0 +1,59 @@
+/**
+
+    @file      held-karp.h
+    @brief     Function definitions for the exact search of the simple path
+               with maximum weight in a small graph, by dynamic programming
+               over subsets of vertices.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef HELD_KARP_H
+#define HELD_KARP_H
+
+#include "graph.h"
+
+#define HELD_KARP_MAX_VERTICES 24  // Vertices on paths from src to dest
+#define HELD_KARP_PARALLEL_MIN_SUBSETS 4096  // Subsets of a layer which are
+                                             // worth splitting among threads
+
+/**
+    @brief Finds the simple path with maximum weight between two vertices of
+           any graph, cycles included, in a time which only depends on the
+           number of vertices lying on paths between them.
+
+    @details The vertices reachable from src which can also reach dest are
+             kept, and the ones between src and dest are numbered 0 to
+             n - 1, with n = numVertices - 2. For every subset of them and
+             every vertex v of the subset, the table holds the heaviest path
+             from src through exactly that subset ending at v, computed as in
+             the Held-Karp algorithm from the subsets one vertex smaller. The
+             heaviest edge into v is a max-reduction over a row of the table,
+             done 8 or 4 entries at a time with AVX2 or SSE2. Subsets of the
+             same size only depend on smaller ones, so each size is a layer
+             whose subsets are split among the threads.
+
+             The search takes O(2^n * n^2) time and about 4 * 2^n * n bytes,
+             400 MB with HELD_KARP_MAX_VERTICES, whatever the number of
+             edges, unlike FindAllPaths whose time follows the number of
+             paths. Sums are kept in 32 bits, as CalculatePathSum does.
+    @param graph Pointer to the graph structure.
+    @param src Source vertex identifier.
+    @param dest Destination vertex identifier.
+    @param numThreads Number of threads, or 0 for GetThreadCount.
+    @param maxWeight Pointer to store the maximum path weight, 0 if there is no
+                     path.
+    @param path Pointer to store the path vertices with maximum weight, NULL if
+                there is no path.
+    @param pathLength Pointer to store the length of the path.
+    @return SUCCESS_SEARCHING_PATH, even if there is no path, INVALID_GRAPH,
+            VERTEX_DOES_NOT_EXIST, GRAPH_TOO_LARGE if more than
+            HELD_KARP_MAX_VERTICES vertices lie on paths from src to dest,
+            or FAILURE_ALLOCATING_SEARCH.
+**/
+int HeldKarpMaxPath(const Graph* graph, unsigned int src, unsigned int dest,
+                    unsigned int numThreads, unsigned int* maxWeight,
+                    unsigned int** path, unsigned int* pathLength);
+
+#endif  // !HELD_KARP_H
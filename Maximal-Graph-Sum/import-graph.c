@@ -105,7 +105,7 @@ int ImportGraph(const char* filename, Graph* graph) {
       unsigned int weight = atoi(token);
 
       CreateAddVertex(graph, destID);
-      CreateAddEdge(vertex, destID, weight);
+      CreateAddEdge(graph, vertex, destID, weight);
     }
   }
 
@@ -122,22 +122,11 @@ int ImportGraph(const char* filename, Graph* graph) {
  */
 static Graph* CreateGraphFromFile(FILE* file) {
   unsigned int hashSize;
-  fread(&hashSize, sizeof(unsigned int), 1, file);
-
-  Graph* graph = malloc(sizeof(Graph));
-  if (graph == NULL) {
-    return NULL;
-  }
-
-  graph->vertices = calloc(hashSize, sizeof(Vertex*));
-  if (graph->vertices == NULL) {
-    free(graph);
+  if (fread(&hashSize, sizeof(unsigned int), 1, file) != 1) {
     return NULL;
   }
-  graph->numVertices = 0;
-  graph->hashSize = hashSize;
 
-  return graph;
+  return CreateGraph(hashSize);
 }
 
 /**
@@ -147,24 +136,26 @@ static Graph* CreateGraphFromFile(FILE* file) {
  *  @retval       - `EXIT_SUCCESS` on success, `EXIT_FAILURE` on failure.
  */
 static int ReadVerticesAndEdgesFromFile(Graph* graph, FILE* file) {
-  for (unsigned int i = 0; i < graph->hashSize; ++i) {
-    unsigned int vertexId;
+  unsigned int vertexId;
 
-    while (fread(&vertexId, sizeof(unsigned int), 1, file) == 1) {
-      if (vertexId == END_MARKER) {
-        break;
-      }
-
-      CreateAddVertex(graph, vertexId);
-      Vertex* vertex = FindVertex(graph, vertexId);
+  // Every vertex record ends with END_MARKER, and a last END_MARKER closes
+  // the list of vertices
+  while (fread(&vertexId, sizeof(unsigned int), 1, file) == 1) {
+    if (vertexId == END_MARKER) {
+      break;
+    }
 
-      unsigned int dest;
-      unsigned int weight;
-      while (fread(&dest, sizeof(unsigned int), 1, file) == 1 &&
-             dest != END_MARKER &&
-             fread(&weight, sizeof(unsigned int), 1, file) == 1) {
-        CreateAddEdge(vertex, dest, weight);
-      }
+    CreateAddVertex(graph, vertexId);
+    Vertex* vertex = FindVertex(graph, vertexId);
+
+    unsigned int dest;
+    unsigned int weight;
+    while (fread(&dest, sizeof(unsigned int), 1, file) == 1 &&
+           dest != END_MARKER &&
+           fread(&weight, sizeof(unsigned int), 1, file) == 1) {
+      // The destination may only be saved later in the file
+      CreateAddVertex(graph, dest);
+      CreateAddEdge(graph, vertex, dest, weight);
     }
   }
 
@@ -191,6 +182,7 @@ Graph* LoadGraph(const char* filename) {
 
   if (ReadVerticesAndEdgesFromFile(graph, file) != EXIT_SUCCESS) {
     fclose(file);
+    FreeGraph(graph);
     return NULL;
   }
 
@@ -0,0 +1,140 @@
+/**
+ *
+ *  @file      node-pool.c
+ *  @brief     Function implementations for the slab allocator of graph nodes.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "node-pool.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// Nodes start after the slab header, kept aligned for any node type
+#define NODE_ALIGNMENT 16
+#define SLAB_HEADER_SIZE \
+  ((sizeof(Slab) + NODE_ALIGNMENT - 1) / NODE_ALIGNMENT * NODE_ALIGNMENT)
+
+/**
+ *  @brief Initializes an empty pool. No memory is allocated until the first
+ *         node is requested.
+ *  @param pool         - The pool to be initialized.
+ *  @param nodeSize     - The size of every node handed out by the pool.
+ *  @param nodesPerSlab - The number of nodes carved out of each slab.
+ */
+void InitNodePool(NodePool* pool, size_t nodeSize, unsigned int nodesPerSlab) {
+  // A released node stores the free list link in its first bytes
+  if (nodeSize < sizeof(void*)) {
+    nodeSize = sizeof(void*);
+  }
+
+  pool->nodeSize = (nodeSize + sizeof(void*) - 1) / sizeof(void*) *
+                   sizeof(void*);
+  pool->nodesPerSlab = nodesPerSlab > 0 ? nodesPerSlab : 1;
+  pool->slabCapacity = 0;
+  pool->usedInSlab = 0;
+  pool->slabs = NULL;
+  pool->freeList = NULL;
+}
+
+/**
+ *  @brief  Allocates a new slab, which becomes the one nodes are carved out
+ *          of. The nodes left in the previous slab are not used.
+ *  @param  pool     - The pool which receives the slab.
+ *  @param  capacity - The number of nodes held by the slab.
+ *  @retval          - True in the case of success.
+ *  @retval          - False if the slab size overflows size_t or memory
+ *                     allocation fails.
+ */
+static bool AddSlab(NodePool* pool, unsigned int capacity) {
+  // A large reserve would wrap around on 32-bit targets
+  if (capacity > (SIZE_MAX - SLAB_HEADER_SIZE) / pool->nodeSize) {
+    return false;
+  }
+
+  Slab* slab = (Slab*)malloc(SLAB_HEADER_SIZE + pool->nodeSize * capacity);
+  if (slab == NULL) {
+    return false;
+  }
+
+  slab->next = pool->slabs;
+  pool->slabs = slab;
+  pool->slabCapacity = capacity;
+  pool->usedInSlab = 0;
+
+  return true;
+}
+
+/**
+ *  @brief  Hands out an uninitialized node, reusing released nodes first.
+ *  @param  pool - The pool the node is taken from.
+ *  @retval      - A pointer to the node.
+ *  @retval      - NULL if memory allocation fails.
+ */
+void* AllocateNode(NodePool* pool) {
+  if (pool->freeList != NULL) {
+    void* node = pool->freeList;
+    pool->freeList = *(void**)node;
+    return node;
+  }
+
+  if (pool->usedInSlab == pool->slabCapacity &&
+      !AddSlab(pool, pool->nodesPerSlab)) {
+    return NULL;
+  }
+
+  char* nodes = (char*)pool->slabs + SLAB_HEADER_SIZE;
+  return nodes + pool->nodeSize * pool->usedInSlab++;
+}
+
+/**
+ *  @brief  Makes sure the next nodes can be carved out of a single slab,
+ *          allocating a slab of exactly that size when the newest one has
+ *          too few nodes left. Later slabs keep their usual size.
+ *  @param  pool  - The pool which will hand out the nodes.
+ *  @param  count - The number of nodes about to be requested.
+ *  @retval       - True in the case of success.
+ *  @retval       - False if memory allocation fails.
+ */
+bool ReserveNodes(NodePool* pool, unsigned int count) {
+  if (pool->slabCapacity - pool->usedInSlab >= count) {
+    return true;
+  }
+
+  return AddSlab(pool, count);
+}
+
+/**
+ *  @brief Gives a node back to its pool so it can be reused.
+ *  @param pool - The pool the node was taken from.
+ *  @param node - The node to be released. Ignored if NULL.
+ */
+void ReleaseNode(NodePool* pool, void* node) {
+  if (node == NULL) {
+    return;
+  }
+
+  *(void**)node = pool->freeList;
+  pool->freeList = node;
+}
+
+/**
+ *  @brief Frees every slab of a pool, invalidating all of its nodes at once,
+ *         and leaves the pool empty.
+ *  @param pool - The pool to be freed.
+ */
+void FreeNodePool(NodePool* pool) {
+  Slab* slab = pool->slabs;
+  while (slab != NULL) {
+    Slab* next = slab->next;
+    free(slab);
+    slab = next;
+  }
+
+  pool->slabs = NULL;
+  pool->freeList = NULL;
+  pool->slabCapacity = 0;
+  pool->usedInSlab = 0;
+}
@@ -0,0 +1,61 @@
+/**
+ *  @file      node-pool.h
+ *  @brief     Function definitions for the slab allocator of graph nodes.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "graph-structure.h"
+
+#define DEFAULT_NODES_PER_SLAB 4096
+#define DEFAULT_BLOCKS_PER_SLAB 1024  // Edge blocks are larger than nodes
+
+/**
+ *  @brief Initializes an empty pool. No memory is allocated until the first
+ *         node is requested.
+ *  @param pool         - The pool to be initialized.
+ *  @param nodeSize     - The size of every node handed out by the pool.
+ *  @param nodesPerSlab - The number of nodes carved out of each slab.
+ */
+void InitNodePool(NodePool* pool, size_t nodeSize, unsigned int nodesPerSlab);
+
+/**
+ *  @brief  Hands out an uninitialized node, reusing released nodes first.
+ *  @param  pool - The pool the node is taken from.
+ *  @retval      - A pointer to the node.
+ *  @retval      - NULL if memory allocation fails.
+ */
+void* AllocateNode(NodePool* pool);
+
+/**
+ *  @brief  Makes sure the next nodes can be carved out of a single slab,
+ *          allocating a slab of exactly that size when the newest one has
+ *          too few nodes left. Later slabs keep their usual size.
+ *  @param  pool  - The pool which will hand out the nodes.
+ *  @param  count - The number of nodes about to be requested.
+ *  @retval       - True in the case of success.
+ *  @retval       - False if memory allocation fails.
+ */
+bool ReserveNodes(NodePool* pool, unsigned int count);
+
+/**
+ *  @brief Gives a node back to its pool so it can be reused.
+ *  @param pool - The pool the node was taken from.
+ *  @param node - The node to be released. Ignored if NULL.
+ */
+void ReleaseNode(NodePool* pool, void* node);
+
+/**
+ *  @brief Frees every slab of a pool, invalidating all of its nodes at once,
+ *         and leaves the pool empty.
+ *  @param pool - The pool to be freed.
+ */
+void FreeNodePool(NodePool* pool);
+
+#endif  // !NODE_POOL_H
@@ -0,0 +1,469 @@
+/**
+ *
+ *  @file      parallel.c
+ *  @brief     Function implementations for running tasks on several threads.
+ *  @details   Threads are created with the Windows API, or with POSIX threads
+ *             on other systems.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "parallel.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/**
+  @struct TaskStart
+  @brief  Arguments of a task started on its own thread.
+**/
+typedef struct TaskStart {
+  ParallelTask task;  // Function run by the task
+  void* context;      // Context shared by every task
+  unsigned int index;  // Number of the task
+} TaskStart;
+
+/**
+  @struct ItemQueue
+  @brief  Items of ParallelForItems, claimed one at a time by the tasks.
+**/
+typedef struct ItemQueue {
+  ParallelItemTask task;       // Function run for every item
+  void* context;               // Context given to every call
+  unsigned int numItems;       // Number of items
+  volatile unsigned int next;  // Next item to be claimed
+} ItemQueue;
+
+/**
+  @struct PoolWorker
+  @brief  Arguments of a thread of a pool.
+**/
+typedef struct PoolWorker {
+  ThreadPool* pool;    // Pool the thread belongs to
+  unsigned int index;  // Number of the thread, which runs the task with the
+                       // same number
+} PoolWorker;
+
+/**
+  @struct ThreadPool
+  @brief  Threads waiting for the tasks of RunThreadPool.
+
+  @details Every call raises the generation, so a thread which wakes up
+           knows whether it has new work. Each thread with a task of the
+           call lowers the pending count when it is done, and the last one
+           wakes the caller.
+**/
+struct ThreadPool {
+#ifdef _WIN32
+  SRWLOCK lock;                  // Guards every field below
+  CONDITION_VARIABLE wake;       // Signalled on new work or when stopping
+  CONDITION_VARIABLE done;       // Signalled when the last task ends
+  HANDLE threads[MAX_THREADS];   // Threads of the pool, from 1
+#else
+  pthread_mutex_t lock;          // Guards every field below
+  pthread_cond_t wake;           // Signalled on new work or when stopping
+  pthread_cond_t done;           // Signalled when the last task ends
+  pthread_t threads[MAX_THREADS];  // Threads of the pool, from 1
+#endif
+  bool started[MAX_THREADS];     // True for the threads which are running
+  PoolWorker workers[MAX_THREADS];  // Arguments of every thread
+  unsigned int numThreads;       // Threads of the pool, the caller included
+  ParallelTask task;             // Function of the current call
+  void* context;                 // Context of the current call
+  unsigned int numTasks;         // Number of tasks of the current call
+  unsigned int generation;       // Number of calls so far
+  unsigned int pending;          // Tasks of the current call still running
+  bool stopping;                 // Set when the pool is being freed
+};
+
+/**
+ *  @brief  Gets the number of threads worth running at once, which is the
+ *          number of logical processors, at most MAX_THREADS.
+ *  @retval - The number of threads, at least 1.
+ */
+unsigned int GetThreadCount(void) {
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  long processors = (long)info.dwNumberOfProcessors;
+#else
+  long processors = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+  if (processors < 1) {
+    return 1;
+  }
+  return processors < MAX_THREADS ? (unsigned int)processors : MAX_THREADS;
+}
+
+#ifdef _WIN32
+static DWORD WINAPI RunTask(LPVOID argument) {
+  TaskStart* start = (TaskStart*)argument;
+  start->task(start->context, start->index);
+  return 0;
+}
+#else
+static void* RunTask(void* argument) {
+  TaskStart* start = (TaskStart*)argument;
+  start->task(start->context, start->index);
+  return NULL;
+}
+#endif
+
+/**
+ *  @brief Runs tasks concurrently, one thread each, and waits for all of
+ *         them to finish. The calling thread runs task 0. If a thread cannot
+ *         be started, its task is run by the calling thread instead, so
+ *         tasks must never wait for each other.
+ *  @param numTasks - The number of tasks, at most MAX_THREADS.
+ *  @param task     - The function run by every task.
+ *  @param context  - The context given to every task.
+ */
+void ParallelFor(unsigned int numTasks, ParallelTask task, void* context) {
+  if (numTasks > MAX_THREADS) {
+    numTasks = MAX_THREADS;
+  }
+
+  TaskStart starts[MAX_THREADS];
+  bool started[MAX_THREADS] = { false };
+#ifdef _WIN32
+  HANDLE threads[MAX_THREADS];
+#else
+  pthread_t threads[MAX_THREADS];
+#endif
+
+  for (unsigned int i = 1; i < numTasks; i++) {
+    starts[i] = (TaskStart){ task, context, i };
+#ifdef _WIN32
+    threads[i] = CreateThread(NULL, 0, RunTask, &starts[i], 0, NULL);
+    started[i] = threads[i] != NULL;
+#else
+    started[i] = pthread_create(&threads[i], NULL, RunTask, &starts[i]) == 0;
+#endif
+  }
+
+  if (numTasks > 0) {
+    task(context, 0);
+  }
+
+  for (unsigned int i = 1; i < numTasks; i++) {
+    if (!started[i]) {
+      task(context, i);  // Fall back to the calling thread
+      continue;
+    }
+#ifdef _WIN32
+    WaitForSingleObject(threads[i], INFINITE);
+    CloseHandle(threads[i]);
+#else
+    pthread_join(threads[i], NULL);
+#endif
+  }
+}
+
+/**
+ *  @brief Takes the lock of a pool.
+ *  @param pool - The pool.
+ */
+static void LockPool(ThreadPool* pool) {
+#ifdef _WIN32
+  AcquireSRWLockExclusive(&pool->lock);
+#else
+  pthread_mutex_lock(&pool->lock);
+#endif
+}
+
+/**
+ *  @brief Releases the lock of a pool.
+ *  @param pool - The pool.
+ */
+static void UnlockPool(ThreadPool* pool) {
+#ifdef _WIN32
+  ReleaseSRWLockExclusive(&pool->lock);
+#else
+  pthread_mutex_unlock(&pool->lock);
+#endif
+}
+
+/**
+ *  @brief Waits until the pool has new work or is stopping. The lock of the
+ *         pool is held before and after.
+ *  @param pool - The pool.
+ */
+static void WaitForWork(ThreadPool* pool) {
+#ifdef _WIN32
+  SleepConditionVariableSRW(&pool->wake, &pool->lock, INFINITE, 0);
+#else
+  pthread_cond_wait(&pool->wake, &pool->lock);
+#endif
+}
+
+/**
+ *  @brief Waits until the last task of a call ends. The lock of the pool is
+ *         held before and after.
+ *  @param pool - The pool.
+ */
+static void WaitForTasks(ThreadPool* pool) {
+#ifdef _WIN32
+  SleepConditionVariableSRW(&pool->done, &pool->lock, INFINITE, 0);
+#else
+  pthread_cond_wait(&pool->done, &pool->lock);
+#endif
+}
+
+/**
+ *  @brief Runs the tasks given to one thread of a pool until it stops.
+ *  @param worker - The arguments of the thread.
+ */
+static void WorkInPool(const PoolWorker* worker) {
+  ThreadPool* pool = worker->pool;
+  unsigned int seen = 0;
+
+  LockPool(pool);
+  for (;;) {
+    while (pool->generation == seen && !pool->stopping) {
+      WaitForWork(pool);
+    }
+    if (pool->stopping) {
+      break;
+    }
+
+    // Threads without a task in this call only note that it happened
+    seen = pool->generation;
+    if (worker->index >= pool->numTasks) {
+      continue;
+    }
+
+    ParallelTask task = pool->task;
+    void* context = pool->context;
+    UnlockPool(pool);
+    task(context, worker->index);
+    LockPool(pool);
+
+    if (--pool->pending == 0) {
+#ifdef _WIN32
+      WakeConditionVariable(&pool->done);
+#else
+      pthread_cond_signal(&pool->done);
+#endif
+    }
+  }
+  UnlockPool(pool);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI RunPoolWorker(LPVOID argument) {
+  WorkInPool((const PoolWorker*)argument);
+  return 0;
+}
+#else
+static void* RunPoolWorker(void* argument) {
+  WorkInPool((const PoolWorker*)argument);
+  return NULL;
+}
+#endif
+
+/**
+ *  @brief  Starts the threads of a pool, which wait for work until the pool
+ *          is freed. The calling thread of RunThreadPool is the first one,
+ *          so numThreads - 1 threads are started.
+ *  @param  numThreads - The number of threads, or 0 for GetThreadCount. It
+ *                       is lowered to MAX_THREADS.
+ *  @retval            - A pointer to the pool.
+ *  @retval            - NULL if memory allocation fails.
+ */
+ThreadPool* CreateThreadPool(unsigned int numThreads) {
+  if (numThreads == 0) {
+    numThreads = GetThreadCount();
+  }
+  if (numThreads > MAX_THREADS) {
+    numThreads = MAX_THREADS;
+  }
+
+  ThreadPool* pool = (ThreadPool*)calloc(1, sizeof(ThreadPool));
+  if (pool == NULL) {
+    return NULL;
+  }
+
+#ifdef _WIN32
+  InitializeSRWLock(&pool->lock);
+  InitializeConditionVariable(&pool->wake);
+  InitializeConditionVariable(&pool->done);
+#else
+  if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+    free(pool);
+    return NULL;
+  }
+  if (pthread_cond_init(&pool->wake, NULL) != 0) {
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+    return NULL;
+  }
+  if (pthread_cond_init(&pool->done, NULL) != 0) {
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+    return NULL;
+  }
+#endif
+
+  // Threads which cannot be started leave their tasks to the caller
+  pool->numThreads = numThreads;
+  for (unsigned int i = 1; i < numThreads; i++) {
+    pool->workers[i] = (PoolWorker){ pool, i };
+#ifdef _WIN32
+    pool->threads[i] =
+        CreateThread(NULL, 0, RunPoolWorker, &pool->workers[i], 0, NULL);
+    pool->started[i] = pool->threads[i] != NULL;
+#else
+    pool->started[i] = pthread_create(&pool->threads[i], NULL, RunPoolWorker,
+                                      &pool->workers[i]) == 0;
+#endif
+  }
+
+  return pool;
+}
+
+/**
+ *  @brief Runs tasks concurrently on the threads of a pool, as ParallelFor
+ *         does, and waits for all of them to finish. The calling thread runs
+ *         task 0, and the tasks of threads which could not be started.
+ *  @param pool     - The pool.
+ *  @param numTasks - The number of tasks, lowered to the threads of the
+ *                    pool.
+ *  @param task     - The function run by every task.
+ *  @param context  - The context given to every task.
+ */
+void RunThreadPool(ThreadPool* pool, unsigned int numTasks, ParallelTask task,
+                   void* context) {
+  if (numTasks > pool->numThreads) {
+    numTasks = pool->numThreads;
+  }
+
+  unsigned int pending = 0;
+  for (unsigned int i = 1; i < numTasks; i++) {
+    if (pool->started[i]) {
+      pending++;
+    }
+  }
+
+  if (pending > 0) {
+    LockPool(pool);
+    pool->task = task;
+    pool->context = context;
+    pool->numTasks = numTasks;
+    pool->pending = pending;
+    pool->generation++;
+#ifdef _WIN32
+    WakeAllConditionVariable(&pool->wake);
+#else
+    pthread_cond_broadcast(&pool->wake);
+#endif
+    UnlockPool(pool);
+  }
+
+  if (numTasks > 0) {
+    task(context, 0);
+  }
+  for (unsigned int i = 1; i < numTasks; i++) {
+    if (!pool->started[i]) {
+      task(context, i);  // Fall back to the calling thread
+    }
+  }
+
+  if (pending > 0) {
+    LockPool(pool);
+    while (pool->pending > 0) {
+      WaitForTasks(pool);
+    }
+    UnlockPool(pool);
+  }
+}
+
+/**
+ *  @brief Stops the threads of a pool and frees it from memory.
+ *  @param pool - The pool to be freed. Ignored if NULL.
+ */
+void FreeThreadPool(ThreadPool* pool) {
+  if (pool == NULL) {
+    return;
+  }
+
+  LockPool(pool);
+  pool->stopping = true;
+#ifdef _WIN32
+  WakeAllConditionVariable(&pool->wake);
+#else
+  pthread_cond_broadcast(&pool->wake);
+#endif
+  UnlockPool(pool);
+
+  for (unsigned int i = 1; i < pool->numThreads; i++) {
+    if (!pool->started[i]) {
+      continue;
+    }
+#ifdef _WIN32
+    WaitForSingleObject(pool->threads[i], INFINITE);
+    CloseHandle(pool->threads[i]);
+#else
+    pthread_join(pool->threads[i], NULL);
+#endif
+  }
+
+#ifndef _WIN32
+  pthread_cond_destroy(&pool->done);
+  pthread_cond_destroy(&pool->wake);
+  pthread_mutex_destroy(&pool->lock);
+#endif
+  free(pool);
+}
+
+/**
+ *  @brief Claims and runs items until none is left.
+ *  @param argument - The queue of items.
+ *  @param task     - The number of the task.
+ */
+static void RunItems(void* argument, unsigned int task) {
+  ItemQueue* queue = (ItemQueue*)argument;
+
+  for (;;) {
+    unsigned int item = AtomicFetchIncrement(&queue->next);
+    if (item >= queue->numItems) {
+      return;
+    }
+    queue->task(queue->context, task, item);
+  }
+}
+
+/**
+ *  @brief Runs a function for every item on several threads, and waits for
+ *         all of them to finish. Each task takes the next unclaimed item
+ *         when it is done with its own, so items of uneven cost are still
+ *         balanced. A task runs its items one at a time, so it may own state
+ *         reused across them.
+ *  @param numItems - The number of items.
+ *  @param numTasks - The number of tasks, or 0 for GetThreadCount. It is
+ *                    lowered to numItems and MAX_THREADS.
+ *  @param task     - The function run for every item.
+ *  @param context  - The context given to every call.
+ */
+void ParallelForItems(unsigned int numItems, unsigned int numTasks,
+                      ParallelItemTask task, void* context) {
+  if (numTasks == 0) {
+    numTasks = GetThreadCount();
+  }
+  if (numTasks > numItems) {
+    numTasks = numItems;
+  }
+
+  ItemQueue queue = { task, context, numItems, 0 };
+  ParallelFor(numTasks, RunItems, &queue);
+}
@@ -0,0 +1,171 @@
+/**
+ *  @file      parallel.h
+ *  @brief     Function definitions for running tasks on several threads.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#define MAX_THREADS 64
+
+/**
+ *  @brief Function run by every task of ParallelFor.
+ *  @param context - The context shared by every task.
+ *  @param task    - The number of the task, from 0 to numTasks - 1.
+ */
+typedef void (*ParallelTask)(void* context, unsigned int task);
+
+/**
+ *  @brief Function run for every item of ParallelForItems.
+ *  @param context - The context shared by every task.
+ *  @param task    - The number of the task running the item, from 0 to
+ *                   numTasks - 1.
+ *  @param item    - The number of the item, from 0 to numItems - 1.
+ */
+typedef void (*ParallelItemTask)(void* context, unsigned int task,
+                                 unsigned int item);
+
+/**
+ *  @brief Threads started once and reused by every call of RunThreadPool,
+ *         for callers which run many short parallel steps.
+ */
+typedef struct ThreadPool ThreadPool;
+
+/**
+ *  @brief  Gets the number of threads worth running at once, which is the
+ *          number of logical processors, at most MAX_THREADS.
+ *  @retval - The number of threads, at least 1.
+ */
+unsigned int GetThreadCount(void);
+
+/**
+ *  @brief Runs tasks concurrently, one thread each, and waits for all of
+ *         them to finish. The calling thread runs task 0. If a thread cannot
+ *         be started, its task is run by the calling thread instead, so
+ *         tasks must never wait for each other.
+ *  @param numTasks - The number of tasks, at most MAX_THREADS.
+ *  @param task     - The function run by every task.
+ *  @param context  - The context given to every task.
+ */
+void ParallelFor(unsigned int numTasks, ParallelTask task, void* context);
+
+/**
+ *  @brief  Starts the threads of a pool, which wait for work until the pool
+ *          is freed. The calling thread of RunThreadPool is the first one,
+ *          so numThreads - 1 threads are started.
+ *  @param  numThreads - The number of threads, or 0 for GetThreadCount. It
+ *                       is lowered to MAX_THREADS.
+ *  @retval            - A pointer to the pool.
+ *  @retval            - NULL if memory allocation fails.
+ */
+ThreadPool* CreateThreadPool(unsigned int numThreads);
+
+/**
+ *  @brief Runs tasks concurrently on the threads of a pool, as ParallelFor
+ *         does, and waits for all of them to finish. The calling thread runs
+ *         task 0, and the tasks of threads which could not be started.
+ *  @param pool     - The pool.
+ *  @param numTasks - The number of tasks, lowered to the threads of the
+ *                    pool.
+ *  @param task     - The function run by every task.
+ *  @param context  - The context given to every task.
+ */
+void RunThreadPool(ThreadPool* pool, unsigned int numTasks, ParallelTask task,
+                   void* context);
+
+/**
+ *  @brief Stops the threads of a pool and frees it from memory.
+ *  @param pool - The pool to be freed. Ignored if NULL.
+ */
+void FreeThreadPool(ThreadPool* pool);
+
+/**
+ *  @brief Runs a function for every item on several threads, and waits for
+ *         all of them to finish. Each task takes the next unclaimed item
+ *         when it is done with its own, so items of uneven cost are still
+ *         balanced. A task runs its items one at a time, so it may own state
+ *         reused across them.
+ *  @param numItems - The number of items.
+ *  @param numTasks - The number of tasks, or 0 for GetThreadCount. It is
+ *                    lowered to numItems and MAX_THREADS.
+ *  @param task     - The function run for every item.
+ *  @param context  - The context given to every call.
+ */
+void ParallelForItems(unsigned int numItems, unsigned int numTasks,
+                      ParallelItemTask task, void* context);
+
+/**
+ *  @brief  Atomically adds one to a counter shared by several threads.
+ *  @param  target - The counter.
+ *  @retval        - The value of the counter before the increment.
+ */
+static inline unsigned int AtomicFetchIncrement(
+    volatile unsigned int* target) {
+#ifdef _MSC_VER
+  return (unsigned int)_InterlockedIncrement((volatile long*)target) - 1;
+#else
+  return __atomic_fetch_add(target, 1, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ *  @brief  Atomically subtracts one from a counter shared by several threads.
+ *  @param  target - The counter.
+ *  @retval        - The value of the counter before the decrement.
+ */
+static inline unsigned int AtomicFetchDecrement(
+    volatile unsigned int* target) {
+#ifdef _MSC_VER
+  return (unsigned int)_InterlockedDecrement((volatile long*)target) + 1;
+#else
+  return __atomic_fetch_sub(target, 1, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ *  @brief  Reads a 64-bit value which other threads may be writing, so the
+ *          read is never torn.
+ *  @param  target - The value, aligned to 8 bytes.
+ *  @retval        - The value.
+ */
+static inline uint64_t AtomicLoad64(volatile uint64_t* target) {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+  return *target;  // Aligned 64-bit reads are atomic on 64-bit processors
+#elif defined(_MSC_VER)
+  return (uint64_t)_InterlockedCompareExchange64((volatile __int64*)target, 0,
+                                                 0);
+#else
+  return __atomic_load_n(target, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ *  @brief  Atomically replaces a 64-bit value if it still holds the expected
+ *          one.
+ *  @param  target   - The value, aligned to 8 bytes.
+ *  @param  expected - The value target must hold to be replaced.
+ *  @param  desired  - The new value.
+ *  @retval          - True if target held expected and was replaced.
+ */
+static inline bool CompareExchange64(volatile uint64_t* target,
+                                     uint64_t expected, uint64_t desired) {
+#ifdef _MSC_VER
+  return (uint64_t)_InterlockedCompareExchange64(
+             (volatile __int64*)target, (__int64)desired,
+             (__int64)expected) == expected;
+#else
+  return __atomic_compare_exchange_n(target, &expected, desired, false,
+                                     __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+#endif
+}
+
+#endif  // !PARALLEL_H
@@ -0,0 +1,258 @@
+/**
+
+    @file      path-subgraph.c
+    @brief     Function implementations for building the subgraph of the
+               vertices lying on paths between two vertices.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#include "path-subgraph.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vertices.h"
+
+/**
+    @brief Comparison function used to sort edges by descending weight, and by
+           destination among equal weights so the order is deterministic.
+    @param a Pointer to the first edge.
+    @param b Pointer to the second edge.
+    @return Negative, zero or positive as in qsort.
+**/
+static int CompareEdges(const void* a, const void* b) {
+  const PathEdge* x = (const PathEdge*)a;
+  const PathEdge* y = (const PathEdge*)b;
+  if (x->weight != y->weight) {
+    return (x->weight < y->weight) - (x->weight > y->weight);
+  }
+  return (x->vertex > y->vertex) - (x->vertex < y->vertex);
+}
+
+/**
+    @brief Frees the arrays of a subgraph.
+    @param subgraph Pointer to the subgraph.
+**/
+void FreePathSubgraph(PathSubgraph* subgraph) {
+  free(subgraph->ids);
+  free(subgraph->offsets);
+  free(subgraph->edges);
+  free(subgraph->bestIn);
+}
+
+/**
+    @brief Builds the subgraph of the vertices reachable from the source which
+           can also reach the destination.
+    @param graph Pointer to the graph structure.
+    @param srcIndex Dense index of the source vertex.
+    @param destIndex Dense index of the destination vertex.
+    @param subgraph Pointer to the subgraph to be filled, with 0 vertices if
+                  the destination cannot be reached.
+    @return True in the case of success, false if memory allocation fails.
+**/
+bool BuildPathSubgraph(const Graph* graph, unsigned int srcIndex,
+                       unsigned int destIndex, PathSubgraph* subgraph) {
+  memset(subgraph, 0, sizeof(PathSubgraph));
+
+  unsigned int n = graph->indexCount;
+  unsigned int* local = (unsigned int*)malloc(n * sizeof(unsigned int));
+  unsigned int* order = (unsigned int*)malloc(n * sizeof(unsigned int));
+  if (local == NULL || order == NULL) {
+    free(local);
+    free(order);
+    return false;
+  }
+
+  for (unsigned int i = 0; i < n; i++) {
+    local[i] = UINT_MAX;
+  }
+
+  // Vertices reachable from the source, numbered in the order they are found
+  // and counting the edges between them
+  unsigned int numReached = 0;
+  unsigned int numEdges = 0;
+  local[srcIndex] = numReached;
+  order[numReached++] = srcIndex;
+  for (unsigned int i = 0; i < numReached; i++) {
+    const EdgeBlock* block = graph->vertexByIndex[order[i]]->edges.head;
+    for (; block != NULL; block = block->next) {
+      numEdges += block->count;
+      for (unsigned int j = 0; j < block->count; j++) {
+        unsigned int v = block->dest[j];
+        if (local[v] == UINT_MAX) {
+          local[v] = numReached;
+          order[numReached++] = v;
+        }
+      }
+    }
+  }
+
+  if (local[destIndex] == UINT_MAX) {
+    free(local);
+    free(order);
+    return true;
+  }
+
+  // Reverse CSR of the reachable vertices, to walk back from the destination
+  unsigned int* revOffsets =
+      (unsigned int*)calloc((size_t)numReached + 1, sizeof(unsigned int));
+  unsigned int* revSrc = (unsigned int*)malloc(
+      (numEdges > 0 ? numEdges : 1) * sizeof(unsigned int));
+  unsigned int* keep = (unsigned int*)malloc(numReached * sizeof(unsigned int));
+  if (revOffsets == NULL || revSrc == NULL || keep == NULL) {
+    free(local);
+    free(order);
+    free(revOffsets);
+    free(revSrc);
+    free(keep);
+    return false;
+  }
+
+  for (unsigned int i = 0; i < numReached; i++) {
+    const EdgeBlock* block = graph->vertexByIndex[order[i]]->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int j = 0; j < block->count; j++) {
+        revOffsets[local[block->dest[j]] + 1]++;
+      }
+    }
+  }
+  for (unsigned int i = 0; i < numReached; i++) {
+    revOffsets[i + 1] += revOffsets[i];
+  }
+  for (unsigned int i = 0; i < numReached; i++) {
+    const EdgeBlock* block = graph->vertexByIndex[order[i]]->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int j = 0; j < block->count; j++) {
+        revSrc[revOffsets[local[block->dest[j]]]++] = i;
+      }
+    }
+  }
+  // The fill moved every offset to the start of the next vertex
+  for (unsigned int i = numReached; i > 0; i--) {
+    revOffsets[i] = revOffsets[i - 1];
+  }
+  revOffsets[0] = 0;
+
+  // Vertices which reach the destination get their final local index, with
+  // keep used first as the stack of the search and then as the new index
+  bool* relevant = (bool*)calloc(numReached, sizeof(bool));
+  if (relevant == NULL) {
+    free(local);
+    free(order);
+    free(revOffsets);
+    free(revSrc);
+    free(keep);
+    return false;
+  }
+
+  unsigned int top = 0;
+  relevant[local[destIndex]] = true;
+  keep[top++] = local[destIndex];
+  while (top > 0) {
+    unsigned int v = keep[--top];
+    for (unsigned int e = revOffsets[v]; e < revOffsets[v + 1]; e++) {
+      unsigned int u = revSrc[e];
+      if (!relevant[u]) {
+        relevant[u] = true;
+        keep[top++] = u;
+      }
+    }
+  }
+
+  unsigned int numVertices = 0;
+  for (unsigned int i = 0; i < numReached; i++) {
+    keep[i] = relevant[i] ? numVertices++ : UINT_MAX;
+  }
+
+  free(revOffsets);
+  free(revSrc);
+  free(relevant);
+
+  subgraph->numVertices = numVertices;
+  subgraph->src = keep[local[srcIndex]];
+  subgraph->dest = keep[local[destIndex]];
+  subgraph->ids = (unsigned int*)malloc(numVertices * sizeof(unsigned int));
+  subgraph->offsets =
+      (unsigned int*)calloc((size_t)numVertices + 1, sizeof(unsigned int));
+  subgraph->bestIn = (unsigned int*)calloc(numVertices, sizeof(unsigned int));
+  if (subgraph->ids == NULL || subgraph->offsets == NULL ||
+      subgraph->bestIn == NULL) {
+    free(local);
+    free(order);
+    free(keep);
+    FreePathSubgraph(subgraph);
+    return false;
+  }
+
+  // Count the kept edges of every vertex, shifted by one for the prefix sum
+  for (unsigned int i = 0; i < numReached; i++) {
+    unsigned int u = keep[i];
+    if (u == UINT_MAX) {
+      continue;
+    }
+    subgraph->ids[u] = graph->vertexByIndex[order[i]]->id;
+    if (u == subgraph->dest) {
+      continue;
+    }
+
+    const EdgeBlock* block = graph->vertexByIndex[order[i]]->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int j = 0; j < block->count; j++) {
+        unsigned int v = keep[local[block->dest[j]]];
+        if (v != UINT_MAX && v != subgraph->src && v != u) {
+          subgraph->offsets[u + 1]++;
+        }
+      }
+    }
+  }
+  for (unsigned int u = 0; u < numVertices; u++) {
+    subgraph->offsets[u + 1] += subgraph->offsets[u];
+  }
+
+  unsigned int numKept = subgraph->offsets[numVertices];
+  subgraph->edges =
+      (PathEdge*)malloc((numKept > 0 ? numKept : 1) * sizeof(PathEdge));
+  if (subgraph->edges == NULL) {
+    free(local);
+    free(order);
+    free(keep);
+    FreePathSubgraph(subgraph);
+    return false;
+  }
+
+  for (unsigned int i = 0; i < numReached; i++) {
+    unsigned int u = keep[i];
+    if (u == UINT_MAX || u == subgraph->dest) {
+      continue;
+    }
+
+    unsigned int position = subgraph->offsets[u];
+    const EdgeBlock* block = graph->vertexByIndex[order[i]]->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int j = 0; j < block->count; j++) {
+        unsigned int v = keep[local[block->dest[j]]];
+        if (v != UINT_MAX && v != subgraph->src && v != u) {
+          subgraph->edges[position].vertex = v;
+          subgraph->edges[position].weight = block->weight[j];
+          position++;
+          if (block->weight[j] > subgraph->bestIn[v]) {
+            subgraph->bestIn[v] = block->weight[j];
+          }
+        }
+      }
+    }
+
+    // Heaviest first, so good paths are found early and prune the rest
+    qsort(subgraph->edges + subgraph->offsets[u],
+          position - subgraph->offsets[u], sizeof(PathEdge), CompareEdges);
+  }
+
+  free(local);
+  free(order);
+  free(keep);
+
+  return true;
+}
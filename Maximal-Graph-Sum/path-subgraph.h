@@ -0,0 +1,66 @@
+/**
+
+    @file      path-subgraph.h
+    @brief     Structure and function definitions for the subgraph of the
+               vertices lying on paths between two vertices, shared by the
+               exact maximum path searches.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef PATH_SUBGRAPH_H
+#define PATH_SUBGRAPH_H
+
+#include <stdbool.h>
+
+#include "graph.h"
+
+/**
+    @struct PathEdge
+    @brief Edge of a PathSubgraph.
+**/
+typedef struct PathEdge {
+  unsigned int vertex;  // Local index of the destination vertex
+  unsigned int weight;  // Weight of the edge
+} PathEdge;
+
+/**
+    @struct PathSubgraph
+    @brief Vertices which lie on some path from a source to a destination,
+           renumbered from 0, with their edges in CSR form.
+
+    @details The edges of every vertex are sorted by descending weight. Edges
+             into the source and out of the destination are left out, as no
+             simple path between them uses one.
+**/
+typedef struct PathSubgraph {
+  unsigned int numVertices;  // Number of vertices of the subgraph
+  unsigned int src;          // Local index of the source vertex
+  unsigned int dest;         // Local index of the destination vertex
+  unsigned int* ids;         // Identifier of every local vertex
+  unsigned int* offsets;     // First edge of each vertex (numVertices + 1)
+  PathEdge* edges;           // Edges of every vertex, heaviest first
+  unsigned int* bestIn;      // Heaviest edge into each vertex
+} PathSubgraph;
+
+/**
+    @brief Builds the subgraph of the vertices reachable from the source which
+           can also reach the destination.
+    @param graph Pointer to the graph structure.
+    @param srcIndex Dense index of the source vertex.
+    @param destIndex Dense index of the destination vertex.
+    @param subgraph Pointer to the subgraph to be filled, with 0 vertices if
+                    the destination cannot be reached.
+    @return True in the case of success, false if memory allocation fails.
+**/
+bool BuildPathSubgraph(const Graph* graph, unsigned int srcIndex,
+                       unsigned int destIndex, PathSubgraph* subgraph);
+
+/**
+    @brief Frees the arrays of a subgraph.
+    @param subgraph Pointer to the subgraph.
+**/
+void FreePathSubgraph(PathSubgraph* subgraph);
+
+#endif  // !PATH_SUBGRAPH_H
@@ -0,0 +1,215 @@
+/**
+ *
+ *  @file      radix-sort.c
+ *  @brief     Function implementations for the parallel radix sort used to
+ *             build graphs in bulk.
+ *  @details   Every pass sorts the keys by one digit of RADIX_BITS bits,
+ *             starting from the least significant. The array is split in one
+ *             range per thread. Each thread counts the digits of its range,
+ *             the counts are turned into the first position of every digit
+ *             of every range, and each thread then moves its range to those
+ *             positions. Digits which are equal in every key are skipped, so
+ *             small identifiers need few passes.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "radix-sort.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "parallel.h"
+
+/**
+  @struct RadixSortContext
+  @brief  State shared by the threads of a radix sort.
+**/
+typedef struct RadixSortContext {
+  const uint64_t* keysIn;        // Keys read by the current pass
+  const unsigned int* valuesIn;  // Values read by the current pass
+  uint64_t* keysOut;             // Keys written by the current pass
+  unsigned int* valuesOut;       // Values written by the current pass
+  unsigned int count;            // Number of keys
+  unsigned int numTasks;         // Number of ranges, one per thread
+  unsigned int shift;            // Position of the digit of the current pass
+  unsigned int (*counts)[RADIX_BUCKETS];  // Digit counts of every range
+  uint64_t orBits[MAX_THREADS];   // Bits set in some key of every range
+  uint64_t andBits[MAX_THREADS];  // Bits set in every key of every range
+} RadixSortContext;
+
+/**
+ *  @brief Gets the first position of the range of a task.
+ *  @param context - The context of the sort.
+ *  @param task    - The number of the task, or numTasks for the end.
+ *  @retval        - The first position of the range.
+ */
+static unsigned int RangeStart(const RadixSortContext* context,
+                               unsigned int task) {
+  return (unsigned int)((uint64_t)context->count * task / context->numTasks);
+}
+
+/**
+ *  @brief Collects the bits set in some key and in every key of a range.
+ *  @param argument - The context of the sort.
+ *  @param task     - The number of the range.
+ */
+static void CollectBitsTask(void* argument, unsigned int task) {
+  RadixSortContext* context = (RadixSortContext*)argument;
+  unsigned int end = RangeStart(context, task + 1);
+
+  uint64_t orBits = 0;
+  uint64_t andBits = ~(uint64_t)0;
+  for (unsigned int i = RangeStart(context, task); i < end; i++) {
+    orBits |= context->keysIn[i];
+    andBits &= context->keysIn[i];
+  }
+
+  context->orBits[task] = orBits;
+  context->andBits[task] = andBits;
+}
+
+/**
+ *  @brief Counts the digits of the current pass in a range.
+ *  @param argument - The context of the sort.
+ *  @param task     - The number of the range.
+ */
+static void CountDigitsTask(void* argument, unsigned int task) {
+  RadixSortContext* context = (RadixSortContext*)argument;
+  unsigned int* counts = context->counts[task];
+  unsigned int end = RangeStart(context, task + 1);
+
+  memset(counts, 0, RADIX_BUCKETS * sizeof(unsigned int));
+  for (unsigned int i = RangeStart(context, task); i < end; i++) {
+    counts[(context->keysIn[i] >> context->shift) & (RADIX_BUCKETS - 1)]++;
+  }
+}
+
+/**
+ *  @brief Moves the keys of a range to their position for the current pass.
+ *         The counts of the range must hold the first position of every
+ *         digit.
+ *  @param argument - The context of the sort.
+ *  @param task     - The number of the range.
+ */
+static void ScatterTask(void* argument, unsigned int task) {
+  RadixSortContext* context = (RadixSortContext*)argument;
+  unsigned int* positions = context->counts[task];
+  unsigned int end = RangeStart(context, task + 1);
+
+  for (unsigned int i = RangeStart(context, task); i < end; i++) {
+    uint64_t key = context->keysIn[i];
+    unsigned int position =
+        positions[(key >> context->shift) & (RADIX_BUCKETS - 1)]++;
+    context->keysOut[position] = key;
+    context->valuesOut[position] = context->valuesIn[i];
+  }
+}
+
+/**
+ *  @brief Copies a range of the sorted keys back to the caller's arrays.
+ *  @param argument - The context of the sort.
+ *  @param task     - The number of the range.
+ */
+static void CopyBackTask(void* argument, unsigned int task) {
+  RadixSortContext* context = (RadixSortContext*)argument;
+  unsigned int start = RangeStart(context, task);
+  unsigned int length = RangeStart(context, task + 1) - start;
+
+  memcpy(context->keysOut + start, context->keysIn + start,
+         length * sizeof(uint64_t));
+  memcpy(context->valuesOut + start, context->valuesIn + start,
+         length * sizeof(unsigned int));
+}
+
+/**
+ *  @brief  Sorts keys in ascending order, moving a value along with each key.
+ *          The sort is stable, so equal keys keep their original order.
+ *  @param  keys   - The keys to be sorted.
+ *  @param  values - The value of every key.
+ *  @param  count  - The number of keys.
+ *  @retval        - True in the case of success.
+ *  @retval        - False if memory allocation fails, in which case the
+ *                   arrays are left unchanged.
+ */
+bool RadixSortPairs(uint64_t* keys, unsigned int* values, unsigned int count) {
+  if (count < 2) {
+    return true;
+  }
+
+  RadixSortContext context;
+  context.count = count;
+  context.numTasks = count < PARALLEL_SORT_MIN_COUNT ? 1 : GetThreadCount();
+  context.keysIn = keys;
+  context.valuesIn = values;
+
+  // Only digits which differ between keys need a pass
+  ParallelFor(context.numTasks, CollectBitsTask, &context);
+  uint64_t orBits = 0;
+  uint64_t andBits = ~(uint64_t)0;
+  for (unsigned int t = 0; t < context.numTasks; t++) {
+    orBits |= context.orBits[t];
+    andBits &= context.andBits[t];
+  }
+  uint64_t varyingBits = orBits ^ andBits;
+  if (varyingBits == 0) {
+    return true;  // Every key is equal
+  }
+
+  uint64_t* tempKeys = (uint64_t*)malloc(count * sizeof(uint64_t));
+  unsigned int* tempValues =
+      (unsigned int*)malloc(count * sizeof(unsigned int));
+  context.counts = (unsigned int(*)[RADIX_BUCKETS])malloc(
+      context.numTasks * sizeof(*context.counts));
+  if (tempKeys == NULL || tempValues == NULL || context.counts == NULL) {
+    free(tempKeys);
+    free(tempValues);
+    free(context.counts);
+    return false;
+  }
+
+  context.keysOut = tempKeys;
+  context.valuesOut = tempValues;
+
+  for (unsigned int shift = 0; shift < 64; shift += RADIX_BITS) {
+    if (((varyingBits >> shift) & (RADIX_BUCKETS - 1)) == 0) {
+      continue;
+    }
+    context.shift = shift;
+
+    ParallelFor(context.numTasks, CountDigitsTask, &context);
+
+    // Digits in order, and ranges in order within a digit, keep it stable
+    unsigned int position = 0;
+    for (unsigned int digit = 0; digit < RADIX_BUCKETS; digit++) {
+      for (unsigned int t = 0; t < context.numTasks; t++) {
+        unsigned int digitCount = context.counts[t][digit];
+        context.counts[t][digit] = position;
+        position += digitCount;
+      }
+    }
+
+    ParallelFor(context.numTasks, ScatterTask, &context);
+
+    // The output of this pass is the input of the next one
+    const uint64_t* sortedKeys = context.keysOut;
+    const unsigned int* sortedValues = context.valuesOut;
+    context.keysOut = (uint64_t*)context.keysIn;
+    context.valuesOut = (unsigned int*)context.valuesIn;
+    context.keysIn = sortedKeys;
+    context.valuesIn = sortedValues;
+  }
+
+  if (context.keysIn != keys) {
+    context.keysOut = keys;
+    context.valuesOut = values;
+    ParallelFor(context.numTasks, CopyBackTask, &context);
+  }
+
+  free(tempKeys);
+  free(tempValues);
+  free(context.counts);
+
+  return true;
+}
@@ -0,0 +1,31 @@
+/**
+ *  @file      radix-sort.h
+ *  @brief     Function definitions for the parallel radix sort used to build
+ *             graphs in bulk.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define RADIX_BITS 11
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+#define PARALLEL_SORT_MIN_COUNT 65536  // Smaller arrays use a single thread
+
+/**
+ *  @brief  Sorts keys in ascending order, moving a value along with each key.
+ *          The sort is stable, so equal keys keep their original order.
+ *  @param  keys   - The keys to be sorted.
+ *  @param  values - The value of every key.
+ *  @param  count  - The number of keys.
+ *  @retval        - True in the case of success.
+ *  @retval        - False if memory allocation fails, in which case the
+ *                   arrays are left unchanged.
+ */
+bool RadixSortPairs(uint64_t* keys, unsigned int* values, unsigned int count);
+
+#endif  // !RADIX_SORT_H
@@ -0,0 +1,130 @@
+/**
+
+    @file      search-path.c
+    @brief     Function implementations for building the paths found by
+               searches from their parent arrays.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#include "search-path.h"
+
+#include <limits.h>
+#include <stdlib.h>
+
+/**
+    @brief Builds the dense indices of a path through a vertex, following the
+           parents of a forward search from it back to the source, and those
+           of a backward search from it on to the destination.
+    @param forwardPrev Parent of every dense index in the forward search,
+                       UINT_MAX for the source.
+    @param backwardPrev Parent of every dense index in the backward search,
+                        UINT_MAX for the destination, or NULL if the path
+                        ends at the vertex.
+    @param meet Dense index of the vertex both halves share.
+    @param route Pointer to store the dense indices, from source to
+                 destination.
+    @param length Pointer to store the number of vertices of the path.
+    @return True in the case of success, false if memory allocation fails.
+**/
+bool BuildIndexPath(const unsigned int* forwardPrev,
+                    const unsigned int* backwardPrev, unsigned int meet,
+                    unsigned int** route, unsigned int* length) {
+  unsigned int after = backwardPrev != NULL ? backwardPrev[meet] : UINT_MAX;
+
+  // The parents are followed twice, first to count the vertices
+  unsigned int forwardCount = 0;
+  for (unsigned int v = meet; v != UINT_MAX; v = forwardPrev[v]) {
+    forwardCount++;
+  }
+  unsigned int count = forwardCount;
+  for (unsigned int v = after; v != UINT_MAX; v = backwardPrev[v]) {
+    count++;
+  }
+
+  *route = (unsigned int*)malloc(count * sizeof(unsigned int));
+  if (*route == NULL) {
+    return false;
+  }
+
+  // The forward half is stored backwards, ending at the meeting vertex
+  unsigned int idx = forwardCount - 1;
+  for (unsigned int v = meet; v != UINT_MAX; v = forwardPrev[v]) {
+    (*route)[idx--] = v;
+  }
+  idx = forwardCount;
+  for (unsigned int v = after; v != UINT_MAX; v = backwardPrev[v]) {
+    (*route)[idx++] = v;
+  }
+  *length = count;
+
+  return true;
+}
+
+/**
+    @brief Builds the vertex identifiers of the path ending at a vertex,
+           following its parents back to the source.
+    @param graph Pointer to the graph structure.
+    @param prev Parent of every dense index, UINT_MAX for the source.
+    @param dest Dense index of the last vertex.
+    @param path Pointer to store the path vertices.
+    @param pathLength Pointer to store the length of the path.
+    @return True in the case of success, false if memory allocation fails.
+**/
+bool BuildPathFromPrev(const Graph* graph, const unsigned int* prev,
+                       unsigned int dest, unsigned int** path,
+                       unsigned int* pathLength) {
+  return BuildMeetingPath(graph, prev, NULL, dest, path, pathLength);
+}
+
+/**
+    @brief Builds the vertex identifiers of the path found by a bidirectional
+           search, through the vertex where both searches meet.
+    @param graph Pointer to the graph structure.
+    @param forwardPrev Parent of every dense index in the forward search.
+    @param backwardPrev Parent of every dense index in the backward search.
+    @param meet Dense index of the meeting vertex.
+    @param path Pointer to store the path vertices.
+    @param pathLength Pointer to store the length of the path.
+    @return True in the case of success, false if memory allocation fails.
+**/
+bool BuildMeetingPath(const Graph* graph, const unsigned int* forwardPrev,
+                      const unsigned int* backwardPrev, unsigned int meet,
+                      unsigned int** path, unsigned int* pathLength) {
+  if (!BuildIndexPath(forwardPrev, backwardPrev, meet, path, pathLength)) {
+    return false;
+  }
+
+  // Dense indices are translated back to identifiers in place
+  for (unsigned int i = 0; i < *pathLength; i++) {
+    (*path)[i] = graph->vertexByIndex[(*path)[i]]->id;
+  }
+
+  return true;
+}
+
+/**
+    @brief Builds the vertex identifiers of the path ending at a vertex of a
+           frozen or compressed snapshot, following its parents back to the
+           source.
+    @param ids Identifier of every dense index of the snapshot.
+    @param prev Parent of every dense index, UINT_MAX for the source.
+    @param dest Dense index of the last vertex.
+    @param path Pointer to store the path vertices.
+    @param pathLength Pointer to store the length of the path.
+    @return True in the case of success, false if memory allocation fails.
+**/
+bool BuildSnapshotPathFromPrev(const unsigned int* ids,
+                               const unsigned int* prev, unsigned int dest,
+                               unsigned int** path, unsigned int* pathLength) {
+  if (!BuildIndexPath(prev, NULL, dest, path, pathLength)) {
+    return false;
+  }
+
+  for (unsigned int i = 0; i < *pathLength; i++) {
+    (*path)[i] = ids[(*path)[i]];
+  }
+
+  return true;
+}
@@ -0,0 +1,81 @@
+/**
+
+    @file      search-path.h
+    @brief     Function definitions for building the paths found by searches
+               from their parent arrays.
+    @author    Enrique George Rodrigues
+    @date      17.10.2026
+    @copyright  Enrique George Rodrigues, 2026. All right reserved.
+
+**/
+#ifndef SEARCH_PATH_H
+#define SEARCH_PATH_H
+
+#include <stdbool.h>
+
+#include "graph.h"
+
+/**
+    @brief Builds the dense indices of a path through a vertex, following the
+           parents of a forward search from it back to the source, and those
+           of a backward search from it on to the destination.
+    @param forwardPrev Parent of every dense index in the forward search,
+                       UINT_MAX for the source.
+    @param backwardPrev Parent of every dense index in the backward search,
+                        UINT_MAX for the destination, or NULL if the path
+                        ends at the vertex.
+    @param meet Dense index of the vertex both halves share.
+    @param route Pointer to store the dense indices, from source to
+                 destination.
+    @param length Pointer to store the number of vertices of the path.
+    @return True in the case of success, false if memory allocation fails.
+**/
+bool BuildIndexPath(const unsigned int* forwardPrev,
+                    const unsigned int* backwardPrev, unsigned int meet,
+                    unsigned int** route, unsigned int* length);
+
+/**
+    @brief Builds the vertex identifiers of the path ending at a vertex,
+           following its parents back to the source.
+    @param graph Pointer to the graph structure.
+    @param prev Parent of every dense index, UINT_MAX for the source.
+    @param dest Dense index of the last vertex.
+    @param path Pointer to store the path vertices.
+    @param pathLength Pointer to store the length of the path.
+    @return True in the case of success, false if memory allocation fails.
+**/
+bool BuildPathFromPrev(const Graph* graph, const unsigned int* prev,
+                       unsigned int dest, unsigned int** path,
+                       unsigned int* pathLength);
+
+/**
+    @brief Builds the vertex identifiers of the path found by a bidirectional
+           search, through the vertex where both searches meet.
+    @param graph Pointer to the graph structure.
+    @param forwardPrev Parent of every dense index in the forward search.
+    @param backwardPrev Parent of every dense index in the backward search.
+    @param meet Dense index of the meeting vertex.
+    @param path Pointer to store the path vertices.
+    @param pathLength Pointer to store the length of the path.
+    @return True in the case of success, false if memory allocation fails.
+**/
+bool BuildMeetingPath(const Graph* graph, const unsigned int* forwardPrev,
+                      const unsigned int* backwardPrev, unsigned int meet,
+                      unsigned int** path, unsigned int* pathLength);
+
+/**
+    @brief Builds the vertex identifiers of the path ending at a vertex of a
+           frozen or compressed snapshot, following its parents back to the
+           source.
+    @param ids Identifier of every dense index of the snapshot.
+    @param prev Parent of every dense index, UINT_MAX for the source.
+    @param dest Dense index of the last vertex.
+    @param path Pointer to store the path vertices.
+    @param pathLength Pointer to store the length of the path.
+    @return True in the case of success, false if memory allocation fails.
+**/
+bool BuildSnapshotPathFromPrev(const unsigned int* ids,
+                               const unsigned int* prev, unsigned int dest,
+                               unsigned int** path, unsigned int* pathLength);
+
+#endif  // !SEARCH_PATH_H
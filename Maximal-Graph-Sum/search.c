@@ -15,8 +15,39 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "frozen-graph.h"
+#include "parallel.h"
 #include "vertices.h"
 
+#define SPLIT_STRIDE (SEARCH_MAX_SPLIT_DEPTH + 1)  // Vertices per prefix
+
+/**
+    @struct SearchSplit
+    @brief  Path prefixes from the source which split a search into subtrees,
+            in the order a depth first search reaches them.
+**/
+typedef struct SearchSplit {
+  unsigned int count;      // Number of prefixes
+  unsigned int* vertices;  // Dense indices, SPLIT_STRIDE per prefix
+  unsigned int* weights;   // Weight of the edge after each vertex
+  unsigned int* length;    // Number of vertices of each prefix
+} SearchSplit;
+
+/**
+    @struct ParallelSearch
+    @brief  State shared by the threads of FindAllPathsParallel.
+**/
+typedef struct ParallelSearch {
+  const Graph* graph;
+  unsigned int destIndex;
+  const SearchSplit* split;
+  DFSContext tasks[MAX_THREADS];  // Arrays of each task, NULL until used
+  PathNode** paths;               // Paths of each subtree
+  PathNode** lastPaths;           // Last path of each subtree
+  unsigned int* numPaths;         // Number of paths of each subtree
+  bool* failed;                   // True if a subtree ran out of memory
+} ParallelSearch;
+
  /**
   * @brief Adds the current path to the list of paths in the context.
   *
@@ -25,18 +56,6 @@
   * @return bool - True if the path is successfully added, false otherwise.
   */
 bool AddPath(DFSContext* context) {
-  if (*context->numPaths == *context->pathCapacity) {
-    *context->pathCapacity *= 2;
-    PathNode** paths = (PathNode**)realloc(
-      *context->paths, *context->pathCapacity * sizeof(PathNode*));
-    if (paths != NULL) {
-      *context->paths = paths;
-    }
-    else {
-      return false;  // Memory reallocation failed
-    }
-  }
-
   // Allocate memory for a new path
   PathNode* newPath = (PathNode*)malloc(sizeof(PathNode));
   if (newPath == NULL) {
@@ -63,17 +82,14 @@ bool AddPath(DFSContext* context) {
   newPath->length = context->pathIndex + 1;
   newPath->next = NULL;
 
-  // Add the new path to the paths list
-  if (*context->paths == NULL) {
+  // Append the new path after the last one, keeping the order they were found
+  if (context->lastPath == NULL) {
     *context->paths = newPath;
   }
   else {
-    PathNode* current = *context->paths;
-    while (current->next != NULL) {
-      current = current->next;
-    }
-    current->next = newPath;
+    context->lastPath->next = newPath;
   }
+  context->lastPath = newPath;
 
   (*context->numPaths)++;
   return true;  // Path successfully added
@@ -95,29 +111,28 @@ void Backtrack(DFSContext* context, unsigned int vertex) {
  *
  * @param context - Pointer to the DFSContext containing the graph and traversal
  * state.
- * @param src - The current source vertex being explored.
- * @param dest - The destination vertex to which paths are being found.
+ * @param src - The dense index of the vertex being explored.
+ * @param dest - The dense index of the destination vertex.
  * @return bool - True if all traversals complete successfully, false otherwise.
  */
 bool TraverseEdges(DFSContext* context, unsigned int src, unsigned int dest) {
-  Vertex* vertex = FindVertex(context->graph, src);
-  if (!vertex) return true;  // No edges to traverse, return success
-
-  Edge* edge = vertex->edges;
-  bool success = true;
+  const EdgeBlock* block = context->graph->vertexByIndex[src]->edges.head;
 
-  while (edge != NULL) {
-    if (!context->visited[edge->dest]) {
-      context->pathWeights[context->pathIndex] = edge->weight;
-      context->pathIndex++;
-      success = DepthFirstSearch(context, edge->dest, dest);
-      context->pathIndex--;
-      if (!success) break;  // Stop further traversal if failure occurs
+  for (; block != NULL; block = block->next) {
+    for (unsigned int i = 0; i < block->count; i++) {
+      if (!context->visited[block->dest[i]]) {
+        context->pathWeights[context->pathIndex] = block->weight[i];
+        context->pathIndex++;
+        bool success = DepthFirstSearch(context, block->dest[i], dest);
+        context->pathIndex--;
+        if (!success) {
+          return false;  // Stop further traversal if failure occurs
+        }
+      }
     }
-    edge = edge->next;
   }
 
-  return success;
+  return true;
 }
 
 /**
@@ -125,15 +140,17 @@ bool TraverseEdges(DFSContext* context, unsigned int src, unsigned int dest) {
  * a given destination.
  *
  * @param context - Pointer to the DFSContext containing the graph and traversal
- * state.
- * @param src - The source vertex from which DFS starts.
- * @param dest - The destination vertex to which paths are being found.
+ * state. Vertices are tracked by dense index, while the stored path holds
+ * their identifiers.
+ * @param src - The dense index of the vertex from which DFS starts.
+ * @param dest - The dense index of the destination vertex.
  * @return bool - True if the DFS completes successfully, false otherwise.
  */
 bool DepthFirstSearch(DFSContext* context, unsigned int src,
   unsigned int dest) {
   context->visited[src] = true;
-  context->pathVertices[context->pathIndex] = src;
+  context->pathVertices[context->pathIndex] =
+    context->graph->vertexByIndex[src]->id;
 
   bool success = true;
 
@@ -153,21 +170,35 @@ bool DepthFirstSearch(DFSContext* context, unsigned int src,
  * the graph.
  *
  * @param graph - Pointer to the graph.
- * @param src - The source vertex from which paths start.
- * @param dest - The destination vertex to which paths are being found.
+ * @param src - The identifier of the vertex from which paths start.
+ * @param dest - The identifier of the vertex to which paths are being found.
  * @param numPaths - Pointer to store the number of paths found.
- * @return PathNode* - Pointer to the head of the linked list of paths.
+ * @return PathNode* - Pointer to the head of the linked list of paths, NULL if
+ * there are none.
  */
 PathNode* FindAllPaths(const Graph* graph, unsigned int src, unsigned int dest,
   unsigned int* numPaths) {
   *numPaths = 0;
-  unsigned int pathCapacity = 10;
+
+  const Vertex* srcVertex = FindVertex(graph, src);
+  const Vertex* destVertex = FindVertex(graph, dest);
+  if (srcVertex == NULL || destVertex == NULL) {
+    return NULL;
+  }
+
+  // Every array is indexed by dense index, whatever the identifiers are
   PathNode* paths = NULL;
-  bool* visited = (bool*)calloc(graph->hashSize, sizeof(bool));
+  bool* visited = (bool*)calloc(graph->indexCount, sizeof(bool));
   unsigned int* pathVertices =
-    (unsigned int*)malloc(graph->hashSize * sizeof(unsigned int));
+    (unsigned int*)malloc(graph->indexCount * sizeof(unsigned int));
   unsigned int* pathWeights =
-    (unsigned int*)malloc(graph->hashSize * sizeof(unsigned int));
+    (unsigned int*)malloc(graph->indexCount * sizeof(unsigned int));
+  if (visited == NULL || pathVertices == NULL || pathWeights == NULL) {
+    free(visited);
+    free(pathVertices);
+    free(pathWeights);
+    return NULL;
+  }
 
   DFSContext context = { .graph = graph,
                         .pathVertices = pathVertices,
@@ -175,10 +206,11 @@ PathNode* FindAllPaths(const Graph* graph, unsigned int src, unsigned int dest,
                         .visited = visited,
                         .pathIndex = 0,
                         .paths = &paths,
-                        .numPaths = numPaths,
-                        .pathCapacity = &pathCapacity };
+                        .lastPath = NULL,
+                        .numPaths = numPaths };
 
-  bool success = DepthFirstSearch(&context, src, dest);
+  bool success =
+    DepthFirstSearch(&context, srcVertex->index, destVertex->index);
 
   if (!success) {
     // Free all paths if there was an error
@@ -194,6 +226,400 @@ PathNode* FindAllPaths(const Graph* graph, unsigned int src, unsigned int dest,
   return paths;
 }
 
+/**
+ * @brief Depth-First Search over a frozen CSR snapshot. Vertices are tracked
+ * by dense index, while the stored path holds their identifiers.
+ *
+ * @param context - Pointer to the DFSContext containing the snapshot and
+ * traversal state.
+ * @param src - The dense index of the vertex being explored.
+ * @param dest - The dense index of the destination vertex.
+ * @return bool - True if the DFS completes successfully, false otherwise.
+ */
+static bool DepthFirstSearchFrozen(DFSContext* context, unsigned int src,
+  unsigned int dest) {
+  const FrozenGraph* frozen = context->frozen;
+
+  context->visited[src] = true;
+  context->pathVertices[context->pathIndex] = frozen->ids[src];
+
+  bool success = true;
+
+  if (src == dest) {
+    success = AddPath(context);
+  }
+  else {
+    unsigned int end = frozen->offsets[src + 1];
+    for (unsigned int e = frozen->offsets[src]; e < end && success; e++) {
+      unsigned int next = frozen->dest[e];
+      if (!context->visited[next]) {
+        context->pathWeights[context->pathIndex] = frozen->weight[e];
+        context->pathIndex++;
+        success = DepthFirstSearchFrozen(context, next, dest);
+        context->pathIndex--;
+      }
+    }
+  }
+
+  Backtrack(context, src);
+  return success;
+}
+
+/**
+ * @brief Finds all paths from the source vertex to the destination vertex in
+ * a frozen CSR snapshot.
+ *
+ * @param frozen - Pointer to the frozen graph.
+ * @param src - The identifier of the vertex from which paths start.
+ * @param dest - The identifier of the vertex to which paths are being found.
+ * @param numPaths - Pointer to store the number of paths found.
+ * @return PathNode* - Pointer to the head of the linked list of paths, NULL if
+ * there are none.
+ */
+PathNode* FindAllPathsFrozen(const FrozenGraph* frozen, unsigned int src,
+  unsigned int dest, unsigned int* numPaths) {
+  *numPaths = 0;
+
+  unsigned int srcIndex = FindFrozenIndex(frozen, src);
+  unsigned int destIndex = FindFrozenIndex(frozen, dest);
+  if (srcIndex == NO_VERTEX_INDEX || destIndex == NO_VERTEX_INDEX) {
+    return NULL;
+  }
+
+  PathNode* paths = NULL;
+  bool* visited = (bool*)calloc(frozen->numVertices, sizeof(bool));
+  unsigned int* pathVertices =
+    (unsigned int*)malloc(frozen->numVertices * sizeof(unsigned int));
+  unsigned int* pathWeights =
+    (unsigned int*)malloc(frozen->numVertices * sizeof(unsigned int));
+  if (visited == NULL || pathVertices == NULL || pathWeights == NULL) {
+    free(visited);
+    free(pathVertices);
+    free(pathWeights);
+    return NULL;
+  }
+
+  DFSContext context = { .frozen = frozen,
+                        .pathVertices = pathVertices,
+                        .pathWeights = pathWeights,
+                        .visited = visited,
+                        .pathIndex = 0,
+                        .paths = &paths,
+                        .lastPath = NULL,
+                        .numPaths = numPaths };
+
+  if (!DepthFirstSearchFrozen(&context, srcIndex, destIndex)) {
+    // Free all paths if there was an error
+    FreePaths(paths);
+    paths = NULL;
+    *numPaths = 0;
+  }
+
+  free(visited);
+  free(pathVertices);
+  free(pathWeights);
+
+  return paths;
+}
+
+/**
+ * @brief Frees the arrays of a split.
+ *
+ * @param split - Pointer to the split.
+ */
+static void FreeSearchSplit(SearchSplit* split) {
+  free(split->vertices);
+  free(split->weights);
+  free(split->length);
+}
+
+/**
+ * @brief Checks if a vertex is already on a prefix.
+ *
+ * @param prefix - The dense indices of the prefix.
+ * @param length - The number of vertices of the prefix.
+ * @param vertex - The dense index of the vertex.
+ * @return bool - True if the vertex is on the prefix.
+ */
+static bool IsOnPrefix(const unsigned int* prefix, unsigned int length,
+  unsigned int vertex) {
+  for (unsigned int i = 0; i < length; i++) {
+    if (prefix[i] == vertex) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Splits a search into subtrees, extending every prefix by one edge at
+ * a time until there are enough of them. Prefixes which reach the destination
+ * are kept as they are, and the ones with no way on are dropped.
+ *
+ * @param graph - Pointer to the graph.
+ * @param srcIndex - The dense index of the source vertex.
+ * @param destIndex - The dense index of the destination vertex.
+ * @param target - The number of prefixes wanted.
+ * @param split - Pointer to the split to be filled.
+ * @return bool - True if the split is built, false if memory allocation
+ * fails.
+ */
+static bool SplitSearch(const Graph* graph, unsigned int srcIndex,
+  unsigned int destIndex, unsigned int target, SearchSplit* split) {
+  split->count = 1;
+  split->vertices = (unsigned int*)malloc(SPLIT_STRIDE * sizeof(unsigned int));
+  split->weights = (unsigned int*)malloc(SPLIT_STRIDE * sizeof(unsigned int));
+  split->length = (unsigned int*)malloc(sizeof(unsigned int));
+  if (split->vertices == NULL || split->weights == NULL ||
+    split->length == NULL) {
+    FreeSearchSplit(split);
+    return false;
+  }
+  split->vertices[0] = srcIndex;
+  split->length[0] = 1;
+
+  // Every open prefix has depth vertices, as they grow together
+  for (unsigned int depth = 1; depth < SPLIT_STRIDE; depth++) {
+    if (split->count >= target) {
+      break;
+    }
+
+    // Count the prefixes of the next level first, to allocate them at once
+    size_t count = 0;
+    bool open = false;
+    for (unsigned int p = 0; p < split->count; p++) {
+      const unsigned int* prefix = split->vertices + (size_t)p * SPLIT_STRIDE;
+      unsigned int last = prefix[split->length[p] - 1];
+      if (last == destIndex) {
+        count++;
+        continue;
+      }
+
+      open = true;
+      const EdgeBlock* block = graph->vertexByIndex[last]->edges.head;
+      for (; block != NULL; block = block->next) {
+        for (unsigned int i = 0; i < block->count; i++) {
+          if (!IsOnPrefix(prefix, depth, block->dest[i])) {
+            count++;
+          }
+        }
+      }
+    }
+    if (!open || count > SEARCH_MAX_SUBTREES) {
+      break;
+    }
+
+    SearchSplit next = { (unsigned int)count, NULL, NULL, NULL };
+    next.vertices =
+      (unsigned int*)malloc((count > 0 ? count : 1) * SPLIT_STRIDE *
+        sizeof(unsigned int));
+    next.weights =
+      (unsigned int*)malloc((count > 0 ? count : 1) * SPLIT_STRIDE *
+        sizeof(unsigned int));
+    next.length =
+      (unsigned int*)malloc((count > 0 ? count : 1) * sizeof(unsigned int));
+    if (next.vertices == NULL || next.weights == NULL ||
+      next.length == NULL) {
+      FreeSearchSplit(&next);
+      FreeSearchSplit(split);
+      return false;
+    }
+
+    // Children replace their prefix in edge order, so the order of a single
+    // search is kept
+    unsigned int position = 0;
+    for (unsigned int p = 0; p < split->count; p++) {
+      const unsigned int* prefix = split->vertices + (size_t)p * SPLIT_STRIDE;
+      const unsigned int* weights = split->weights + (size_t)p * SPLIT_STRIDE;
+      unsigned int length = split->length[p];
+      unsigned int last = prefix[length - 1];
+
+      if (last == destIndex) {
+        memcpy(next.vertices + (size_t)position * SPLIT_STRIDE, prefix,
+          length * sizeof(unsigned int));
+        memcpy(next.weights + (size_t)position * SPLIT_STRIDE, weights,
+          length * sizeof(unsigned int));
+        next.length[position++] = length;
+        continue;
+      }
+
+      const EdgeBlock* block = graph->vertexByIndex[last]->edges.head;
+      for (; block != NULL; block = block->next) {
+        for (unsigned int i = 0; i < block->count; i++) {
+          if (IsOnPrefix(prefix, depth, block->dest[i])) {
+            continue;
+          }
+          unsigned int* child =
+            next.vertices + (size_t)position * SPLIT_STRIDE;
+          unsigned int* childWeights =
+            next.weights + (size_t)position * SPLIT_STRIDE;
+          memcpy(child, prefix, depth * sizeof(unsigned int));
+          memcpy(childWeights, weights, depth * sizeof(unsigned int));
+          child[depth] = block->dest[i];
+          childWeights[depth - 1] = block->weight[i];
+          next.length[position++] = depth + 1;
+        }
+      }
+    }
+
+    FreeSearchSplit(split);
+    *split = next;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Lists the paths of one subtree of a split search, with the arrays
+ * owned by the task running it.
+ *
+ * @param context - Pointer to the ParallelSearch.
+ * @param task - The number of the task running the subtree.
+ * @param item - The number of the subtree.
+ */
+static void SearchSubtreeTask(void* context, unsigned int task,
+  unsigned int item) {
+  ParallelSearch* search = (ParallelSearch*)context;
+  DFSContext* dfs = &search->tasks[task];
+  unsigned int n = search->graph->indexCount;
+
+  if (dfs->visited == NULL) {
+    dfs->graph = search->graph;
+    dfs->visited = (bool*)calloc(n, sizeof(bool));
+    dfs->pathVertices = (unsigned int*)malloc(n * sizeof(unsigned int));
+    dfs->pathWeights = (unsigned int*)malloc(n * sizeof(unsigned int));
+    if (dfs->visited == NULL || dfs->pathVertices == NULL ||
+      dfs->pathWeights == NULL) {
+      free(dfs->visited);
+      free(dfs->pathVertices);
+      free(dfs->pathWeights);
+      dfs->visited = NULL;
+      dfs->pathVertices = NULL;
+      dfs->pathWeights = NULL;
+      search->failed[item] = true;
+      return;
+    }
+  }
+
+  const unsigned int* prefix =
+    search->split->vertices + (size_t)item * SPLIT_STRIDE;
+  const unsigned int* weights =
+    search->split->weights + (size_t)item * SPLIT_STRIDE;
+  unsigned int last = search->split->length[item] - 1;
+
+  // The prefix is walked already, the search goes on from its last vertex
+  for (unsigned int i = 0; i < last; i++) {
+    dfs->visited[prefix[i]] = true;
+    dfs->pathVertices[i] = search->graph->vertexByIndex[prefix[i]]->id;
+    dfs->pathWeights[i] = weights[i];
+  }
+
+  dfs->pathIndex = last;
+  dfs->paths = &search->paths[item];
+  dfs->lastPath = NULL;
+  dfs->numPaths = &search->numPaths[item];
+  search->failed[item] =
+    !DepthFirstSearch(dfs, prefix[last], search->destIndex);
+  search->lastPaths[item] = dfs->lastPath;
+
+  for (unsigned int i = 0; i < last; i++) {
+    dfs->visited[prefix[i]] = false;
+  }
+}
+
+/**
+ * @brief Finds all paths from the source vertex to the destination vertex in
+ * the graph, on several threads.
+ *
+ * @param graph - Pointer to the graph.
+ * @param src - The identifier of the vertex from which paths start.
+ * @param dest - The identifier of the vertex to which paths are being found.
+ * @param numThreads - The number of threads, or 0 for GetThreadCount.
+ * @param numPaths - Pointer to store the number of paths found.
+ * @return PathNode* - Pointer to the head of the linked list of paths, NULL if
+ * there are none.
+ */
+PathNode* FindAllPathsParallel(const Graph* graph, unsigned int src,
+  unsigned int dest, unsigned int numThreads, unsigned int* numPaths) {
+  *numPaths = 0;
+
+  if (numThreads == 0 || numThreads > MAX_THREADS) {
+    numThreads = numThreads == 0 ? GetThreadCount() : MAX_THREADS;
+  }
+  if (numThreads == 1) {
+    return FindAllPaths(graph, src, dest, numPaths);
+  }
+
+  const Vertex* srcVertex = FindVertex(graph, src);
+  const Vertex* destVertex = FindVertex(graph, dest);
+  if (srcVertex == NULL || destVertex == NULL) {
+    return NULL;
+  }
+
+  SearchSplit split;
+  if (!SplitSearch(graph, srcVertex->index, destVertex->index,
+    numThreads * SEARCH_SUBTREES_PER_THREAD, &split)) {
+    return NULL;
+  }
+
+  ParallelSearch search;
+  memset(&search, 0, sizeof(ParallelSearch));
+  unsigned int count = split.count > 0 ? split.count : 1;
+  search.graph = graph;
+  search.destIndex = destVertex->index;
+  search.split = &split;
+  search.paths = (PathNode**)calloc(count, sizeof(PathNode*));
+  search.lastPaths = (PathNode**)calloc(count, sizeof(PathNode*));
+  search.numPaths = (unsigned int*)calloc(count, sizeof(unsigned int));
+  search.failed = (bool*)calloc(count, sizeof(bool));
+
+  bool allocated = search.paths != NULL && search.lastPaths != NULL &&
+    search.numPaths != NULL && search.failed != NULL;
+  bool success = allocated;
+  if (allocated) {
+    ParallelForItems(split.count, numThreads, SearchSubtreeTask, &search);
+  }
+
+  // Join the paths of every subtree in prefix order
+  PathNode* paths = NULL;
+  PathNode* lastPath = NULL;
+  for (unsigned int i = 0; success && i < split.count; i++) {
+    success = !search.failed[i];
+  }
+  for (unsigned int i = 0; allocated && i < split.count; i++) {
+    if (search.paths[i] == NULL) {
+      continue;
+    }
+    if (lastPath == NULL) {
+      paths = search.paths[i];
+    }
+    else {
+      lastPath->next = search.paths[i];
+    }
+    lastPath = search.lastPaths[i];
+    *numPaths += search.numPaths[i];
+  }
+
+  if (!success) {
+    FreePaths(paths);
+    paths = NULL;
+    *numPaths = 0;
+  }
+
+  for (unsigned int t = 0; t < MAX_THREADS; t++) {
+    free(search.tasks[t].visited);
+    free(search.tasks[t].pathVertices);
+    free(search.tasks[t].pathWeights);
+  }
+  free(search.paths);
+  free(search.lastPaths);
+  free(search.numPaths);
+  free(search.failed);
+  FreeSearchSplit(&split);
+
+  return paths;
+}
+
 /**
  * @brief Frees the memory allocated for the list of paths.
  *
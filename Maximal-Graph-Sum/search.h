@@ -13,19 +13,25 @@
 
 #include "graph.h"
 
+#define SEARCH_SUBTREES_PER_THREAD 16  // Subtrees given to each thread, so
+                                       // uneven ones are balanced
+#define SEARCH_MAX_SPLIT_DEPTH 8  // Longest prefix used to split a search
+#define SEARCH_MAX_SUBTREES 65536  // Prefixes a split may hold
+
  /**
      @struct DFSContext
      @brief  Variables that give context for the DFS function to work.
  **/
 typedef struct DFSContext {
   const Graph* graph;
+  const FrozenGraph* frozen;
   unsigned int* pathVertices;
   unsigned int* pathWeights;
   bool* visited;
   unsigned int pathIndex;
   struct PathNode** paths;
+  struct PathNode* lastPath;  // Tail of the paths list, for appending
   unsigned int* numPaths;
-  unsigned int* pathCapacity;
 } DFSContext;
 
 /**
@@ -62,8 +68,8 @@ void Backtrack(DFSContext* context, unsigned int vertex);
  *
  * @param context - Pointer to the DFSContext containing the graph and traversal
  * state.
- * @param src - The current source vertex being explored.
- * @param dest - The destination vertex to which paths are being found.
+ * @param src - The dense index of the vertex being explored.
+ * @param dest - The dense index of the destination vertex.
  * @return bool - True if all traversals complete successfully, false otherwise.
  */
 bool TraverseEdges(DFSContext* context, unsigned int src, unsigned int dest);
@@ -73,9 +79,10 @@ bool TraverseEdges(DFSContext* context, unsigned int src, unsigned int dest);
  * a given destination.
  *
  * @param context - Pointer to the DFSContext containing the graph and traversal
- * state.
- * @param src - The source vertex from which DFS starts.
- * @param dest - The destination vertex to which paths are being found.
+ * state. Vertices are tracked by dense index, while the stored path holds
+ * their identifiers.
+ * @param src - The dense index of the vertex from which DFS starts.
+ * @param dest - The dense index of the destination vertex.
  * @return bool - True if the DFS completes successfully, false otherwise.
  */
 bool DepthFirstSearch(DFSContext* context, unsigned int src, unsigned int dest);
@@ -85,14 +92,50 @@ bool DepthFirstSearch(DFSContext* context, unsigned int src, unsigned int dest);
  * the graph.
  *
  * @param graph - Pointer to the graph.
- * @param src - The source vertex from which paths start.
- * @param dest - The destination vertex to which paths are being found.
+ * @param src - The identifier of the vertex from which paths start.
+ * @param dest - The identifier of the vertex to which paths are being found.
  * @param numPaths - Pointer to store the number of paths found.
- * @return PathNode* - Pointer to the head of the linked list of paths.
+ * @return PathNode* - Pointer to the head of the linked list of paths, NULL if
+ * there are none.
  */
 PathNode* FindAllPaths(const Graph* graph, unsigned int src, unsigned int dest,
   unsigned int* numPaths);
 
+/**
+ * @brief Finds all paths from the source vertex to the destination vertex in
+ * a frozen CSR snapshot.
+ *
+ * @param frozen - Pointer to the frozen graph.
+ * @param src - The identifier of the vertex from which paths start.
+ * @param dest - The identifier of the vertex to which paths are being found.
+ * @param numPaths - Pointer to store the number of paths found.
+ * @return PathNode* - Pointer to the head of the linked list of paths, NULL if
+ * there are none.
+ */
+PathNode* FindAllPathsFrozen(const FrozenGraph* frozen, unsigned int src,
+  unsigned int dest, unsigned int* numPaths);
+
+/**
+ * @brief Finds all paths from the source vertex to the destination vertex in
+ * the graph, on several threads.
+ *
+ * The search is split into the subtrees below short path prefixes, listed in
+ * the order a single search reaches them. Threads take the next unclaimed
+ * subtree when done with one, each with its own visited and path arrays, and
+ * the paths of every subtree are joined in prefix order. The list is the
+ * same as the one of FindAllPaths, in the same order.
+ *
+ * @param graph - Pointer to the graph.
+ * @param src - The identifier of the vertex from which paths start.
+ * @param dest - The identifier of the vertex to which paths are being found.
+ * @param numThreads - The number of threads, or 0 for GetThreadCount.
+ * @param numPaths - Pointer to store the number of paths found.
+ * @return PathNode* - Pointer to the head of the linked list of paths, NULL if
+ * there are none.
+ */
+PathNode* FindAllPathsParallel(const Graph* graph, unsigned int src,
+  unsigned int dest, unsigned int numThreads, unsigned int* numPaths);
+
 /**
  * @brief Frees the memory allocated for the list of paths.
  *
@@ -0,0 +1,662 @@
+/**
+ *
+ *  @file      strong-components.c
+ *  @brief     Function implementations for finding the strongly connected
+ *             components of a graph and condensing them into an acyclic
+ *             graph.
+ *  @details   A vertex without incoming edges from the rest of the graph, or
+ *             without outgoing edges to it, is a component on its own. Such
+ *             vertices are trimmed in rounds: each round removes a frontier
+ *             of them in parallel, and the vertices whose count of edges
+ *             drops to 0 on the way form the next frontier. Every frontier is
+ *             sorted, so the numbering never depends on the threads. Tarjan's
+ *             algorithm then splits the vertices left.
+ *  @author    Enrique Rodrigues
+ *  @date      17.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "strong-components.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parallel.h"
+
+#define TRIMMED_VERTEX 0xFFFFFFFE  // Component of a trimmed vertex until
+                                   // the final numbers are known
+#define NOT_DISCOVERED 0xFFFFFFFF
+
+/**
+  @struct VertexList
+  @brief  Growable array of vertices, one per task.
+**/
+typedef struct VertexList {
+  unsigned int* items;    // Dense indices of the vertices
+  unsigned int count;     // Number of vertices in the list
+  unsigned int capacity;  // Number of vertices the list can hold
+} VertexList;
+
+/**
+  @struct TrimContext
+  @brief  State shared by the threads which trim a graph.
+
+  @details While vertices without incoming edges are trimmed, degree counts
+           the incoming edges of every vertex, and while vertices without
+           outgoing edges are trimmed, the outgoing edges towards vertices
+           which are not trimmed. A task which drops a count to 0 is the only
+           one to see it, so each exposed vertex is pushed once.
+**/
+typedef struct TrimContext {
+  const Graph* graph;                   // Graph being condensed
+  unsigned int* component;              // Component of every vertex
+  volatile unsigned int* degree;        // Edges left of every vertex
+  unsigned int* reverseOffsets;         // First predecessor of each vertex
+  unsigned int* reverse;                // Predecessors of every vertex
+  volatile unsigned int* reverseFill;   // Predecessors stored so far
+  const unsigned int* items;            // Vertices of the current phase, or
+                                        // NULL for every dense index
+  unsigned int count;                   // Number of vertices of the phase
+  unsigned int numTasks;                // Number of tasks of the phase
+  bool backward;                        // True while trimming vertices
+                                        // without outgoing edges
+  VertexList next[MAX_THREADS];         // Vertices exposed by every task
+  bool failed[MAX_THREADS];             // Set by a task whose list could
+                                        // not grow
+} TrimContext;
+
+/**
+  @struct TarjanFrame
+  @brief  Vertex on the explicit call stack of Tarjan's algorithm, with the
+          position of its next edge.
+**/
+typedef struct TarjanFrame {
+  unsigned int vertex;       // Dense index of the vertex
+  unsigned int slot;         // Next edge in the current block
+  const EdgeBlock* block;    // Current block of outgoing edges
+} TarjanFrame;
+
+/**
+ *  @brief  Gets the first position of the range of a task.
+ *  @param  context - The context of the trimming.
+ *  @param  task    - The number of the task, or numTasks for the end.
+ *  @retval         - The first position of the range.
+ */
+static unsigned int RangeStart(const TrimContext* context, unsigned int task) {
+  return (unsigned int)((uint64_t)context->count * task / context->numTasks);
+}
+
+/**
+ *  @brief  Adds a vertex to a list, growing it when needed.
+ *  @param  list   - The list.
+ *  @param  vertex - The dense index of the vertex.
+ *  @retval        - True in the case of success.
+ *  @retval        - False if memory allocation fails.
+ */
+static bool PushToList(VertexList* list, unsigned int vertex) {
+  if (list->count == list->capacity) {
+    unsigned int capacity = list->capacity > 0 ? list->capacity * 2 : 64;
+    unsigned int* items = (unsigned int*)realloc(
+        list->items, capacity * sizeof(unsigned int));
+    if (items == NULL) {
+      return false;
+    }
+    list->items = items;
+    list->capacity = capacity;
+  }
+
+  list->items[list->count++] = vertex;
+  return true;
+}
+
+/**
+ *  @brief  Comparison function used to sort dense indices.
+ *  @param  a - Pointer to the first index.
+ *  @param  b - Pointer to the second index.
+ *  @retval   - Negative, zero or positive as in qsort.
+ */
+static int CompareIndices(const void* a, const void* b) {
+  unsigned int x = *(const unsigned int*)a;
+  unsigned int y = *(const unsigned int*)b;
+  return (x > y) - (x < y);
+}
+
+/**
+ *  @brief Counts the incoming edges of every vertex, from the outgoing edges
+ *         of the vertices in the range of a task.
+ *  @param argument - The context of the trimming.
+ *  @param task     - The number of the task.
+ */
+static void CountInDegreesTask(void* argument, unsigned int task) {
+  TrimContext* context = (TrimContext*)argument;
+  unsigned int end = RangeStart(context, task + 1);
+
+  for (unsigned int u = RangeStart(context, task); u < end; u++) {
+    const Vertex* vertex = context->graph->vertexByIndex[u];
+    if (vertex == NULL) {
+      continue;
+    }
+
+    const EdgeBlock* block = vertex->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        AtomicFetchIncrement(&context->degree[block->dest[i]]);
+      }
+    }
+  }
+}
+
+/**
+ *  @brief Stores the vertices in the range of a task as predecessors of the
+ *         destinations of their edges.
+ *  @param argument - The context of the trimming.
+ *  @param task     - The number of the task.
+ */
+static void FillReverseTask(void* argument, unsigned int task) {
+  TrimContext* context = (TrimContext*)argument;
+  unsigned int end = RangeStart(context, task + 1);
+
+  for (unsigned int u = RangeStart(context, task); u < end; u++) {
+    const Vertex* vertex = context->graph->vertexByIndex[u];
+    if (vertex == NULL) {
+      continue;
+    }
+
+    const EdgeBlock* block = vertex->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        unsigned int v = block->dest[i];
+        unsigned int slot = AtomicFetchIncrement(&context->reverseFill[v]);
+        context->reverse[context->reverseOffsets[v] + slot] = u;
+      }
+    }
+  }
+}
+
+/**
+ *  @brief Counts the outgoing edges towards vertices which are not trimmed,
+ *         for the vertices in the range of a task which are not either.
+ *  @param argument - The context of the trimming.
+ *  @param task     - The number of the task.
+ */
+static void CountOutDegreesTask(void* argument, unsigned int task) {
+  TrimContext* context = (TrimContext*)argument;
+  unsigned int end = RangeStart(context, task + 1);
+
+  for (unsigned int u = RangeStart(context, task); u < end; u++) {
+    const Vertex* vertex = context->graph->vertexByIndex[u];
+    if (vertex == NULL || context->component[u] != NO_COMPONENT) {
+      continue;
+    }
+
+    unsigned int degree = 0;
+    const EdgeBlock* block = vertex->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int i = 0; i < block->count; i++) {
+        degree += context->component[block->dest[i]] == NO_COMPONENT;
+      }
+    }
+    context->degree[u] = degree;
+  }
+}
+
+/**
+ *  @brief Removes the edges of the frontier vertices in the range of a task,
+ *         collecting the neighbours left without edges.
+ *  @param argument - The context of the trimming.
+ *  @param task     - The number of the task.
+ */
+static void TrimFrontierTask(void* argument, unsigned int task) {
+  TrimContext* context = (TrimContext*)argument;
+  unsigned int end = RangeStart(context, task + 1);
+  VertexList* next = &context->next[task];
+
+  for (unsigned int i = RangeStart(context, task); i < end; i++) {
+    unsigned int u = context->items[i];
+
+    if (context->backward) {
+      // Trimmed predecessors no longer count, whatever their degree
+      unsigned int last = context->reverseOffsets[u + 1];
+      for (unsigned int e = context->reverseOffsets[u]; e < last; e++) {
+        unsigned int p = context->reverse[e];
+        if (context->component[p] == NO_COMPONENT &&
+            AtomicFetchDecrement(&context->degree[p]) == 1 &&
+            !PushToList(next, p)) {
+          context->failed[task] = true;
+        }
+      }
+      continue;
+    }
+
+    const EdgeBlock* block = context->graph->vertexByIndex[u]->edges.head;
+    for (; block != NULL; block = block->next) {
+      for (unsigned int j = 0; j < block->count; j++) {
+        unsigned int v = block->dest[j];
+        if (AtomicFetchDecrement(&context->degree[v]) == 1 &&
+            !PushToList(next, v)) {
+          context->failed[task] = true;
+        }
+      }
+    }
+  }
+}
+
+/**
+ *  @brief  Runs a task over a set of vertices, on several threads if the set
+ *          is large enough.
+ *  @param  context    - The context of the trimming.
+ *  @param  task       - The function run by every task.
+ *  @param  items      - The vertices, or NULL for every dense index.
+ *  @param  count      - The number of vertices.
+ *  @param  numThreads - The number of threads of the condensation.
+ *  @retval            - True in the case of success.
+ *  @retval            - False if memory allocation fails.
+ */
+static bool RunTrimPhase(TrimContext* context, ParallelTask task,
+                         const unsigned int* items, unsigned int count,
+                         unsigned int numThreads) {
+  context->items = items;
+  context->count = count;
+  context->numTasks = count < SCC_PARALLEL_MIN_COUNT ? 1 : numThreads;
+  ParallelFor(context->numTasks, task, context);
+
+  for (unsigned int i = 0; i < context->numTasks; i++) {
+    if (context->failed[i]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ *  @brief  Trims vertices round by round, starting from the frontier at the
+ *          end of a list, until no vertex is exposed.
+ *  @param  context    - The context of the trimming.
+ *  @param  trimmed    - The list of trimmed vertices, in the order they are
+ *                       trimmed, ending with the first frontier.
+ *  @param  first      - The position of the first frontier in trimmed.
+ *  @param  numTrimmed - Pointer to the length of trimmed, updated with the
+ *                       vertices trimmed.
+ *  @param  numThreads - The number of threads of the condensation.
+ *  @retval            - True in the case of success.
+ *  @retval            - False if memory allocation fails.
+ */
+static bool TrimRounds(TrimContext* context, unsigned int* trimmed,
+                       unsigned int first, unsigned int* numTrimmed,
+                       unsigned int numThreads) {
+  while (first < *numTrimmed) {
+    unsigned int end = *numTrimmed;
+    for (unsigned int i = first; i < end; i++) {
+      context->component[trimmed[i]] = TRIMMED_VERTEX;
+    }
+
+    if (!RunTrimPhase(context, TrimFrontierTask, trimmed + first,
+                      end - first, numThreads)) {
+      return false;
+    }
+
+    // Each vertex reaches 0 once, so the next frontier has no duplicates
+    for (unsigned int task = 0; task < context->numTasks; task++) {
+      VertexList* next = &context->next[task];
+      for (unsigned int i = 0; i < next->count; i++) {
+        trimmed[(*numTrimmed)++] = next->items[i];
+      }
+      next->count = 0;
+    }
+    qsort(trimmed + end, *numTrimmed - end, sizeof(unsigned int),
+          CompareIndices);
+
+    first = end;
+  }
+
+  return true;
+}
+
+/**
+ *  @brief  Numbers the strongly connected components of the vertices which
+ *          are not trimmed with Tarjan's algorithm, without recursion.
+ *  @param  graph     - The graph being condensed.
+ *  @param  component - The component of every vertex, NO_COMPONENT for the
+ *                      vertices to be numbered.
+ *  @param  next      - The number of the first component.
+ *  @param  order     - Array of indexCount entries for the discovery order.
+ *  @param  lowLink   - Array of indexCount entries for the lowest order
+ *                      reachable from every vertex.
+ *  @param  stack     - Array of indexCount entries for the vertices whose
+ *                      component is open.
+ *  @param  frames    - Array of indexCount frames for the call stack.
+ *  @retval           - The number following the last component.
+ */
+static unsigned int RunTarjan(const Graph* graph, unsigned int* component,
+                              unsigned int next, unsigned int* order,
+                              unsigned int* lowLink, unsigned int* stack,
+                              TarjanFrame* frames) {
+  unsigned int n = graph->indexCount;
+  unsigned int counter = 0;
+  unsigned int top = 0;
+
+  for (unsigned int v = 0; v < n; v++) {
+    order[v] = NOT_DISCOVERED;
+  }
+
+  for (unsigned int root = 0; root < n; root++) {
+    if (graph->vertexByIndex[root] == NULL ||
+        component[root] != NO_COMPONENT || order[root] != NOT_DISCOVERED) {
+      continue;
+    }
+
+    unsigned int depth = 0;
+    order[root] = lowLink[root] = counter++;
+    stack[top++] = root;
+    frames[depth++] =
+        (TarjanFrame){ root, 0, graph->vertexByIndex[root]->edges.head };
+
+    while (depth > 0) {
+      TarjanFrame* frame = &frames[depth - 1];
+      unsigned int u = frame->vertex;
+
+      while (frame->block != NULL && frame->slot == frame->block->count) {
+        frame->block = frame->block->next;
+        frame->slot = 0;
+      }
+
+      if (frame->block != NULL) {
+        unsigned int v = frame->block->dest[frame->slot++];
+
+        // Numbered vertices belong to closed components, the others which
+        // were discovered are still on the stack
+        if (component[v] != NO_COMPONENT) {
+          continue;
+        }
+        if (order[v] == NOT_DISCOVERED) {
+          order[v] = lowLink[v] = counter++;
+          stack[top++] = v;
+          frames[depth++] =
+              (TarjanFrame){ v, 0, graph->vertexByIndex[v]->edges.head };
+        } else if (order[v] < lowLink[u]) {
+          lowLink[u] = order[v];
+        }
+        continue;
+      }
+
+      // Every edge of u is done, so it returns to its caller
+      depth--;
+      if (lowLink[u] == order[u]) {
+        unsigned int w;
+        do {
+          w = stack[--top];
+          component[w] = next;
+        } while (w != u);
+        next++;
+      }
+      if (depth > 0 && lowLink[u] < lowLink[frames[depth - 1].vertex]) {
+        lowLink[frames[depth - 1].vertex] = lowLink[u];
+      }
+    }
+  }
+
+  return next;
+}
+
+/**
+ *  @brief  Groups the vertices by component and collects the distinct
+ *          edges between components.
+ *  @param  graph        - The graph being condensed.
+ *  @param  condensation - The condensation, with every component numbered.
+ *  @param  stamp        - Array of numComponents entries, all 0, which
+ *                         counts the members placed and then marks the
+ *                         components already joined to the current one.
+ *  @retval              - True in the case of success.
+ *  @retval              - False if memory allocation fails.
+ */
+static bool BuildCondensedEdges(const Graph* graph,
+                                Condensation* condensation,
+                                unsigned int* stamp) {
+  unsigned int n = condensation->indexCount;
+  unsigned int numComponents = condensation->numComponents;
+  unsigned int* component = condensation->component;
+
+  // Members are counted, shifted by one for the prefix sum, then placed
+  for (unsigned int v = 0; v < n; v++) {
+    if (component[v] != NO_COMPONENT) {
+      condensation->memberOffsets[component[v] + 1]++;
+    }
+  }
+  for (unsigned int c = 0; c < numComponents; c++) {
+    condensation->memberOffsets[c + 1] += condensation->memberOffsets[c];
+  }
+  for (unsigned int v = 0; v < n; v++) {
+    unsigned int c = component[v];
+    if (c != NO_COMPONENT) {
+      condensation->members[condensation->memberOffsets[c] + stamp[c]++] = v;
+    }
+  }
+
+  // The first pass counts the distinct edges of every component, the
+  // second one stores them
+  for (int pass = 0; pass < 2; pass++) {
+    unsigned int numEdges = 0;
+    for (unsigned int c = 0; c < numComponents; c++) {
+      stamp[c] = NO_COMPONENT;
+    }
+
+    for (unsigned int c = 0; c < numComponents; c++) {
+      unsigned int last = condensation->memberOffsets[c + 1];
+      for (unsigned int m = condensation->memberOffsets[c]; m < last; m++) {
+        const EdgeBlock* block =
+            graph->vertexByIndex[condensation->members[m]]->edges.head;
+        for (; block != NULL; block = block->next) {
+          for (unsigned int i = 0; i < block->count; i++) {
+            unsigned int d = component[block->dest[i]];
+            if (d != c && stamp[d] != c) {
+              stamp[d] = c;
+              if (pass == 1) {
+                condensation->edgeDest[numEdges] = d;
+              }
+              numEdges++;
+            }
+          }
+        }
+      }
+      if (pass == 0) {
+        condensation->edgeOffsets[c + 1] = numEdges;
+      }
+    }
+
+    if (pass == 0) {
+      condensation->numEdges = numEdges;
+      condensation->edgeDest = (unsigned int*)malloc(
+          (numEdges > 0 ? numEdges : 1) * sizeof(unsigned int));
+      if (condensation->edgeDest == NULL) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+/**
+ *  @brief  Finds the strongly connected components of a graph and the
+ *          acyclic graph of the edges between them.
+ *  @details Vertices without incoming edges, and then vertices without
+ *           outgoing edges, are trimmed first as components of their own,
+ *           repeatedly as removing them exposes more. Trimming runs in
+ *           rounds, each one spread over several threads, and it is often
+ *           enough to settle most vertices of sparse graphs. The vertices
+ *           left are split with Tarjan's algorithm, kept on an explicit
+ *           stack instead of recursion, so graphs of millions of vertices
+ *           never overflow the call stack.
+ *  @param  graph      - The graph to be condensed.
+ *  @param  numThreads - The number of threads, or 0 for GetThreadCount.
+ *  @retval            - A pointer to the newly created condensation.
+ *  @retval            - NULL if the graph is NULL or memory allocation
+ *                       fails.
+ */
+Condensation* CondenseGraph(const Graph* graph, unsigned int numThreads) {
+  if (graph == NULL) {
+    return NULL;
+  }
+
+  if (numThreads == 0 || numThreads > MAX_THREADS) {
+    numThreads = numThreads == 0 ? GetThreadCount() : MAX_THREADS;
+  }
+
+  Condensation* condensation =
+      (Condensation*)calloc(1, sizeof(Condensation));
+  if (condensation == NULL) {
+    return NULL;
+  }
+
+  unsigned int n = graph->indexCount;
+  size_t size = n > 0 ? n : 1;
+  unsigned int numEdges = 0;
+  for (unsigned int v = 0; v < n; v++) {
+    if (graph->vertexByIndex[v] != NULL) {
+      numEdges += graph->vertexByIndex[v]->edges.degree;
+    }
+  }
+
+  TrimContext context = { 0 };
+  context.graph = graph;
+  context.component = (unsigned int*)malloc(size * sizeof(unsigned int));
+  context.degree = (unsigned int*)calloc(size, sizeof(unsigned int));
+  context.reverseOffsets =
+      (unsigned int*)calloc(size + 1, sizeof(unsigned int));
+  context.reverse = (unsigned int*)malloc(
+      (numEdges > 0 ? numEdges : 1) * sizeof(unsigned int));
+  context.reverseFill = (unsigned int*)calloc(size, sizeof(unsigned int));
+  unsigned int* trimmed = (unsigned int*)malloc(size * sizeof(unsigned int));
+  unsigned int* lowLink = (unsigned int*)malloc(size * sizeof(unsigned int));
+  unsigned int* stack = (unsigned int*)malloc(size * sizeof(unsigned int));
+  TarjanFrame* frames = (TarjanFrame*)malloc(size * sizeof(TarjanFrame));
+
+  condensation->indexCount = n;
+  condensation->component = context.component;
+
+  bool success = context.component != NULL && context.degree != NULL &&
+                 context.reverseOffsets != NULL && context.reverse != NULL &&
+                 context.reverseFill != NULL && trimmed != NULL &&
+                 lowLink != NULL && stack != NULL && frames != NULL;
+
+  unsigned int numSources = 0;
+  unsigned int numTrimmed = 0;
+  if (success) {
+    for (unsigned int v = 0; v < n; v++) {
+      context.component[v] = NO_COMPONENT;
+    }
+
+    // Incoming edges are counted, then listed for every vertex
+    success = RunTrimPhase(&context, CountInDegreesTask, NULL, n, numThreads);
+  }
+  if (success) {
+    for (unsigned int v = 0; v < n; v++) {
+      context.reverseOffsets[v + 1] =
+          context.reverseOffsets[v] + context.degree[v];
+    }
+    success = RunTrimPhase(&context, FillReverseTask, NULL, n, numThreads);
+  }
+
+  // Vertices without incoming edges are sources of the condensed graph
+  if (success) {
+    for (unsigned int v = 0; v < n; v++) {
+      if (graph->vertexByIndex[v] != NULL && context.degree[v] == 0) {
+        trimmed[numTrimmed++] = v;
+      }
+    }
+    success = TrimRounds(&context, trimmed, 0, &numTrimmed, numThreads);
+    numSources = numTrimmed;
+  }
+
+  // Vertices without outgoing edges are sinks, counted without the sources
+  if (success) {
+    success = RunTrimPhase(&context, CountOutDegreesTask, NULL, n,
+                           numThreads);
+  }
+  if (success) {
+    context.backward = true;
+    for (unsigned int v = 0; v < n; v++) {
+      if (graph->vertexByIndex[v] != NULL &&
+          context.component[v] == NO_COMPONENT && context.degree[v] == 0) {
+        trimmed[numTrimmed++] = v;
+      }
+    }
+    success = TrimRounds(&context, trimmed, numSources, &numTrimmed,
+                         numThreads);
+  }
+
+  if (success) {
+    // Sinks come first, in the order they were trimmed, each one reached
+    // only from vertices trimmed later or never trimmed
+    unsigned int numSinks = numTrimmed - numSources;
+    for (unsigned int i = 0; i < numSinks; i++) {
+      context.component[trimmed[numSources + i]] = i;
+    }
+
+    // The free arrays of the trimming hold the state of Tarjan's algorithm
+    unsigned int next =
+        RunTarjan(graph, context.component, numSinks,
+                  (unsigned int*)context.reverseFill, lowLink, stack, frames);
+
+    // Sources come last, each one reaching only those trimmed before it
+    condensation->numComponents = next + numSources;
+    for (unsigned int i = 0; i < numSources; i++) {
+      context.component[trimmed[i]] = condensation->numComponents - 1 - i;
+    }
+
+    condensation->memberOffsets = (unsigned int*)calloc(
+        (size_t)condensation->numComponents + 1, sizeof(unsigned int));
+    condensation->members =
+        (unsigned int*)malloc(size * sizeof(unsigned int));
+    condensation->edgeOffsets = (unsigned int*)calloc(
+        (size_t)condensation->numComponents + 1, sizeof(unsigned int));
+    success = condensation->memberOffsets != NULL &&
+              condensation->members != NULL &&
+              condensation->edgeOffsets != NULL;
+  }
+
+  if (success) {
+    for (unsigned int c = 0; c < condensation->numComponents; c++) {
+      lowLink[c] = 0;
+    }
+    success = BuildCondensedEdges(graph, condensation, lowLink);
+  }
+
+  for (unsigned int task = 0; task < MAX_THREADS; task++) {
+    free(context.next[task].items);
+  }
+  free((void*)context.degree);
+  free(context.reverseOffsets);
+  free(context.reverse);
+  free((void*)context.reverseFill);
+  free(trimmed);
+  free(lowLink);
+  free(stack);
+  free(frames);
+
+  if (!success) {
+    FreeCondensation(condensation);
+    return NULL;
+  }
+
+  return condensation;
+}
+
+/**
+ *  @brief Frees a condensation from memory.
+ *  @param condensation - The condensation to be freed, ignored if NULL.
+ */
+void FreeCondensation(Condensation* condensation) {
+  if (condensation == NULL) {
+    return;
+  }
+
+  free(condensation->component);
+  free(condensation->memberOffsets);
+  free(condensation->members);
+  free(condensation->edgeOffsets);
+  free(condensation->edgeDest);
+  free(condensation);
+}
@@ -0,0 +1,43 @@
+/**
+ *  @file      strong-components.h
+ *  @brief     Function definitions for finding the strongly connected
+ *             components of a graph and condensing them into an acyclic
+ *             graph.
+ *  @author    Enrique Rodrigues
+ *  @date      17.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef STRONG_COMPONENTS_H
+#define STRONG_COMPONENTS_H
+
+#include "graph.h"
+
+#define NO_COMPONENT 0xFFFFFFFF
+#define SCC_PARALLEL_MIN_COUNT 1024  // Smaller phases use a single thread
+
+/**
+ *  @brief  Finds the strongly connected components of a graph and the
+ *          acyclic graph of the edges between them.
+ *  @details Vertices without incoming edges, and then vertices without
+ *           outgoing edges, are trimmed first as components of their own,
+ *           repeatedly as removing them exposes more. Trimming runs in
+ *           rounds, each one spread over several threads, and it is often
+ *           enough to settle most vertices of sparse graphs. The vertices
+ *           left are split with Tarjan's algorithm, kept on an explicit
+ *           stack instead of recursion, so graphs of millions of vertices
+ *           never overflow the call stack.
+ *  @param  graph      - The graph to be condensed.
+ *  @param  numThreads - The number of threads, or 0 for GetThreadCount.
+ *  @retval            - A pointer to the newly created condensation.
+ *  @retval            - NULL if the graph is NULL or memory allocation
+ *                       fails.
+ */
+Condensation* CondenseGraph(const Graph* graph, unsigned int numThreads);
+
+/**
+ *  @brief Frees a condensation from memory.
+ *  @param condensation - The condensation to be freed, ignored if NULL.
+ */
+void FreeCondensation(Condensation* condensation);
+
+#endif  // !STRONG_COMPONENTS_H
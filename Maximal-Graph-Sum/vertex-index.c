@@ -0,0 +1,263 @@
+/**
+ *
+ *  @file      vertex-index.c
+ *  @brief     Function implementations for the open-addressing vertex index.
+ *  @details   Slots are probed a group at a time. With SSE2 a group is 16
+ *             control bytes compared in one instruction, with AVX2 it is 32,
+ *             and a portable loop is used when neither is available.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "vertex-index.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vertices.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define GROUP_WIDTH 32
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GROUP_WIDTH 16
+#define USE_SSE2_GROUPS
+#else
+#define GROUP_WIDTH 16
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#define CONTROL_EMPTY ((signed char)-128)
+#define CONTROL_DELETED ((signed char)-2)
+
+/**
+ *  @brief  Finds the position of the lowest set bit of a match mask.
+ *  @param  mask - A non-zero mask.
+ *  @retval      - The index of the lowest set bit.
+ */
+static inline unsigned int LowestBit(uint32_t mask) {
+#ifdef _MSC_VER
+  unsigned long position;
+  _BitScanForward(&position, mask);
+  return (unsigned int)position;
+#else
+  return (unsigned int)__builtin_ctz(mask);
+#endif
+}
+
+/**
+ *  @brief  Compares every control byte of a group against a value.
+ *  @param  group - The first control byte of the group.
+ *  @param  value - The value to look for.
+ *  @retval       - A mask with bit i set if control byte i matches.
+ */
+static inline uint32_t MatchByte(const signed char* group, signed char value) {
+#if defined(__AVX2__)
+  __m256i control = _mm256_loadu_si256((const __m256i*)group);
+  return (uint32_t)_mm256_movemask_epi8(
+      _mm256_cmpeq_epi8(control, _mm256_set1_epi8(value)));
+#elif defined(USE_SSE2_GROUPS)
+  __m128i control = _mm_loadu_si128((const __m128i*)group);
+  return (uint32_t)_mm_movemask_epi8(
+      _mm_cmpeq_epi8(control, _mm_set1_epi8(value)));
+#else
+  uint32_t mask = 0;
+  for (unsigned int i = 0; i < GROUP_WIDTH; i++) {
+    if (group[i] == value) {
+      mask |= 1u << i;
+    }
+  }
+  return mask;
+#endif
+}
+
+/**
+ *  @brief  Finds the slots of a group which do not hold a vertex. Empty and
+ *          deleted control bytes are the only negative ones, so only their
+ *          sign bit has to be checked.
+ *  @param  group - The first control byte of the group.
+ *  @retval       - A mask with bit i set if slot i is empty or deleted.
+ */
+static inline uint32_t MatchFree(const signed char* group) {
+#if defined(__AVX2__)
+  return (uint32_t)_mm256_movemask_epi8(
+      _mm256_loadu_si256((const __m256i*)group));
+#elif defined(USE_SSE2_GROUPS)
+  return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+  uint32_t mask = 0;
+  for (unsigned int i = 0; i < GROUP_WIDTH; i++) {
+    if (group[i] < 0) {
+      mask |= 1u << i;
+    }
+  }
+  return mask;
+#endif
+}
+
+/**
+ *  @brief  Allocates the slots of an empty vertex index.
+ *  @param  index       - The index to be initialized.
+ *  @param  minCapacity - The minimum number of slots, rounded up to a power
+ *                        of two.
+ *  @retval             - True in the case of success.
+ *  @retval             - False if memory allocation fails.
+ */
+bool InitVertexIndex(VertexIndex* index, unsigned int minCapacity) {
+  unsigned int capacity = GROUP_WIDTH;
+  while (capacity < minCapacity && capacity <= 0x40000000u) {
+    capacity <<= 1;
+  }
+
+  index->control = (signed char*)malloc(capacity);
+  index->ids = (unsigned int*)malloc(capacity * sizeof(unsigned int));
+  index->vertices = (Vertex**)malloc(capacity * sizeof(Vertex*));
+  if (index->control == NULL || index->ids == NULL ||
+      index->vertices == NULL) {
+    FreeVertexIndex(index);
+    return false;
+  }
+
+  memset(index->control, CONTROL_EMPTY, capacity);
+  index->capacity = capacity;
+  index->size = 0;
+  index->tombstones = 0;
+
+  return true;
+}
+
+/**
+ *  @brief Frees the slots of a vertex index and leaves it empty, with a
+ *         capacity of 0.
+ *  @param index - The index to be freed.
+ */
+void FreeVertexIndex(VertexIndex* index) {
+  free(index->control);
+  free(index->ids);
+  free(index->vertices);
+
+  index->control = NULL;
+  index->ids = NULL;
+  index->vertices = NULL;
+  index->capacity = 0;
+  index->size = 0;
+  index->tombstones = 0;
+}
+
+/**
+ *  @brief  Finds the slot holding a vertex identifier.
+ *  @param  index    - The index which should contain the vertex.
+ *  @param  vertexID - The identifier of the vertex.
+ *  @retval          - The slot of the vertex.
+ *  @retval          - NO_VERTEX_SLOT if the vertex is not in the index.
+ */
+unsigned int FindVertexSlot(const VertexIndex* index, unsigned int vertexID) {
+  if (index->capacity == 0) {
+    return NO_VERTEX_SLOT;
+  }
+
+  uint32_t hash = Hash(vertexID);
+  signed char tag = (signed char)(hash & 0x7F);
+  unsigned int groupMask = index->capacity / GROUP_WIDTH - 1;
+  unsigned int group = (hash >> 7) & groupMask;
+
+  // Triangular probing visits every group once, as the count is a power of 2
+  for (unsigned int step = 1; step <= groupMask + 1; step++) {
+    const signed char* control = index->control + group * GROUP_WIDTH;
+
+    uint32_t match = MatchByte(control, tag);
+    while (match != 0) {
+      unsigned int slot = group * GROUP_WIDTH + LowestBit(match);
+      if (index->ids[slot] == vertexID) {
+        return slot;
+      }
+      match &= match - 1;
+    }
+
+    // An empty slot ends the probe sequence of every identifier
+    if (MatchByte(control, CONTROL_EMPTY) != 0) {
+      return NO_VERTEX_SLOT;
+    }
+
+    group = (group + step) & groupMask;
+  }
+
+  return NO_VERTEX_SLOT;
+}
+
+/**
+ *  @brief  Inserts a vertex which is not yet in the index.
+ *  @param  index  - The index where the vertex is inserted.
+ *  @param  vertex - The vertex to be inserted.
+ *  @retval        - True in the case of success.
+ *  @retval        - False if every slot is in use.
+ */
+bool InsertVertexSlot(VertexIndex* index, Vertex* vertex) {
+  if (index->size >= index->capacity) {
+    return false;
+  }
+
+  uint32_t hash = Hash(vertex->id);
+  unsigned int groupMask = index->capacity / GROUP_WIDTH - 1;
+  unsigned int group = (hash >> 7) & groupMask;
+
+  for (unsigned int step = 1; step <= groupMask + 1; step++) {
+    uint32_t available = MatchFree(index->control + group * GROUP_WIDTH);
+    if (available != 0) {
+      unsigned int slot = group * GROUP_WIDTH + LowestBit(available);
+      if (index->control[slot] == CONTROL_DELETED) {
+        index->tombstones--;
+      }
+
+      index->control[slot] = (signed char)(hash & 0x7F);
+      index->ids[slot] = vertex->id;
+      index->vertices[slot] = vertex;
+      index->size++;
+      return true;
+    }
+
+    group = (group + step) & groupMask;
+  }
+
+  return false;
+}
+
+/**
+ *  @brief Removes the vertex held in a slot.
+ *  @param index - The index which contains the slot.
+ *  @param slot  - The slot to be cleared, as returned by FindVertexSlot.
+ */
+void EraseVertexSlot(VertexIndex* index, unsigned int slot) {
+  const signed char* group =
+      index->control + (slot / GROUP_WIDTH) * GROUP_WIDTH;
+
+  // A group that still has an empty slot was never full, so no probe
+  // sequence passes through it and the slot can become empty again.
+  // Otherwise it must stay marked, or later lookups would stop early.
+  if (MatchByte(group, CONTROL_EMPTY) != 0) {
+    index->control[slot] = CONTROL_EMPTY;
+  } else {
+    index->control[slot] = CONTROL_DELETED;
+    index->tombstones++;
+  }
+
+  index->vertices[slot] = NULL;
+  index->size--;
+}
+
+/**
+ *  @brief  Checks if a slot holds a vertex.
+ *  @param  index - The index which contains the slot.
+ *  @param  slot  - The slot to be checked.
+ *  @retval       - True if the slot holds a vertex.
+ */
+bool IsVertexSlotFull(const VertexIndex* index, unsigned int slot) {
+  return index->control[slot] >= 0;
+}
@@ -0,0 +1,67 @@
+/**
+ *  @file      vertex-index.h
+ *  @brief     Function definitions for the open-addressing vertex index.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef VERTEX_INDEX_H
+#define VERTEX_INDEX_H
+
+#include <stdbool.h>
+
+#include "graph.h"
+
+#define NO_VERTEX_SLOT 0xFFFFFFFF
+
+/**
+ *  @brief  Allocates the slots of an empty vertex index.
+ *  @param  index       - The index to be initialized.
+ *  @param  minCapacity - The minimum number of slots, rounded up to a power
+ *                        of two.
+ *  @retval             - True in the case of success.
+ *  @retval             - False if memory allocation fails.
+ */
+bool InitVertexIndex(VertexIndex* index, unsigned int minCapacity);
+
+/**
+ *  @brief Frees the slots of a vertex index and leaves it empty, with a
+ *         capacity of 0.
+ *  @param index - The index to be freed.
+ */
+void FreeVertexIndex(VertexIndex* index);
+
+/**
+ *  @brief  Finds the slot holding a vertex identifier.
+ *  @param  index    - The index which should contain the vertex.
+ *  @param  vertexID - The identifier of the vertex.
+ *  @retval          - The slot of the vertex.
+ *  @retval          - NO_VERTEX_SLOT if the vertex is not in the index.
+ */
+unsigned int FindVertexSlot(const VertexIndex* index, unsigned int vertexID);
+
+/**
+ *  @brief  Inserts a vertex which is not yet in the index.
+ *  @param  index  - The index where the vertex is inserted.
+ *  @param  vertex - The vertex to be inserted.
+ *  @retval        - True in the case of success.
+ *  @retval        - False if every slot is in use.
+ */
+bool InsertVertexSlot(VertexIndex* index, Vertex* vertex);
+
+/**
+ *  @brief Removes the vertex held in a slot.
+ *  @param index - The index which contains the slot.
+ *  @param slot  - The slot to be cleared, as returned by FindVertexSlot.
+ */
+void EraseVertexSlot(VertexIndex* index, unsigned int slot);
+
+/**
+ *  @brief  Checks if a slot holds a vertex.
+ *  @param  index - The index which contains the slot.
+ *  @param  slot  - The slot to be checked.
+ *  @retval       - True if the slot holds a vertex.
+ */
+bool IsVertexSlotFull(const VertexIndex* index, unsigned int slot);
+
+#endif  // !VERTEX_INDEX_H
@@ -16,6 +16,8 @@
 
 #include "edges.h"
 #include "graph.h"
+#include "node-pool.h"
+#include "vertex-index.h"
 
 /**
    @brief  Computes a hash value for a given ID.
@@ -39,75 +41,224 @@
             encryption, albeit with a slight advantage in using the same
             constant twice, which may offer marginal speed benefits.
 
-            The normalization of the hash value to fit within the hash table
-            size introduces collisions, however if the hash table is big enough
-            all collisions can be avoided.
+            The full 32 bits are returned. The vertex index takes the slot
+            group from the high bits and a 7-bit tag from the low bits, so no
+            modulo is needed on lookups.
 
             Credit to Thomas Mueller for this algorithm:
             (https://stackoverflow.com/users/382763/thomas-mueller)
             (https://stackoverflow.com/questions/664014/what-integer-hash-function-are-good-that-accepts-an-integer-hash-key)
 
-   @param  id       - The identifier to be hashed.
-   @param  hashSize - The size of the hash table.
-   @retval          - A hash value computed from input ID.
+   @param  id - The identifier to be hashed.
+   @retval    - A 32-bit hash value computed from input ID.
 **/
-uint32_t Hash(uint32_t id, uint32_t hashSize) {
-  // Inicialize position as given id
-  uint32_t index = id;
+uint32_t Hash(uint32_t id) {
+  // Inicialize hash as given id
+  uint32_t hash = id;
 
   // Apply the hash function
-  index = ((index >> 16) ^ index) * 0x45d9f3b;
-  index = ((index >> 16) ^ index) * 0x45d9f3b;
-  index = (index >> 16) ^ index;
+  hash = ((hash >> 16) ^ hash) * 0x45d9f3b;
+  hash = ((hash >> 16) ^ hash) * 0x45d9f3b;
+  hash = (hash >> 16) ^ hash;
 
-  // Normalize the hash value to fit within the hash table size
-  index %= hashSize;
-
-  return index;
+  return hash;
 }
 
 /**
  *  @brief Creates a new vertex with specified vertexID.
+ *  @param  graph    - The graph whose pool provides the vertex memory.
  *  @param  vertexID - The identifier of the vertex to be created.
  *  @retval          - A pointer to the newly created vertex.
  *  @retval          - NULL if memory allocation fails.
  */
-Vertex* CreateVertex(unsigned int vertexID) {
-  Vertex* newVertex = (Vertex*)malloc(sizeof(Vertex));
+Vertex* CreateVertex(Graph* graph, unsigned int vertexID) {
+  Vertex* newVertex = (Vertex*)AllocateNode(&graph->vertexPool);
   if (newVertex == NULL) {
     return NULL;
   }
 
   newVertex->id = vertexID;
-  newVertex->edges = NULL;
-  newVertex->next = NULL;
+  newVertex->index = NO_DENSE_INDEX;
+  newVertex->edges = (EdgeList){ NULL, 0, NULL };
+  newVertex->inEdges = (EdgeList){ NULL, 0, NULL };
 
   return newVertex;
 }
 
 /**
-    @brief Adds a vertex to the hash table of a graph.
+    @brief  Starts migrating the vertex index into a new one sized for the
+            current number of vertices.
+    @param  graph - The graph whose vertex index is resized.
+    @retval       - True if the migration was started.
+    @retval       - False if memory allocation fails, in which case the
+                    current index keeps being used.
+**/
+static bool StartRehash(Graph* graph) {
+  // Twice the vertices, rounded up to a power of two, leaves the new index
+  // between a quarter and half full once the migration completes
+  unsigned int target = graph->index.size * 2;
+  if (target < DEFAULT_HASH_TABLE_SIZE) {
+    target = DEFAULT_HASH_TABLE_SIZE;
+  }
+
+  VertexIndex newIndex;
+  if (!InitVertexIndex(&newIndex, target)) {
+    return false;
+  }
+
+  graph->oldIndex = graph->index;
+  graph->index = newIndex;
+  graph->rehashIndex = 0;
+
+  return true;
+}
+
+/**
+    @brief Migrates a bounded number of slots from the old vertex index to the
+           current one, releasing the old index once it is empty.
+    @param graph - The graph being migrated.
+    @param slots - The maximum number of slots to migrate.
+**/
+static void RehashStep(Graph* graph, unsigned int slots) {
+  VertexIndex* oldIndex = &graph->oldIndex;
+
+  while (graph->rehashIndex < oldIndex->capacity && slots > 0) {
+    unsigned int slot = graph->rehashIndex++;
+    if (IsVertexSlotFull(oldIndex, slot)) {
+      InsertVertexSlot(&graph->index, oldIndex->vertices[slot]);
+      // Erased like any removal, which leaves a tombstone only where probes
+      // still need it, so other lookups in the old index work
+      EraseVertexSlot(oldIndex, slot);
+    }
+    slots--;
+  }
+
+  if (graph->rehashIndex == oldIndex->capacity) {
+    FreeVertexIndex(oldIndex);
+    graph->rehashIndex = 0;
+  }
+}
+
+/**
+    @brief Keeps the load factor of the vertex index between MIN_LOAD_FACTOR
+           and MAX_LOAD_FACTOR, advancing any migration already in progress.
+           The index only shrinks after a removal, so a table presized by
+           CreateGraph keeps its size while it is being filled.
+    @param graph   - The graph whose vertex index is maintained.
+    @param removed - True if a vertex was just removed.
+
+    @note  A migration of capacity C slots moves REHASH_SLOTS_PER_STEP slots
+           per call, so it completes well before the new index, at most half
+           full when it starts, can fill up. Should a new resize be needed
+           sooner, the rest of the old index is migrated at once.
+**/
+static void MaintainVertexIndex(Graph* graph, bool removed) {
+  if (graph->oldIndex.capacity > 0) {
+    RehashStep(graph, REHASH_SLOTS_PER_STEP);
+  }
+
+  const VertexIndex* index = &graph->index;
+  bool tooFull =
+      index->size + index->tombstones > MAX_LOAD_FACTOR * index->capacity;
+  bool tooEmpty = removed &&
+                  index->size + graph->oldIndex.size <
+                      MIN_LOAD_FACTOR * index->capacity &&
+                  index->capacity / 2 >= DEFAULT_HASH_TABLE_SIZE;
+  if (!tooFull && !tooEmpty) {
+    return;
+  }
+
+  if (graph->oldIndex.capacity > 0) {
+    if (!tooFull) {
+      return;  // Shrinking can wait for the current migration
+    }
+    RehashStep(graph, graph->oldIndex.capacity);
+  }
+
+  if (StartRehash(graph)) {
+    RehashStep(graph, REHASH_SLOTS_PER_STEP);
+  }
+}
+
+/**
+    @brief  Gives a vertex a dense index, reusing the index of a removed
+            vertex when there is one.
+    @param  graph  - The graph which will contain the vertex.
+    @param  vertex - The vertex which receives the index.
+    @retval        - True in the case of success.
+    @retval        - False if memory allocation fails.
+**/
+static bool AssignDenseIndex(Graph* graph, Vertex* vertex) {
+  unsigned int index;
+  if (graph->numFreeIndices > 0) {
+    index = graph->freeIndices[--graph->numFreeIndices];
+  } else {
+    if (graph->indexCount == graph->indexCapacity) {
+      unsigned int capacity = graph->indexCapacity > 0
+                                  ? graph->indexCapacity * 2
+                                  : DEFAULT_DENSE_INDEX_CAPACITY;
+
+      Vertex** vertexByIndex = (Vertex**)realloc(
+          graph->vertexByIndex, capacity * sizeof(Vertex*));
+      if (vertexByIndex == NULL) {
+        return false;
+      }
+      graph->vertexByIndex = vertexByIndex;
+
+      unsigned int* freeIndices = (unsigned int*)realloc(
+          graph->freeIndices, capacity * sizeof(unsigned int));
+      if (freeIndices == NULL) {
+        return false;
+      }
+      graph->freeIndices = freeIndices;
+
+      graph->indexCapacity = capacity;
+    }
+    index = graph->indexCount++;
+  }
+
+  vertex->index = index;
+  graph->vertexByIndex[index] = vertex;
+
+  return true;
+}
+
+/**
+    @brief Returns the dense index of a vertex to the graph, to be reused.
+    @param graph  - The graph which contains the vertex.
+    @param vertex - The vertex giving up its index.
+**/
+static void ReleaseDenseIndex(Graph* graph, Vertex* vertex) {
+  graph->vertexByIndex[vertex->index] = NULL;
+  graph->freeIndices[graph->numFreeIndices++] = vertex->index;
+  vertex->index = NO_DENSE_INDEX;
+}
+
+/**
+    @brief Adds a vertex to the hash table of a graph and gives it a dense
+           index.
     @param graph    - The graph where the vertex should be added.
     @param vertex   - The vertex to be added to the hash table of the graph.
-    @retval         - False if given graph is NULL.
+    @retval         - False if given graph is NULL or the hash table is full.
     @retval         - True in the case of success.
 **/
-bool AddVertex(const Graph* graph, Vertex* vertex) {
+bool AddVertex(Graph* graph, Vertex* vertex) {
   if (graph == NULL) {
     return false;
   }
 
-  unsigned int index = Hash(vertex->id, graph->hashSize);
+  if (!AssignDenseIndex(graph, vertex)) {
+    return false;
+  }
 
-  // Handle collisions
-  if (graph->vertices[index] == NULL) {
-    graph->vertices[index] = vertex;
-  } else {
-    // Insert new vertex at the beginning
-    vertex->next = graph->vertices[index];
-    graph->vertices[index] = vertex;
+  // New vertices always go to the current index
+  if (!InsertVertexSlot(&graph->index, vertex)) {
+    ReleaseDenseIndex(graph, vertex);
+    return false;
   }
 
+  MaintainVertexIndex(graph, false);
+
   return true;
 }
 
@@ -124,13 +275,13 @@ int CreateAddVertex(Graph* graph, unsigned int vertexID) {
     return VERTEX_ALREADY_EXISTS;
   }
 
-  Vertex* vertex = CreateVertex(vertexID);
+  Vertex* vertex = CreateVertex(graph, vertexID);
   if (vertex == NULL) {
     return FAILURE_CREATING_VERTEX;
   }
 
   if (AddVertex(graph, vertex) == false) {
-    free(vertex);
+    ReleaseNode(&graph->vertexPool, vertex);
     return FAILURE_ADDING_VERTEX;
   }
 
@@ -146,24 +297,7 @@ int CreateAddVertex(Graph* graph, unsigned int vertexID) {
  *  @retval             - True if vertex exists or False if not.
  */
 bool VertexExists(const Graph* graph, unsigned int vertexID) {
-  unsigned int index = Hash(vertexID, graph->hashSize);
-  Vertex* current = graph->vertices[index];
-
-  // Check if the direct entry exists
-  if (current != NULL && current->id == vertexID) {
-    return true;
-  }
-
-  // Traverse the linked list to check for the vertex
-  while (current != NULL) {
-    if (current->id == vertexID) {
-      return true;
-    }
-    current = current->next;
-  }
-
-  // Return false if the vertex is not found
-  return false;
+  return FindVertex(graph, vertexID) != NULL;
 }
 
 /**
@@ -174,20 +308,15 @@ bool VertexExists(const Graph* graph, unsigned int vertexID) {
  *  @retval          - NULL if vertex was not found.
  */
 Vertex* FindVertex(const Graph* graph, unsigned int vertexID) {
-  unsigned int index = Hash(vertexID, graph->hashSize);
-  Vertex* current = graph->vertices[index];
-
-  // Directly return the vertex if found
-  if (current != NULL && current->id == vertexID) {
-    return current;
+  unsigned int slot = FindVertexSlot(&graph->index, vertexID);
+  if (slot != NO_VERTEX_SLOT) {
+    return graph->index.vertices[slot];
   }
 
-  // Traverse the linked list to find the vertex
-  while (current != NULL) {
-    if (current->id == vertexID) {
-      return current;
-    }
-    current = current->next;
+  // The vertex may not have been migrated yet
+  slot = FindVertexSlot(&graph->oldIndex, vertexID);
+  if (slot != NO_VERTEX_SLOT) {
+    return graph->oldIndex.vertices[slot];
   }
 
   // Return NULL if the vertex is not found
@@ -207,18 +336,70 @@ int RemoveVertex(Graph* graph, int vertexID) {
     return INVALID_GRAPH;
   }
 
-  Vertex* vertexToRemove = FindVertex(graph, vertexID);
-  if (vertexToRemove == NULL) {
+  VertexIndex* index = &graph->index;
+  unsigned int slot = FindVertexSlot(index, vertexID);
+  if (slot == NO_VERTEX_SLOT) {
+    index = &graph->oldIndex;
+    slot = FindVertexSlot(index, vertexID);
+  }
+  if (slot == NO_VERTEX_SLOT) {
     return VERTEX_DOES_NOT_EXIST;
   }
 
-  RemoveOutgoingEdges(vertexToRemove);
+  Vertex* vertexToRemove = index->vertices[slot];
+
+  RemoveOutgoingEdges(graph, vertexToRemove);
 
+  // Incoming edges are found through the vertex, so it is still indexed here
   RemoveIncomingEdges(graph, vertexID);
 
-  free(vertexToRemove);
+  EraseVertexSlot(index, slot);
+  ReleaseDenseIndex(graph, vertexToRemove);
+  ReleaseNode(&graph->vertexPool, vertexToRemove);
 
   graph->numVertices--;
 
+  MaintainVertexIndex(graph, true);
+
   return SUCCESS_REMOVING_VERTEX;
 }
+
+/**
+    @brief Prepares an iterator over every vertex of a graph.
+    @param iterator - The iterator to be initialized.
+    @param graph    - The graph to be iterated.
+**/
+void InitVertexIterator(VertexIterator* iterator, const Graph* graph) {
+  iterator->graph = graph;
+  iterator->inOldTable = false;
+  iterator->slot = 0;
+}
+
+/**
+    @brief  Advances an iterator to the next vertex of the graph.
+    @param  iterator - The iterator to be advanced.
+    @retval          - The next vertex, or NULL when every vertex was visited.
+    @note   The returned vertex may be freed before the next call, as the
+            iterator has already moved past it.
+**/
+Vertex* NextVertex(VertexIterator* iterator) {
+  const Graph* graph = iterator->graph;
+
+  for (;;) {
+    const VertexIndex* index =
+        iterator->inOldTable ? &graph->oldIndex : &graph->index;
+
+    while (iterator->slot < index->capacity) {
+      unsigned int slot = iterator->slot++;
+      if (IsVertexSlotFull(index, slot)) {
+        return index->vertices[slot];
+      }
+    }
+
+    if (iterator->inOldTable) {
+      return NULL;  // Both tables have been visited
+    }
+    iterator->inOldTable = true;
+    iterator->slot = graph->rehashIndex;  // Earlier slots were migrated
+  }
+}
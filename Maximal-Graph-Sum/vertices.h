@@ -15,35 +15,40 @@
 #include "graph.h"
 
 #define MIN_LOAD_FACTOR 0.1
-#define MAX_LOAD_FACTOR 0.5
+#define MAX_LOAD_FACTOR 0.875  // Counts deleted slots, as they lengthen probes
 
 #define DEFAULT_HASH_TABLE_SIZE 100
+#define REHASH_SLOTS_PER_STEP 32
+
+#define DEFAULT_DENSE_INDEX_CAPACITY 64
+#define NO_DENSE_INDEX 0xFFFFFFFF
 
 /**
    @brief  Computes a hash value for a given ID.
 
-   @param  id       - The identifier to be hashed.
-   @param  hashSize - The size of the hash table.
-   @retval          - A hash value computed from input ID.
+   @param  id - The identifier to be hashed.
+   @retval    - A 32-bit hash value computed from input ID.
 **/
-uint32_t Hash(uint32_t id, uint32_t hashSize);
+uint32_t Hash(uint32_t id);
 
 /**
  *  @brief Creates a new vertex with specified vertexID.
+ *  @param  graph    - The graph whose pool provides the vertex memory.
  *  @param  vertexID - The identifier of the vertex to be created.
  *  @retval          - A pointer to the newly created vertex. NULL if memory
  *                     allocation fails.
  */
-Vertex* CreateVertex(unsigned int vertexID);
+Vertex* CreateVertex(Graph* graph, unsigned int vertexID);
 
 /**
-    @brief Adds a vertex to the hash table of a graph.
+    @brief Adds a vertex to the hash table of a graph and gives it a dense
+           index.
     @param graph    - The graph where the vertex should be added.
     @param vertex   - The vertex to be added to the hash table of the graph.
     @retval         - False if given graph is NULL.
     @retval         - True in the case of success.
 **/
-bool AddVertex(const Graph* graph, Vertex* vertex);
+bool AddVertex(Graph* graph, Vertex* vertex);
 
 /**
     @brief  Creates and adds a vertex to the hash table of a graph.
@@ -82,4 +87,20 @@ Vertex* FindVertex(const Graph* graph, unsigned int vertexID);
 **/
 int RemoveVertex(Graph* graph, int vertexID);
 
+/**
+    @brief Prepares an iterator over every vertex of a graph.
+    @param iterator - The iterator to be initialized.
+    @param graph    - The graph to be iterated.
+**/
+void InitVertexIterator(VertexIterator* iterator, const Graph* graph);
+
+/**
+    @brief  Advances an iterator to the next vertex of the graph.
+    @param  iterator - The iterator to be advanced.
+    @retval          - The next vertex, or NULL when every vertex was visited.
+    @note   The returned vertex may be freed before the next call, as the
+            iterator has already moved past it.
+**/
+Vertex* NextVertex(VertexIterator* iterator);
+
 #endif  // !VERTICES_H